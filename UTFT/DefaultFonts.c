@@ -2,7 +2,10 @@
 // If you want to use your own/downloaded fonts you should just drop the font .c file into your sketch folder.
 // -----------------------------------------------------------------------------------------------------------
 
-#if defined(__AVR__)
+#if defined(UTFT_HOST)
+	#define PROGMEM
+	#define fontdatatype const unsigned char
+#elif defined(__AVR__)
 	#include <avr/pgmspace.h>
 	#define fontdatatype const uint8_t
 #elif defined(__PIC32MX__)
@@ -0,0 +1,350 @@
+// FontConverter
+//
+// Converts a TrueType/OpenType or BDF font into a proportional font for the
+// UTFT library. TrueType fonts can be converted with 1, 2 or 4 bits per
+// pixel, where 2 and 4 bits per pixel give anti-aliased text. BDF fonts are
+// bitmap fonts and are always converted with 1 bit per pixel.
+//
+// Build with:
+//   g++ -O2 FontConverter.cpp -o FontConverter -I/usr/include/freetype2 -lfreetype
+// or without FreeType (BDF fonts only):
+//   g++ -O2 -DNO_FREETYPE FontConverter.cpp -o FontConverter
+//
+// Usage:
+//   FontConverter [-b 1|2|4] [-s size] [-r first-last] <font.ttf|font.bdf> <name>
+//
+// -b sets the bits per pixel (default 4), -s the font size in pixels
+// (default 16) and -r the range of characters (default 32-126). The C
+// source is written to <name>.c and the array is named after the last part
+// of <name>.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+#ifndef NO_FREETYPE
+	#include <ft2build.h>
+	#include FT_FREETYPE_H
+#endif
+
+typedef std::vector<unsigned char>	bytes;
+
+struct glyph
+{
+	int		w, h, xoff, top, advance;
+	bytes	gray;							// w*h alpha values
+};
+
+struct kern
+{
+	int		left, right, adj;
+};
+
+static std::vector<glyph>	glyphs;
+static std::vector<kern>	kerning;
+static int					ascent, line_height;
+
+#ifndef NO_FREETYPE
+static bool load_freetype(const char *filename, int size, int first, int last, int bpp)
+{
+	FT_Library	library;
+	FT_Face		face;
+
+	if (FT_Init_FreeType(&library))
+		return false;
+	if (FT_New_Face(library, filename, 0, &face))
+		return false;
+	FT_Set_Pixel_Sizes(face, 0, size);
+	ascent=(face->size->metrics.ascender+63)>>6;
+	line_height=ascent+((-face->size->metrics.descender+63)>>6);
+
+	for (int c=first; c<=last; c++)
+	{
+		glyph g;
+
+		if (FT_Load_Char(face, c, bpp==1 ? FT_LOAD_RENDER | FT_LOAD_TARGET_MONO : FT_LOAD_RENDER))
+		{
+			g.w=g.h=g.xoff=g.top=g.advance=0;
+			glyphs.push_back(g);
+			continue;
+		}
+		FT_Bitmap &bm=face->glyph->bitmap;
+		g.w=bm.width;
+		g.h=bm.rows;
+		g.xoff=face->glyph->bitmap_left;
+		g.top=ascent-face->glyph->bitmap_top;
+		g.advance=(face->glyph->advance.x+32)>>6;
+		g.gray.resize(g.w*g.h);
+		for (int y=0; y<g.h; y++)
+			for (int x=0; x<g.w; x++)
+			{
+				unsigned char *row=bm.buffer+(y*bm.pitch);
+
+				if (bm.pixel_mode==FT_PIXEL_MODE_MONO)
+					g.gray[(y*g.w)+x]=(row[x>>3] & (0x80>>(x & 7))) ? 255 : 0;
+				else
+					g.gray[(y*g.w)+x]=row[x];
+			}
+		glyphs.push_back(g);
+	}
+
+	if (FT_HAS_KERNING(face))
+		for (int l=first; l<=last; l++)
+			for (int r=first; r<=last; r++)
+			{
+				FT_Vector	delta;
+				int			adj;
+
+				FT_Get_Kerning(face, FT_Get_Char_Index(face, l), FT_Get_Char_Index(face, r), FT_KERNING_DEFAULT, &delta);
+				adj=(delta.x+(delta.x<0 ? -32 : 32))/64;
+				if (adj!=0)
+				{
+					kern k={l, r, adj};
+					kerning.push_back(k);
+				}
+			}
+	FT_Done_Face(face);
+	FT_Done_FreeType(library);
+	return true;
+}
+#endif
+
+static bool load_bdf(const char *filename, int first, int last)
+{
+	FILE	*f=fopen(filename, "r");
+	char	line[256];
+	int		descent=0, enc=-1, dwidth=0, bw=0, bh=0, bx=0, by=0;
+
+	if (f==NULL)
+		return false;
+	glyphs.assign(last-first+1, glyph());
+	for (size_t i=0; i<glyphs.size(); i++)
+		glyphs[i].w=glyphs[i].h=glyphs[i].xoff=glyphs[i].top=glyphs[i].advance=0;
+	ascent=0;
+	while (fgets(line, sizeof(line), f))
+	{
+		if (sscanf(line, "FONT_ASCENT %d", &ascent)==1)
+			continue;
+		if (sscanf(line, "FONT_DESCENT %d", &descent)==1)
+			continue;
+		if (sscanf(line, "ENCODING %d", &enc)==1)
+			continue;
+		if (sscanf(line, "DWIDTH %d", &dwidth)==1)
+			continue;
+		if (sscanf(line, "BBX %d %d %d %d", &bw, &bh, &bx, &by)==4)
+			continue;
+		if ((strncmp(line, "BITMAP", 6)==0) && (enc>=first) && (enc<=last))
+		{
+			glyph &g=glyphs[enc-first];
+
+			g.w=bw;
+			g.h=bh;
+			g.xoff=bx;
+			g.top=ascent-(by+bh);
+			g.advance=dwidth;
+			g.gray.assign(bw*bh, 0);
+			for (int y=0; y<bh; y++)
+			{
+				if (!fgets(line, sizeof(line), f))
+					break;
+				for (int x=0; x<bw; x++)
+				{
+					char		hex[2]={line[x>>2], 0};
+					unsigned	v=strtoul(hex, NULL, 16);
+
+					if (v & (8>>(x & 3)))
+						g.gray[(y*bw)+x]=255;
+				}
+			}
+			enc=-1;
+		}
+	}
+	fclose(f);
+	line_height=ascent+descent;
+	return ascent>0;
+}
+
+// Removes empty rows and columns, and rows above or below the text line
+static void trim(glyph &g)
+{
+	int x1=g.w, x2=-1, y1=g.h, y2=-1;
+
+	for (int y=0; y<g.h; y++)
+		for (int x=0; x<g.w; x++)
+			if ((g.gray[(y*g.w)+x]!=0) && (g.top+y>=0) && (g.top+y<line_height))
+			{
+				x1=std::min(x1, x);
+				x2=std::max(x2, x);
+				y1=std::min(y1, y);
+				y2=std::max(y2, y);
+			}
+	if (x2<0)
+	{
+		g.w=g.h=g.xoff=g.top=0;
+		g.gray.clear();
+		return;
+	}
+	bytes gray;
+	for (int y=y1; y<=y2; y++)
+		for (int x=x1; x<=x2; x++)
+			gray.push_back(g.gray[(y*g.w)+x]);
+	g.xoff+=x1;
+	g.top+=y1;
+	g.w=x2-x1+1;
+	g.h=y2-y1+1;
+	g.gray=gray;
+}
+
+static bool kern_less(const kern &a, const kern &b)
+{
+	return ((a.left<<8) | a.right)<((b.left<<8) | b.right);
+}
+
+static bool kern_larger(const kern &a, const kern &b)
+{
+	return abs(a.adj)>abs(b.adj);
+}
+
+int main(int argc, char *argv[])
+{
+	int			bpp=4, size=16, first=32, last=126, arg=1, levels, max_advance=0;
+	const char	*name;
+	char		filename[256];
+	bytes		out;
+	FILE		*f;
+	bool		ok;
+
+	while ((arg+1<argc) && (argv[arg][0]=='-'))
+	{
+		if (strcmp(argv[arg], "-b")==0)
+			bpp=atoi(argv[arg+1]);
+		else if (strcmp(argv[arg], "-s")==0)
+			size=atoi(argv[arg+1]);
+		else if (strcmp(argv[arg], "-r")==0)
+			sscanf(argv[arg+1], "%d-%d", &first, &last);
+		arg+=2;
+	}
+	if ((arg+2!=argc) || ((bpp!=1) && (bpp!=2) && (bpp!=4)) || (first<0) || (last>255) || (first>last) || (last-first>=255))
+	{
+		fprintf(stderr, "Usage: %s [-b 1|2|4] [-s size] [-r first-last] <font.ttf|font.bdf> <name>\n", argv[0]);
+		return 1;
+	}
+
+	const char *ext=strrchr(argv[arg], '.');
+	if ((ext!=NULL) && (strcmp(ext, ".bdf")==0))
+	{
+		bpp=1;
+		ok=load_bdf(argv[arg], first, last);
+	}
+	else
+	{
+#ifndef NO_FREETYPE
+		ok=load_freetype(argv[arg], size, first, last, bpp);
+#else
+		(void)size;
+		fprintf(stderr, "Built without FreeType, only BDF fonts can be converted\n");
+		return 1;
+#endif
+	}
+	if (!ok)
+	{
+		fprintf(stderr, "Could not read font file %s\n", argv[arg]);
+		return 1;
+	}
+	if (line_height>255)
+	{
+		fprintf(stderr, "The font is too large, use a smaller size\n");
+		return 1;
+	}
+
+	// Only 255 kerning pairs fit in the font, so the largest are kept
+	if (kerning.size()>255)
+	{
+		std::sort(kerning.begin(), kerning.end(), kern_larger);
+		printf("Keeping 255 of %d kerning pairs\n", int(kerning.size()));
+		kerning.resize(255);
+	}
+	std::sort(kerning.begin(), kerning.end(), kern_less);
+
+	// Header, glyph table and kerning pairs
+	levels=(1<<bpp)-1;
+	out.resize(8+(glyphs.size()*8)+(kerning.size()*3));
+	for (size_t i=0; i<glyphs.size(); i++)
+	{
+		glyph &g=glyphs[i];
+		int e=8+(i*8);
+
+		for (size_t j=0; j<g.gray.size(); j++)
+			g.gray[j]=((g.gray[j]*levels)+127)/255;
+		trim(g);
+		g.advance=std::max(0, std::min(255, g.advance));
+		max_advance=std::max(max_advance, g.advance);
+		out[e]=out.size() & 0xFF;
+		out[e+1]=(out.size()>>8) & 0xFF;
+		out[e+2]=(out.size()>>16) & 0xFF;
+		out[e+3]=g.w;
+		out[e+4]=g.h;
+		out[e+5]=(unsigned char)(signed char)std::max(-128, std::min(127, g.xoff));
+		out[e+6]=g.top;
+		out[e+7]=g.advance;
+		for (int y=0; y<g.h; y++)
+		{
+			int bits=0, acc=0;
+
+			for (int x=0; x<g.w; x++)
+			{
+				acc=(acc<<bpp) | g.gray[(y*g.w)+x];
+				bits+=bpp;
+				if (bits==8)
+				{
+					out.push_back(acc);
+					bits=acc=0;
+				}
+			}
+			if (bits>0)
+				out.push_back(acc<<(8-bits));
+		}
+	}
+	out[0]=0;
+	out[1]=line_height;
+	out[2]=first;
+	out[3]=glyphs.size() & 0xFF;
+	out[4]=bpp;
+	out[5]=max_advance;
+	out[6]=ascent;
+	out[7]=kerning.size();
+	for (size_t i=0; i<kerning.size(); i++)
+	{
+		out[8+(glyphs.size()*8)+(i*3)]=kerning[i].left;
+		out[8+(glyphs.size()*8)+(i*3)+1]=kerning[i].right;
+		out[8+(glyphs.size()*8)+(i*3)+2]=(unsigned char)(signed char)std::max(-128, std::min(127, kerning[i].adj));
+	}
+
+	snprintf(filename, sizeof(filename), "%s.c", argv[arg+1]);
+	name=strrchr(argv[arg+1], '/');
+	name=(name==NULL) ? argv[arg+1] : name+1;
+	f=fopen(filename, "w");
+	if (f==NULL)
+	{
+		fprintf(stderr, "Could not create %s\n", filename);
+		return 1;
+	}
+	fprintf(f, "// Generated by  : FontConverter\n");
+	fprintf(f, "// Generated from: %s\n", argv[arg]);
+	fprintf(f, "// Font Size     : %d pixels, %d bits per pixel\n", line_height, bpp);
+	fprintf(f, "// Memory usage  : %lu bytes\n", (unsigned long)out.size());
+	fprintf(f, "// # characters  : %d (%d kerning pairs)\n\n", int(glyphs.size()), int(kerning.size()));
+	fprintf(f, "#if defined(UTFT_HOST)\n\t#define PROGMEM\n\t#define fontdatatype const unsigned char\n");
+	fprintf(f, "#elif defined(__AVR__)\n\t#include <avr/pgmspace.h>\n\t#define fontdatatype const uint8_t\n");
+	fprintf(f, "#else\n\t#define PROGMEM\n\t#define fontdatatype const unsigned char\n#endif\n\n");
+	fprintf(f, "fontdatatype %s[%lu] PROGMEM={\n", name, (unsigned long)out.size());
+	for (size_t i=0; i<out.size(); i++)
+		fprintf(f, "0x%02X%s%s", out[i], i+1<out.size() ? "," : "", ((i%16)==15) || (i+1==out.size()) ? "\n" : " ");
+	fprintf(f, "};\n");
+	fclose(f);
+	printf("%s: %d characters, %d kerning pairs, %lu bytes\n", filename, int(glyphs.size()), int(kerning.size()), (unsigned long)out.size());
+	return 0;
+}
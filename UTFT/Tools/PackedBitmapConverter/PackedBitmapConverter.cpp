@@ -0,0 +1,267 @@
+// PackedBitmapConverter
+//
+// Converts a binary PPM (P6) image into a packed bitmap array for the 
+// drawPackedBitmap()-function of the UTFT library. Most image editors can
+// save PPM files, or use "convert image.png image.ppm" from ImageMagick.
+//
+// Build with:
+//   g++ -O2 PackedBitmapConverter.cpp -o PackedBitmapConverter
+//
+// Usage:
+//   PackedBitmapConverter [-f auto|rle565|pal|palrle] <image.ppm> <name>
+//
+// The C source is written to <name>.c and the array is named after the 
+// last part of <name>. In "auto" mode (the default) the 
+// smallest format is chosen. Palette formats are only possible when the 
+// image has no more than 256 different RGB565 colors.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define BITMAP_RLE565	1
+#define BITMAP_PAL1		2
+#define BITMAP_PAL2		3
+#define BITMAP_PAL4		4
+#define BITMAP_PAL8		5
+#define BITMAP_PALRLE	6
+
+static const char *format_names[] = {"", "BITMAP_RLE565", "BITMAP_PAL1", "BITMAP_PAL2", "BITMAP_PAL4", "BITMAP_PAL8", "BITMAP_PALRLE"};
+
+typedef std::vector<unsigned char>	bytes;
+typedef std::vector<unsigned short>	pixels;
+
+static int ppm_token(FILE *f)
+{
+	int c, v=0;
+
+	do
+	{
+		c=fgetc(f);
+		if (c=='#')
+			while ((c!='\n') && (c!=EOF))
+				c=fgetc(f);
+	} while ((c==' ') || (c=='\t') || (c=='\r') || (c=='\n'));
+	while ((c>='0') && (c<='9'))
+	{
+		v=(v*10)+(c-'0');
+		c=fgetc(f);
+	}
+	return v;
+}
+
+static bool load_ppm(const char *filename, int &w, int &h, pixels &img)
+{
+	FILE	*f=fopen(filename, "rb");
+	int		maxval;
+
+	if (f==NULL)
+		return false;
+	if ((fgetc(f)!='P') || (fgetc(f)!='6'))
+	{
+		fclose(f);
+		return false;
+	}
+	w=ppm_token(f);
+	h=ppm_token(f);
+	maxval=ppm_token(f);
+	if ((w<=0) || (h<=0) || (w>65535) || (h>65535) || (maxval<=0) || (maxval>255))
+	{
+		fclose(f);
+		return false;
+	}
+	img.resize(long(w)*h);
+	for (long i=0; i<long(w)*h; i++)
+	{
+		int r=fgetc(f)*255/maxval, g=fgetc(f)*255/maxval, b=fgetc(f)*255/maxval;
+
+		img[i]=((r & 0xF8)<<8) | ((g & 0xFC)<<3) | (b>>3);
+	}
+	bool ok=!feof(f);
+	fclose(f);
+	return ok;
+}
+
+// Encodes one row of values as RLE packets. Values are written by put().
+template <class Put> static void rle_row(const unsigned short *row, int w, bytes &out, Put put)
+{
+	int x=0;
+
+	while (x<w)
+	{
+		int run=1;
+
+		while ((x+run<w) && (run<128) && (row[x+run]==row[x]))
+			run++;
+		if (run>=2)
+		{
+			out.push_back(0x80 | (run-1));
+			put(out, row[x]);
+			x+=run;
+		}
+		else
+		{
+			int n=1;
+
+			// Literals end where a run of at least two begins
+			while ((x+n<w) && (n<128) && !((x+n+1<w) && (row[x+n]==row[x+n+1])))
+				n++;
+			out.push_back(n-1);
+			for (int i=0; i<n; i++)
+				put(out, row[x+i]);
+			x+=n;
+		}
+	}
+}
+
+static void put565(bytes &out, unsigned short v)
+{
+	out.push_back(v>>8);
+	out.push_back(v & 0xFF);
+}
+
+static void put8(bytes &out, unsigned short v)
+{
+	out.push_back(v);
+}
+
+static bytes encode(int format, int w, int h, const pixels &img, const pixels &palette)
+{
+	bytes	out;
+	pixels	index(img.size());
+
+	out.push_back(format);
+	out.push_back(w & 0xFF);
+	out.push_back(w>>8);
+	out.push_back(h & 0xFF);
+	out.push_back(h>>8);
+	out.push_back(format==BITMAP_RLE565 ? 0 : palette.size()-1);
+	if (format!=BITMAP_RLE565)
+	{
+		for (size_t i=0; i<palette.size(); i++)
+			put565(out, palette[i]);
+		for (size_t i=0; i<img.size(); i++)
+			for (size_t c=0; c<palette.size(); c++)
+				if (palette[c]==img[i])
+					index[i]=c;
+	}
+
+	for (int y=0; y<h; y++)
+	{
+		if (format==BITMAP_RLE565)
+			rle_row(&img[long(y)*w], w, out, put565);
+		else if (format==BITMAP_PALRLE)
+			rle_row(&index[long(y)*w], w, out, put8);
+		else
+		{
+			int		bits=1<<(format-BITMAP_PAL1);
+			int		acc=0, used=0;
+
+			for (int x=0; x<w; x++)
+			{
+				acc=(acc<<bits) | index[(long(y)*w)+x];
+				used+=bits;
+				if (used==8)
+				{
+					out.push_back(acc);
+					acc=used=0;
+				}
+			}
+			if (used>0)
+				out.push_back(acc<<(8-used));
+		}
+	}
+	return out;
+}
+
+int main(int argc, char *argv[])
+{
+	const char	*mode="auto";
+	int			arg=1, w, h;
+	pixels		img, palette;
+	bytes		best;
+	int			best_format=0;
+
+	if ((argc==5) && (strcmp(argv[1], "-f")==0))
+	{
+		mode=argv[2];
+		arg=3;
+	}
+	if (argc-arg!=2)
+	{
+		fprintf(stderr, "Usage: %s [-f auto|rle565|pal|palrle] <image.ppm> <name>\n", argv[0]);
+		return 1;
+	}
+	if (!load_ppm(argv[arg], w, h, img))
+	{
+		fprintf(stderr, "Could not read binary PPM file %s\n", argv[arg]);
+		return 1;
+	}
+
+	for (size_t i=0; i<img.size() && palette.size()<=256; i++)
+	{
+		size_t c=0;
+
+		while ((c<palette.size()) && (palette[c]!=img[i]))
+			c++;
+		if (c==palette.size())
+			palette.push_back(img[i]);
+	}
+
+	for (int format=BITMAP_RLE565; format<=BITMAP_PALRLE; format++)
+	{
+		bool wanted;
+
+		if (format==BITMAP_RLE565)
+			wanted=!strcmp(mode, "auto") || !strcmp(mode, "rle565");
+		else if (format==BITMAP_PALRLE)
+			wanted=!strcmp(mode, "auto") || !strcmp(mode, "palrle");
+		else
+			wanted=!strcmp(mode, "auto") || !strcmp(mode, "pal");
+		if ((format!=BITMAP_RLE565) && (palette.size()>(format==BITMAP_PALRLE ? 256u : 1u<<(1<<(format-BITMAP_PAL1)))))
+			wanted=false;
+		if (wanted)
+		{
+			bytes out=encode(format, w, h, img, palette);
+
+			if ((best_format==0) || (out.size()<best.size()))
+			{
+				best=out;
+				best_format=format;
+			}
+		}
+	}
+	if (best_format==0)
+	{
+		fprintf(stderr, "The image has too many colors for format %s\n", mode);
+		return 1;
+	}
+
+	char		filename[256];
+	const char	*name=strrchr(argv[arg+1], '/');
+	FILE		*f;
+
+	name=(name==NULL) ? argv[arg+1] : name+1;
+
+	snprintf(filename, sizeof(filename), "%s.c", argv[arg+1]);
+	f=fopen(filename, "w");
+	if (f==NULL)
+	{
+		fprintf(stderr, "Could not create %s\n", filename);
+		return 1;
+	}
+	fprintf(f, "// Generated by  : PackedBitmapConverter\n");
+	fprintf(f, "// Generated from: %s\n", argv[arg]);
+	fprintf(f, "// Format        : %s (%dx%d, %d colors)\n", format_names[best_format], w, h, best_format==BITMAP_RLE565 ? 0 : int(palette.size()));
+	fprintf(f, "// Size          : %lu Bytes (%ld Bytes as RGB565)\n\n", (unsigned long)best.size(), long(w)*h*2);
+	fprintf(f, "#if defined(__AVR__)\n\t#include <avr/pgmspace.h>\n#elif !defined(PROGMEM)\n\t#define PROGMEM\n#endif\n\n");
+	fprintf(f, "const unsigned char %s[%lu] PROGMEM={\n", name, (unsigned long)best.size());
+	for (size_t i=0; i<best.size(); i++)
+		fprintf(f, "0x%02X%s%s", best[i], i+1<best.size() ? "," : "", ((i%16)==15) || (i+1==best.size()) ? "\n" : " ");
+	fprintf(f, "};\n");
+	fclose(f);
+	printf("%s: %s, %lu bytes (%ld bytes as RGB565)\n", filename, format_names[best_format], (unsigned long)best.size(), long(w)*h*2);
+	return 0;
+}
@@ -40,7 +40,9 @@
 #include "UTFT.h"
 
 // Include hardware-specific functions for the correct MCU
-#if defined(__AVR__)
+#if defined(UTFT_HOST)
+	#include "hardware/host/HW_Host.h"
+#elif defined(__AVR__)
 	#include <avr/pgmspace.h>
 	#include "hardware/avr/HW_AVR.h"
 	#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
@@ -85,7 +87,161 @@
 		#error "Unsupported ARM MCU!"
 	#endif
 #endif
-#include "memorysaver.h"
+// With UTFT_MODEL only the controller for that model is included. The 
+// host emulator is otherwise always built with support for all controllers
+#if defined(UTFT_MODEL)
+	#if (UTFT_MODEL!=CPLD)
+		#define DISABLE_CPLD			1
+	#endif
+	#if (UTFT_MODEL!=HX8340B_8)
+		#define DISABLE_HX8340B_8		1
+	#endif
+	#if (UTFT_MODEL!=HX8340B_S)
+		#define DISABLE_HX8340B_S		1
+	#endif
+	#if (UTFT_MODEL!=HX8347A)
+		#define DISABLE_HX8347A			1
+	#endif
+	#if (UTFT_MODEL!=HX8352A)
+		#define DISABLE_HX8352A			1
+	#endif
+	#if (UTFT_MODEL!=HX8353C)
+		#define DISABLE_HX8353C			1
+	#endif
+	#if (UTFT_MODEL!=ILI9325C)
+		#define DISABLE_ILI9325C		1
+	#endif
+	#if (UTFT_MODEL!=ILI9325D_8) && (UTFT_MODEL!=ILI9325D_16)
+		#define DISABLE_ILI9325D		1
+	#endif
+	#if (UTFT_MODEL!=ILI9325D_16ALT)
+		#define DISABLE_ILI9325D_ALT	1
+	#endif
+	#if (UTFT_MODEL!=ILI9327)
+		#define DISABLE_ILI9327			1
+	#endif
+	#if (UTFT_MODEL!=ILI9341_S4P)
+		#define DISABLE_ILI9341_S4P		1
+	#endif
+	#if (UTFT_MODEL!=ILI9341_S5P)
+		#define DISABLE_ILI9341_S5P		1
+	#endif
+	#if (UTFT_MODEL!=ILI9481)
+		#define DISABLE_ILI9481			1
+	#endif
+	#if (UTFT_MODEL!=ILI9486)
+		#define DISABLE_ILI9486			1
+	#endif
+	#if (UTFT_MODEL!=PCF8833)
+		#define DISABLE_PCF8833			1
+	#endif
+	#if (UTFT_MODEL!=R61581)
+		#define DISABLE_R61581			1
+	#endif
+	#if (UTFT_MODEL!=S1D19122)
+		#define DISABLE_S1D19122		1
+	#endif
+	#if (UTFT_MODEL!=S6D0164)
+		#define DISABLE_S6D0164			1
+	#endif
+	#if (UTFT_MODEL!=S6D1121_8) && (UTFT_MODEL!=S6D1121_16)
+		#define DISABLE_S6D1121			1
+	#endif
+	#if (UTFT_MODEL!=SSD1289) && (UTFT_MODEL!=SSD1289_8) && (UTFT_MODEL!=SSD1289LATCHED)
+		#define DISABLE_SSD1289			1
+	#endif
+	#if (UTFT_MODEL!=SSD1963_480)
+		#define DISABLE_SSD1963_480		1
+	#endif
+	#if (UTFT_MODEL!=SSD1963_800)
+		#define DISABLE_SSD1963_800		1
+	#endif
+	#if (UTFT_MODEL!=SSD1963_800ALT)
+		#define DISABLE_SSD1963_800_ALT	1
+	#endif
+	#if (UTFT_MODEL!=ST7735)
+		#define DISABLE_ST7735			1
+	#endif
+	#if (UTFT_MODEL!=ST7735_ALT)
+		#define DISABLE_ST7735_ALT		1
+	#endif
+	#if (UTFT_MODEL!=ST7735S)
+		#define DISABLE_ST7735S			1
+	#endif
+
+	const byte UTFT::display_model;
+	const byte UTFT::display_transfer_mode;
+	const byte UTFT::display_serial_mode;
+#elif !defined(UTFT_HOST)
+	#include "memorysaver.h"
+#endif
+
+#if defined(UTFT_PROFILE_CYCLES)
+	#define PROFILE_CLOCK()		UTFT_DWT_CYCCNT
+#elif defined(UTFT_PROFILE)
+	#define PROFILE_CLOCK()		micros()
+#endif
+
+// With UTFT_BUS_TRACE the public drawing functions are marked in the trace,
+// and with UTFT_PROFILE their cost is added to profile[]. Only the
+// outermost primitive is marked, so a fillRoundRect() is not also counted
+// as the drawHLine() calls it is made of.
+#if defined(UTFT_BUS_TRACE) || defined(UTFT_PROFILE)
+struct _prim_scope
+{
+	UTFT			*lcd;
+#if defined(UTFT_PROFILE)
+	byte			prim;
+	unsigned long	pixels, windows, start;
+#endif
+
+	_prim_scope(UTFT *display, byte p) : lcd(display)
+#if defined(UTFT_PROFILE)
+		, prim(0), pixels(0), windows(0), start(0)
+#endif
+	{
+		if (lcd->_prim_depth++==0)
+		{
+#if defined(UTFT_BUS_TRACE)
+			lcd->_trace_event(TRACE_BEGIN, p);
+#endif
+#if defined(UTFT_PROFILE)
+			prim=p;
+			pixels=lcd->_prof_pixels;
+			windows=lcd->_prof_windows;
+			start=PROFILE_CLOCK();
+#endif
+		}
+	}
+	~_prim_scope()
+	{
+		if (--lcd->_prim_depth==0)
+		{
+#if defined(UTFT_PROFILE)
+			_prim_stats	*st=&lcd->profile[prim];
+
+			st->time+=PROFILE_CLOCK()-start;
+			st->calls++;
+			st->pixels+=lcd->_prof_pixels-pixels;
+			st->windows+=lcd->_prof_windows-windows;
+#endif
+#if defined(UTFT_BUS_TRACE)
+			lcd->_trace_event(TRACE_END);
+#endif
+		}
+	}
+};
+	#define PRIMITIVE(prim)					_prim_scope _prim(this, prim)
+#else
+	#define PRIMITIVE(prim)
+#endif
+#if defined(UTFT_BUS_TRACE)
+	#define TRACE_FILL(tag, ch, cl, pix)	_trace_fill(tag, ch, cl, pix)
+#elif defined(UTFT_PROFILE)
+	#define TRACE_FILL(tag, ch, cl, pix)	_prof_pixels+=(pix)
+#else
+	#define TRACE_FILL(tag, ch, cl, pix)
+#endif
 
 UTFT::UTFT()
 {
@@ -95,12 +251,41 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 { 
 	word	dsx[] = {239, 239, 239, 239, 239, 239, 175, 175, 239, 127, 127, 239, 271, 479, 239, 239, 239, 0, 0, 239, 479, 319, 239, 175, 127, 239, 239, 319, 319, 799, 127, 127};
 	word	dsy[] = {319, 399, 319, 319, 319, 319, 219, 219, 399, 159, 127, 319, 479, 799, 319, 319, 319, 0, 0, 319, 799, 479, 319, 219, 159, 319, 319, 479, 479, 479, 159, 159};
+#if !defined(UTFT_MODEL)
 	byte	dtm[] = {16, 16, 16, 8, 8, 16, 8, SERIAL_4PIN, 16, SERIAL_5PIN, SERIAL_5PIN, 16, 16, 16, 8, 16, LATCHED_16, 0, 0, 8, 16, 16, 16, 8, SERIAL_5PIN, SERIAL_5PIN, SERIAL_4PIN, 16, 16, 16, SERIAL_5PIN, SERIAL_5PIN};
+#endif
 
+#if defined(UTFT_MODEL)
+	// The model argument is ignored
+	model =					UTFT_MODEL;
+#endif
 	disp_x_size =			dsx[model];
 	disp_y_size =			dsy[model];
+#if !defined(UTFT_MODEL)
 	display_transfer_mode =	dtm[model];
 	display_model =			model;
+#endif
+	_scroll_len =			0;
+#if defined(UTFT_AA_FONTS)
+	_aa_levels =			0;
+#endif
+	_dbuf =					false;
+	_win_valid =			false;
+	_te_pin =				NOTINUSE;
+	_clip =					false;
+	_key =					false;
+#if defined(UTFT_BUS_TRACE)
+	_trace_sink =			0;
+#endif
+#if defined(UTFT_BUS_TRACE) || defined(UTFT_PROFILE)
+	_prim_depth =			0;
+#endif
+#if defined(UTFT_HW_SPI)
+	_hw_spi =				false;
+#endif
+#if defined(UTFT_SPI_DMA)
+	_dma =					false;
+#endif
 
 	__p1 = RS;
 	__p2 = WR;
@@ -108,6 +293,7 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 	__p4 = RST;
 	__p5 = SER;
 
+#if !defined(UTFT_MODEL)
 	if (display_transfer_mode == SERIAL_4PIN)
 	{
 		display_transfer_mode=1;
@@ -118,6 +304,7 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 		display_transfer_mode=1;
 		display_serial_mode=SERIAL_5PIN;
 	}
+#endif
 
 	if (display_transfer_mode!=1)
 	{
@@ -157,11 +344,34 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 			P_RS	= portOutputRegister(digitalPinToPort(SER));
 			B_RS	= digitalPinToBitMask(SER);
 		}
+#if defined(UTFT_HW_SPI)
+		_hw_spi = _spi_pins(RS, WR);
+#endif
+#if defined(UTFT_SPI_DMA)
+		if ((_hw_spi) and (display_serial_mode==SERIAL_5PIN))
+		{
+			// The library only sets a copy of CS. The real pin is 
+			// driven by the DMA queue, see _dma_sync().
+			_dma		= true;
+			P_SPI_CS	= P_CS;
+			B_SPI_CS	= B_CS;
+			P_CS		= &_cs_shadow;
+			_cs_shadow	= B_CS;
+			_dma_len	= 0;
+			_dma_cur	= 0;
+		}
+#endif
 	}
 }
 
 void UTFT::LCD_Write_COM(char VL)  
 {   
+#if defined(UTFT_BUS_STATS)
+	bus_com++;
+#endif
+#if defined(UTFT_BUS_TRACE)
+	_trace_event(TRACE_COM, byte(VL));
+#endif
 	if (display_transfer_mode!=1)
 	{
 		cbi(P_RS, B_RS);
@@ -173,6 +383,15 @@ void UTFT::LCD_Write_COM(char VL)
 
 void UTFT::LCD_Write_DATA(char VH,char VL)
 {
+#if defined(UTFT_BUS_STATS)
+	bus_data+=2;
+#endif
+#if defined(UTFT_BUS_TRACE)
+	_trace_data(TRACE_DATA16, VH, VL);
+#endif
+#if defined(UTFT_PROFILE)
+	_prof_pixels++;
+#endif
 	if (display_transfer_mode!=1)
 	{
 		sbi(P_RS, B_RS);
@@ -187,6 +406,12 @@ void UTFT::LCD_Write_DATA(char VH,char VL)
 
 void UTFT::LCD_Write_DATA(char VL)
 {
+#if defined(UTFT_BUS_STATS)
+	bus_data++;
+#endif
+#if defined(UTFT_BUS_TRACE)
+	_trace_data(TRACE_DATA8, 0, VL);
+#endif
 	if (display_transfer_mode!=1)
 	{
 		sbi(P_RS, B_RS);
@@ -202,9 +427,125 @@ void UTFT::LCD_Write_COM_DATA(char com1,int dat1)
      LCD_Write_DATA(dat1>>8,dat1);
 }
 
+#if defined(UTFT_HW_SPI)
+// Sends one byte over the hardware SPI port. VH is 1 for data and 0 for
+// commands. With DMA, data bytes are only added to the current buffer.
+void UTFT::_spi_bus(char VH, char VL)
+{
+#if defined(UTFT_SPI_DMA)
+	if (_dma)
+	{
+		if (VH==1)
+		{
+			_dma_buf[_dma_cur][_dma_len++]=VL;
+			if (_dma_len==UTFT_DMA_BUFFER)
+				_dma_flush();
+			return;
+		}
+		_dma_sync();
+		cbi(P_SPI_CS, B_SPI_CS);
+	}
+#endif
+	if (display_serial_mode==SERIAL_5PIN)
+	{
+		if (VH==1)
+			sbi(P_RS, B_RS);
+		else
+			cbi(P_RS, B_RS);
+	}
+	_spi_write(VH, VL);
+}
+#endif
+
+#if defined(UTFT_SPI_DMA)
+// Starts sending the current buffer as soon as the previous one is done
+// and switches to the other buffer.
+void UTFT::_dma_flush()
+{
+	if (_dma_len==0)
+		return;
+	while (_dma_busy()) {};
+	sbi(P_RS, B_RS);
+	cbi(P_SPI_CS, B_SPI_CS);
+	_dma_start(_dma_buf[_dma_cur], _dma_len);
+	_dma_cur^=1;
+	_dma_len=0;
+}
+
+// Sends all queued data and waits until it is done. CS is released if the
+// library has released it in the meantime.
+void UTFT::_dma_sync()
+{
+	_dma_flush();
+	while (_dma_busy()) {};
+	if (_cs_shadow & B_SPI_CS)
+		sbi(P_SPI_CS, B_SPI_CS);
+}
+#endif
+
+// The controllers are set up from tables in flash, made of entries that
+// start with one byte:
+//   INIT_CMD(n)	0x00-0x3F	command followed by n data bytes
+//   INIT_DATA(n)	0x40-0x7F	n more data bytes
+//   INIT_CMD16(n)	0x80-0x9F	command followed by n data words
+//   INIT_REG(n)	0xA0-0xBF	n registers: number followed by a data word
+//   INIT_RAMP		0xFD		n data bytes: start, start+step, ...
+//   INIT_DELAY		0xFE		wait a number of milliseconds (0-255)
+//   INIT_END		0xFF
+// Words are written high byte first with INIT_WORD().
+#define INIT_CMD(n)			(n)
+#define INIT_DATA(n)		(0x40+(n))
+#define INIT_CMD16(n)		(0x80+(n))
+#define INIT_REG(n)			(0xA0+(n))
+#define INIT_RAMP(n, start, step)	0xFD, (n), (start), (step)
+#define INIT_DELAY(ms)		0xFE, (ms)
+#define INIT_END			0xFF
+#define INIT_WORD(w)		((w)>>8), ((w) & 0xFF)
+
+void UTFT::_init_table(const uint8_t *table)
+{
+	byte	op, n, v, step;
+
+	while ((op=pgm_read_byte(table++))!=0xFF)
+	{
+		if (op==0xFE)
+			delay(pgm_read_byte(table++));
+		else if (op==0xFD)
+		{
+			n=pgm_read_byte(table++);
+			v=pgm_read_byte(table++);
+			step=pgm_read_byte(table++);
+			for (; n>0; n--, v+=step)
+				LCD_Write_DATA(v);
+		}
+		else if (op>=0xA0)
+		{
+			for (n=op-0xA0; n>0; n--, table+=3)
+				LCD_Write_COM_DATA(pgm_read_byte(&table[0]), (pgm_read_byte(&table[1])<<8) | pgm_read_byte(&table[2]));
+		}
+		else if (op>=0x80)
+		{
+			LCD_Write_COM(pgm_read_byte(table++));
+			for (n=op-0x80; n>0; n--, table+=2)
+				LCD_Write_DATA(pgm_read_byte(&table[0]), pgm_read_byte(&table[1]));
+		}
+		else
+		{
+			if (op<0x40)
+				LCD_Write_COM(pgm_read_byte(table++));
+			for (n=op & 0x3F; n>0; n--)
+				LCD_Write_DATA(pgm_read_byte(table++));
+		}
+	}
+}
+
 void UTFT::InitLCD(byte orientation)
 {
 	orient=orientation;
+	_win_valid=false;
+#if defined(UTFT_BUS_TRACE)
+	_trace_event(TRACE_INIT, display_model | (orientation==LANDSCAPE ? 0x80 : 0));
+#endif
 	_hw_special_init();
 
 	pinMode(__p1,OUTPUT);
@@ -216,11 +557,16 @@ void UTFT::InitLCD(byte orientation)
 		pinMode(__p5,OUTPUT);
 	if (display_transfer_mode!=1)
 		_set_direction_registers(display_transfer_mode);
+#if defined(UTFT_HW_SPI)
+	if (_hw_spi)
+		_spi_begin();
+#endif
 
+	// The controllers need a reset pulse of at least 10 microseconds and
+	// are ready within 15 ms of its end
 	sbi(P_RST, B_RST);
-	delay(5); 
 	cbi(P_RST, B_RST);
-	delay(15);
+	delay(1);
 	sbi(P_RST, B_RST);
 	delay(15);
 
@@ -314,10 +660,48 @@ void UTFT::InitLCD(byte orientation)
 	setBackColor(0, 0, 0);
 	cfont.font=0;
 	_transparent = false;
+#if UTFT_GLYPH_CACHE>0
+	for (int i=0; i<UTFT_GLYPH_CACHE; i++)
+	{
+		_glyph_cache[i].font=0;
+		_glyph_cache[i].age=0;
+	}
+	_glyph_clock=0;
+#endif
+#if UTFT_NUM_DIFF>0
+	_num_diff_on=false;
+	_num_diff_next=0;
+	_clear_num_diff();
+#endif
+#if defined(UTFT_BUS_STATS)
+	resetBusStats();
+#endif
+#if defined(UTFT_PROFILE)
+	resetProfile();
+#endif
 }
 
+// Every drawing function sets its window through setXY(), so this is where
+// the areas drawn in a double buffered frame are recorded
 void UTFT::setXY(word x1, word y1, word x2, word y2)
 {
+#if UTFT_DIRTY_RECTS>0
+	if (_dbuf)
+		_mark_dirty(x1, y1, x2, y2);
+#endif
+	_set_window(x1, y1, x2, y2);
+}
+
+// The last window sent to the controller is kept. The drivers that can
+// do so only send the column or row addresses that have changed. The
+// profiler does not count the register data sent here as pixels.
+void UTFT::_set_window(word x1, word y1, word x2, word y2)
+{
+	boolean	cols, rows;
+#if defined(UTFT_PROFILE)
+	unsigned long	pixels=_prof_pixels;
+#endif
+
 	if (orient==LANDSCAPE)
 	{
 		swap(word, x1, y1);
@@ -327,6 +711,16 @@ void UTFT::setXY(word x1, word y1, word x2, word y2)
 		swap(word, y1, y2)
 	}
 
+	cols=(!_win_valid) or (x1!=_win_x1) or (x2!=_win_x2);
+	rows=(!_win_valid) or (y1!=_win_y1) or (y2!=_win_y2);
+	(void)cols;		// Unused by the drivers without address caching
+	(void)rows;
+	_win_x1=x1;
+	_win_y1=y1;
+	_win_x2=x2;
+	_win_y2=y2;
+	_win_valid=true;
+
 	switch(display_model)
 	{
 #ifndef DISABLE_HX8347A
@@ -408,18 +802,27 @@ void UTFT::setXY(word x1, word y1, word x2, word y2)
 	#include "tft_drivers/hx8353c/setxy.h"
 #endif
 	}
+#if defined(UTFT_PROFILE)
+	_prof_pixels=pixels;
+	_prof_windows++;
+#endif
 }
 
+// The drawing functions leave the window where they last drew, so this is
+// only needed before writing pixels without setXY(), as clrScr() and
+// fillScr() do. It sends little more than the memory write command when
+// the window already covers the whole screen.
 void UTFT::clrXY()
 {
 	if (orient==PORTRAIT)
-		setXY(0,0,disp_x_size,disp_y_size);
+		_set_window(0,0,disp_x_size,disp_y_size);
 	else
-		setXY(0,0,disp_y_size,disp_x_size);
+		_set_window(0,0,disp_y_size,disp_x_size);
 }
 
 void UTFT::drawRect(int x1, int y1, int x2, int y2)
 {
+	PRIMITIVE(PRIM_DRAWRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -437,6 +840,7 @@ void UTFT::drawRect(int x1, int y1, int x2, int y2)
 
 void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
 {
+	PRIMITIVE(PRIM_DRAWROUNDRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -460,6 +864,7 @@ void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
 
 void UTFT::fillRect(int x1, int y1, int x2, int y2)
 {
+	PRIMITIVE(PRIM_FILLRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -473,6 +878,7 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2)
 		cbi(P_CS, B_CS);
 		setXY(x1, y1, x2, y2);
 		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL16, fch, fcl, ((long(x2-x1)+1)*(long(y2-y1)+1)));
 		_fast_fill_16(fch,fcl,((long(x2-x1)+1)*(long(y2-y1)+1)));
 		sbi(P_CS, B_CS);
 	}
@@ -481,32 +887,22 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2)
 		cbi(P_CS, B_CS);
 		setXY(x1, y1, x2, y2);
 		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL8, fch, fch, ((long(x2-x1)+1)*(long(y2-y1)+1)));
 		_fast_fill_8(fch,((long(x2-x1)+1)*(long(y2-y1)+1)));
 		sbi(P_CS, B_CS);
 	}
 	else
 	{
-		if (orient==PORTRAIT)
-		{
-			for (int i=0; i<((y2-y1)/2)+1; i++)
-			{
-				drawHLine(x1, y1+i, x2-x1);
-				drawHLine(x1, y2-i, x2-x1);
-			}
-		}
-		else
-		{
-			for (int i=0; i<((x2-x1)/2)+1; i++)
-			{
-				drawVLine(x1+i, y1, y2-y1);
-				drawVLine(x2-i, y1, y2-y1);
-			}
-		}
+		// Serial modules send the whole rectangle in one window
+		cbi(P_CS, B_CS);
+		_fill_run(x1, y1, x2, y2);
+		sbi(P_CS, B_CS);
 	}
 }
 
 void UTFT::fillRoundRect(int x1, int y1, int x2, int y2)
 {
+	PRIMITIVE(PRIM_FILLROUNDRECT);
 	if (x1>x2)
 	{
 		swap(int, x1, x2);
@@ -518,23 +914,13 @@ void UTFT::fillRoundRect(int x1, int y1, int x2, int y2)
 
 	if ((x2-x1)>4 && (y2-y1)>4)
 	{
-		for (int i=0; i<((y2-y1)/2)+1; i++)
-		{
-			switch(i)
-			{
-			case 0:
-				drawHLine(x1+2, y1+i, x2-x1-4);
-				drawHLine(x1+2, y2-i, x2-x1-4);
-				break;
-			case 1:
-				drawHLine(x1+1, y1+i, x2-x1-2);
-				drawHLine(x1+1, y2-i, x2-x1-2);
-				break;
-			default:
-				drawHLine(x1, y1+i, x2-x1);
-				drawHLine(x1, y2-i, x2-x1);
-			}
-		}
+		cbi(P_CS, B_CS);
+		_fill_run(x1+2, y1, x2-2, y1);
+		_fill_run(x1+1, y1+1, x2-1, y1+1);
+		_fill_run(x1, y1+2, x2, y2-2);
+		_fill_run(x1+1, y2-1, x2-1, y2-1);
+		_fill_run(x1+2, y2, x2-2, y2);
+		sbi(P_CS, B_CS);
 	}
 }
 
@@ -545,21 +931,18 @@ void UTFT::drawCircle(int x, int y, int radius)
 	int ddF_y = -2 * radius;
 	int x1 = 0;
 	int y1 = radius;
+	int xs = 0;
  
+	PRIMITIVE(PRIM_DRAWCIRCLE);
+	// Pixels with the same y1 are sent as one horizontal run in the top 
+	// and bottom octants and as one vertical run in the side octants.
 	cbi(P_CS, B_CS);
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA(fch,fcl);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA(fch,fcl);
-	setXY(x + radius, y, x + radius, y);
-	LCD_Write_DATA(fch,fcl);
-	setXY(x - radius, y, x - radius, y);
-	LCD_Write_DATA(fch,fcl);
- 
 	while(x1 < y1)
 	{
 		if(f >= 0) 
 		{
+			_circle_runs(x, y, xs, x1, y1);
+			xs = x1 + 1;
 			y1--;
 			ddF_y += 2;
 			f += ddF_y;
@@ -567,162 +950,468 @@ void UTFT::drawCircle(int x, int y, int radius)
 		x1++;
 		ddF_x += 2;
 		f += ddF_x;    
-		setXY(x + x1, y + y1, x + x1, y + y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - x1, y + y1, x - x1, y + y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x + x1, y - y1, x + x1, y - y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - x1, y - y1, x - x1, y - y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x + y1, y + x1, x + y1, y + x1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - y1, y + x1, x - y1, y + x1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x + y1, y - x1, x + y1, y - x1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - y1, y - x1, x - y1, y - x1);
-		LCD_Write_DATA(fch,fcl);
 	}
+	_circle_runs(x, y, xs, x1, y1);
 	sbi(P_CS, B_CS);
-	clrXY();
+}
+
+void UTFT::_circle_runs(int x, int y, int xs, int xe, int yy)
+{
+	int xm = (xs == 0) ? 1 : xs;
+
+	_fill_run(x + xs, y + yy, x + xe, y + yy);
+	_fill_run(x + xs, y - yy, x + xe, y - yy);
+	_fill_run(x + yy, y + xs, x + yy, y + xe);
+	_fill_run(x - yy, y + xs, x - yy, y + xe);
+	if (xe >= xm)
+	{
+		_fill_run(x - xe, y + yy, x - xm, y + yy);
+		_fill_run(x - xe, y - yy, x - xm, y - yy);
+		_fill_run(x + yy, y - xe, x + yy, y - xm);
+		_fill_run(x - yy, y - xe, x - yy, y - xm);
+	}
 }
 
 void UTFT::fillCircle(int x, int y, int radius)
 {
-	for(int y1=-radius; y1<=0; y1++) 
-		for(int x1=-radius; x1<=0; x1++)
-			if(x1*x1+y1*y1 <= radius*radius) 
-			{
-				drawHLine(x+x1, y+y1, 2*(-x1));
-				drawHLine(x+x1, y-y1, 2*(-x1));
-				break;
-			}
+	PRIMITIVE(PRIM_FILLCIRCLE);
+	fillEllipse(x, y, radius, radius);
 }
 
-void UTFT::clrScr()
+void UTFT::fillEllipse(int x, int y, int rx, int ry)
 {
-	long i;
-	
+	long	a=long(rx)*rx, b=long(ry)*ry;
+	long	e=0;
+	int		w=rx, nw, d0=0;
+
+	PRIMITIVE(PRIM_FILLELLIPSE);
+	// w is the half width of row dy, the largest value where 
+	// w*w*b + dy*dy*a <= a*b. e holds the difference, so both can be
+	// updated with additions only. Rows of the same width are filled as
+	// one rectangle.
 	cbi(P_CS, B_CS);
-	clrXY();
-	if (display_transfer_mode!=1)
-		sbi(P_RS, B_RS);
-	if (display_transfer_mode==16)
-		_fast_fill_16(0,0,((disp_x_size+1)*(disp_y_size+1)));
-	else if (display_transfer_mode==8)
-		_fast_fill_8(0,((disp_x_size+1)*(disp_y_size+1)));
-	else
+	for (int dy=1; dy<=ry+1; dy++)
 	{
-		for (i=0; i<((disp_x_size+1)*(disp_y_size+1)); i++)
+		nw=w;
+		if (dy<=ry)
+		{
+			e-=((2*long(dy))-1)*a;
+			while ((e<0) and (nw>0))
+			{
+				e+=((2*long(nw))-1)*b;
+				nw--;
+			}
+		}
+		if ((dy>ry) or (nw!=w))
 		{
-			if (display_transfer_mode!=1)
-				LCD_Writ_Bus(0,0,display_transfer_mode);
+			if (d0==0)
+				_fill_run(x-w, y-(dy-1), x+w, y+(dy-1));
 			else
 			{
-				LCD_Writ_Bus(1,0,display_transfer_mode);
-				LCD_Writ_Bus(1,0,display_transfer_mode);
+				_fill_run(x-w, y-(dy-1), x+w, y-d0);
+				_fill_run(x-w, y+d0, x+w, y+(dy-1));
 			}
+			d0=dy;
+			w=nw;
 		}
 	}
 	sbi(P_CS, B_CS);
 }
 
-void UTFT::fillScr(byte r, byte g, byte b)
+void UTFT::drawArc(int x, int y, int radius, int startAngle, int endAngle)
 {
-	word color = ((r&248)<<8 | (g&252)<<3 | (b&248)>>3);
-	fillScr(color);
+	PRIMITIVE(PRIM_DRAWARC);
+	fillArc(x, y, radius, radius-1, startAngle, endAngle);
 }
 
-void UTFT::fillScr(word color)
+// Fills the pixels between innerRadius (exclusive) and outerRadius from 
+// startAngle to endAngle. Angles are in degrees, 0 is to the right and
+// they increase clockwise. An innerRadius of 0 fills a pie slice.
+void UTFT::fillArc(int x, int y, int outerRadius, int innerRadius, int startAngle, int endAngle)
 {
-	long i;
-	char ch, cl;
-	
-	ch=byte(color>>8);
-	cl=byte(color & 0xFF);
+	long	ax, ay, bx, by;
+	long	oe=0, ie=0;
+	int		ow=outerRadius, iw=innerRadius;
+	int		sweep=endAngle-startAngle;
+	byte	mode;
+
+	PRIMITIVE(PRIM_FILLARC);
+	if ((sweep>=360) or (sweep<=-360))
+		mode=0;
+	else
+	{
+		sweep=((sweep%360)+360)%360;
+		if (sweep==0)
+			return;
+		mode=(sweep<=180) ? 1 : 2;
+	}
+	ax=_sin_deg(startAngle+90);
+	ay=_sin_deg(startAngle);
+	bx=_sin_deg(endAngle+90);
+	by=_sin_deg(endAngle);
 
 	cbi(P_CS, B_CS);
-	clrXY();
-	if (display_transfer_mode!=1)
-		sbi(P_RS, B_RS);
-	if (display_transfer_mode==16)
-		_fast_fill_16(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
-	else if ((display_transfer_mode==8) and (ch==cl))
-		_fast_fill_8(ch,((disp_x_size+1)*(disp_y_size+1)));
-	else
+	for (int dy=0; dy<=outerRadius; dy++)
 	{
-		for (i=0; i<((disp_x_size+1)*(disp_y_size+1)); i++)
+		if (dy>0)
 		{
-			if (display_transfer_mode!=1)
-				LCD_Writ_Bus(ch,cl,display_transfer_mode);
-			else
+			oe-=(2*long(dy))-1;
+			while ((oe<0) and (ow>0))
+			{
+				oe+=(2*long(ow))-1;
+				ow--;
+			}
+			if (dy<=innerRadius)
+			{
+				ie-=(2*long(dy))-1;
+				while ((ie<0) and (iw>0))
+				{
+					ie+=(2*long(iw))-1;
+					iw--;
+				}
+			}
+		}
+		for (int side=0; side<((dy==0) ? 1 : 2); side++)
+		{
+			int yy=(side==0) ? dy : -dy;
+
+			if ((innerRadius>0) and (dy<=innerRadius))
 			{
-				LCD_Writ_Bus(1,ch,display_transfer_mode);
-				LCD_Writ_Bus(1,cl,display_transfer_mode);
+				_arc_span(x, y, -ow, -iw-1, yy, ax, ay, bx, by, mode);
+				_arc_span(x, y, iw+1, ow, yy, ax, ay, bx, by, mode);
 			}
+			else
+				_arc_span(x, y, -ow, ow, yy, ax, ay, bx, by, mode);
 		}
 	}
 	sbi(P_CS, B_CS);
 }
 
-void UTFT::setColor(byte r, byte g, byte b)
+static long _floor_div(long n, long d)
 {
-	fch=((r&248)|g>>5);
-	fcl=((g&28)<<3|b>>3);
+	long q=n/d;
+
+	if (((n%d)!=0) and ((n<0)!=(d<0)))
+		q--;
+	return q;
 }
 
-void UTFT::setColor(word color)
+// Fills the part of row dy from l to r (relative to the center) that is
+// inside the sector from (ax,ay) to (bx,by). In each row the two sector
+// edges are half-lines, so mode 1 (up to 180 degrees) fills where both 
+// apply and mode 2 where either applies. Mode 0 fills the whole span.
+void UTFT::_arc_span(int x, int y, int l, int r, int dy, long ax, long ay, long bx, long by, byte mode)
 {
-	fch=byte(color>>8);
-	fcl=byte(color & 0xFF);
+	int		l1=l, r1=r, l2=l, r2=r;
+
+	if (l>r)
+		return;
+	if (mode!=0)
+	{
+		// Clockwise of the start edge: ay*px <= ax*dy
+		if (ay>0)
+			r1=min(long(r1), _floor_div(ax*dy, ay));
+		else if (ay<0)
+			l1=max(long(l1), -_floor_div(-ax*dy, ay));
+		else if (ax*dy<0)
+			r1=l1-1;
+		// Counterclockwise of the end edge: by*px >= bx*dy
+		if (by>0)
+			l2=max(long(l2), -_floor_div(-bx*dy, by));
+		else if (by<0)
+			r2=min(long(r2), _floor_div(bx*dy, by));
+		else if (bx*dy>0)
+			r2=l2-1;
+	}
+	if (mode==0)
+		_fill_run(x+l, y+dy, x+r, y+dy);
+	else if (mode==1)
+	{
+		l1=max(l1, l2);
+		r1=min(r1, r2);
+		if (l1<=r1)
+			_fill_run(x+l1, y+dy, x+r1, y+dy);
+	}
+	else
+	{
+		if (l1<=r1)
+		{
+			_fill_run(x+l1, y+dy, x+r1, y+dy);
+			if ((l2<=r2) and (l2<l1))
+				_fill_run(x+l2, y+dy, x+min(r2, l1-1), y+dy);
+			if ((l2<=r2) and (r2>r1))
+				_fill_run(x+max(l2, r1+1), y+dy, x+r2, y+dy);
+		}
+		else if (l2<=r2)
+			_fill_run(x+l2, y+dy, x+r2, y+dy);
+	}
 }
 
-word UTFT::getColor()
+// *** Polygons ***
+// An edge of a polygon in the edge table. x is where the edge crosses the
+// current row, in 1/(1<<frac) pixels, plus the fraction e/dy. Each row
+// adds q+(r/dy) to it.
+struct _poly_edge
 {
-	return (fch<<8) | fcl;
-}
+	int		top, bottom;	// First row and the row after the last one
+	long	x, q;
+	int		e, r, dy;
+};
 
-void UTFT::setBackColor(byte r, byte g, byte b)
+void UTFT::fillTriangle(int x1, int y1, int x2, int y2, int x3, int y3)
 {
-	bch=((r&248)|g>>5);
-	bcl=((g&28)<<3|b>>3);
-	_transparent=false;
+	int px[3]={x1, x2, x3}, py[3]={y1, y2, y3};
+
+	PRIMITIVE(PRIM_FILLTRIANGLE);
+	fillPolygon(px, py, 3);
 }
 
-void UTFT::setBackColor(uint32_t color)
+// Fills a polygon with the even-odd rule, so concave and self-crossing
+// polygons can be drawn. The points have frac fraction bits, so with
+// frac=4 the coordinates are in 1/16 pixels. A pixel is filled when its
+// center is inside the polygon or on its edges, which gives the same
+// pixels as fillRect() for a rectangle. The rows are filled from an edge
+// table, with the crossings of each edge found by stepping in fixed
+// point, and every span is sent as one run. Only the part inside the
+// screen is sent. Returns false, and draws nothing, when n is less than
+// 1 or more than UTFT_POLY_POINTS.
+boolean UTFT::fillPolygon(const int *x, const int *y, int n, byte frac)
 {
-	if (color==VGA_TRANSPARENT)
-		_transparent=true;
-	else
+	_poly_edge	edges[UTFT_POLY_POINTS];
+	byte		active[UTFT_POLY_POINTS];
+	long		one=1L<<frac;
+	int			ne=0, na=0, next=0, row=0, i, j;
+
+	PRIMITIVE(PRIM_FILLPOLYGON);
+	if ((n<1) or (n>UTFT_POLY_POINTS))
+		return false;
+
+	cbi(P_CS, B_CS);
+	for (i=0; i<n; i++)
 	{
-		bch=byte(color>>8);
-		bcl=byte(color & 0xFF);
-		_transparent=false;
+		long	xa=x[i], ya=y[i], xb=x[(i+1)%n], yb=y[(i+1)%n];
+		long	yp=y[(i+n-1)%n];
+
+		// The rows only reach the bottom of an edge from above, so the
+		// horizontal edges and the lowest points are filled here
+		if ((ya==yb) and ((ya & (one-1))==0))
+			_clip_run(-_floor_div(-min(xa, xb), one), _floor_div(max(xa, xb), one), _floor_div(ya, one));
+		else if ((yp<ya) and (yb<ya) and (((xa | ya) & (one-1))==0))
+			_clip_run(_floor_div(xa, one), _floor_div(xa, one), _floor_div(ya, one));
+		if (ya==yb)
+			continue;
+		if (ya>yb)
+		{
+			swap(long, xa, xb);
+			swap(long, ya, yb);
+		}
+
+		_poly_edge	*ed=&edges[ne];
+		long		num;
+
+		ed->top=-_floor_div(-ya, one);
+		ed->bottom=-_floor_div(-yb, one);
+		if (ed->top>=ed->bottom)
+			continue;
+		ed->dy=yb-ya;
+		num=((long(ed->top)*one)-ya)*(xb-xa);
+		ed->x=xa+_floor_div(num, ed->dy);
+		ed->e=num-((ed->x-xa)*ed->dy);
+		ed->q=_floor_div(one*(xb-xa), ed->dy);
+		ed->r=(one*(xb-xa))-(ed->q*ed->dy);
+		// Insertion sort on the first row
+		for (j=ne; (j>0) and (edges[j-1].top>edges[j].top); j--)
+		{
+			swap(_poly_edge, edges[j], edges[j-1]);
+		}
+		ne++;
+	}
+
+	while ((next<ne) or (na>0))
+	{
+		row=(na==0) ? edges[next].top : row+1;
+		while ((next<ne) and (edges[next].top==row))
+			active[na++]=next++;
+		// Drop the edges that have ended and sort the rest by x
+		for (i=0, j=0; i<na; i++)
+			if (edges[active[i]].bottom>row)
+				active[j++]=active[i];
+		na=j;
+		for (i=1; i<na; i++)
+			for (j=i; j>0; j--)
+			{
+				_poly_edge	*a=&edges[active[j-1]], *b=&edges[active[j]];
+
+				if ((a->x<b->x) or ((a->x==b->x) and (long(a->e)*b->dy<=long(b->e)*a->dy)))
+					break;
+				swap(byte, active[j], active[j-1]);
+			}
+		for (i=0; i+1<na; i+=2)
+		{
+			_poly_edge	*a=&edges[active[i]], *b=&edges[active[i+1]];
+			int			l=_floor_div(a->x, one)+(((a->e>0) or ((a->x & (one-1))!=0)) ? 1 : 0);
+			int			r=_floor_div(b->x, one);
+
+			_clip_run(l, r, row);
+		}
+		for (i=0; i<na; i++)
+		{
+			_poly_edge	*ed=&edges[active[i]];
+
+			ed->x+=ed->q;
+			ed->e+=ed->r;
+			if (ed->e>=ed->dy)
+			{
+				ed->x++;
+				ed->e-=ed->dy;
+			}
+		}
 	}
+	sbi(P_CS, B_CS);
+	return true;
 }
 
-word UTFT::getBackColor()
+// Fills the part of row y from x1 to x2 that is inside the screen
+void UTFT::_clip_run(int x1, int x2, int y)
 {
-	return (bch<<8) | bcl;
+	x1=max(x1, 0);
+	x2=min(x2, getDisplayXSize()-1);
+	if ((x1<=x2) and (y>=0) and (y<getDisplayYSize()))
+		_fill_run(x1, y, x2, y);
 }
 
-void UTFT::setPixel(word color)
+void UTFT::drawPolyline(const int *x, const int *y, int n, boolean closed)
 {
-	LCD_Write_DATA((color>>8),(color&0xFF));	// rrrrrggggggbbbbb
+	PRIMITIVE(PRIM_DRAWPOLYLINE);
+	for (int i=1; i<n; i++)
+		drawLine(x[i-1], y[i-1], x[i], y[i]);
+	if (closed and (n>2))
+		drawLine(x[n-1], y[n-1], x[0], y[0]);
 }
 
-void UTFT::drawPixel(int x, int y)
+void UTFT::clrScr()
 {
+	PRIMITIVE(PRIM_CLRSCR);
+	_clear_num_diff();
+#if UTFT_DIRTY_RECTS>0
+	if (_dbuf)
+		_mark_dirty(0, 0, (orient==PORTRAIT) ? disp_x_size : disp_y_size, (orient==PORTRAIT) ? disp_y_size : disp_x_size);
+#endif
 	cbi(P_CS, B_CS);
-	setXY(x, y, x, y);
-	setPixel((fch<<8)|fcl);
+	clrXY();
+	if (display_transfer_mode!=1)
+		sbi(P_RS, B_RS);
+	if (display_transfer_mode==16)
+	{
+		TRACE_FILL(TRACE_FILL16, 0, 0, ((disp_x_size+1)*(disp_y_size+1)));
+		_fast_fill_16(0,0,((disp_x_size+1)*(disp_y_size+1)));
+	}
+	else if (display_transfer_mode==8)
+	{
+		TRACE_FILL(TRACE_FILL8, 0, 0, ((disp_x_size+1)*(disp_y_size+1)));
+		_fast_fill_8(0,((disp_x_size+1)*(disp_y_size+1)));
+	}
+	else
+		_write_pixels(0, 0, (disp_x_size+1)*(disp_y_size+1));
 	sbi(P_CS, B_CS);
+}
+
+void UTFT::fillScr(byte r, byte g, byte b)
+{
+	word color = ((r&248)<<8 | (g&252)<<3 | (b&248)>>3);
+	fillScr(color);
+}
+
+void UTFT::fillScr(word color)
+{
+	char ch, cl;
+	
+	PRIMITIVE(PRIM_FILLSCR);
+	ch=byte(color>>8);
+	cl=byte(color & 0xFF);
+
+	_clear_num_diff();
+#if UTFT_DIRTY_RECTS>0
+	if (_dbuf)
+		_mark_dirty(0, 0, (orient==PORTRAIT) ? disp_x_size : disp_y_size, (orient==PORTRAIT) ? disp_y_size : disp_x_size);
+#endif
+	cbi(P_CS, B_CS);
 	clrXY();
+	if (display_transfer_mode!=1)
+		sbi(P_RS, B_RS);
+	if (display_transfer_mode==16)
+	{
+		TRACE_FILL(TRACE_FILL16, ch, cl, ((disp_x_size+1)*(disp_y_size+1)));
+		_fast_fill_16(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
+	}
+	else if ((display_transfer_mode==8) and (ch==cl))
+	{
+		TRACE_FILL(TRACE_FILL8, ch, ch, ((disp_x_size+1)*(disp_y_size+1)));
+		_fast_fill_8(ch,((disp_x_size+1)*(disp_y_size+1)));
+	}
+	else
+		_write_pixels(ch, cl, (disp_x_size+1)*(disp_y_size+1));
+	sbi(P_CS, B_CS);
+}
+
+void UTFT::setColor(byte r, byte g, byte b)
+{
+	fch=((r&248)|g>>5);
+	fcl=((g&28)<<3|b>>3);
+}
+
+void UTFT::setColor(word color)
+{
+	fch=byte(color>>8);
+	fcl=byte(color & 0xFF);
+}
+
+word UTFT::getColor()
+{
+	return (fch<<8) | fcl;
+}
+
+void UTFT::setBackColor(byte r, byte g, byte b)
+{
+	bch=((r&248)|g>>5);
+	bcl=((g&28)<<3|b>>3);
+	_transparent=false;
+}
+
+void UTFT::setBackColor(uint32_t color)
+{
+	if (color==VGA_TRANSPARENT)
+		_transparent=true;
+	else
+	{
+		bch=byte(color>>8);
+		bcl=byte(color & 0xFF);
+		_transparent=false;
+	}
+}
+
+word UTFT::getBackColor()
+{
+	return (bch<<8) | bcl;
+}
+
+void UTFT::setPixel(word color)
+{
+	LCD_Write_DATA((color>>8),(color&0xFF));	// rrrrrggggggbbbbb
+}
+
+void UTFT::drawPixel(int x, int y)
+{
+	PRIMITIVE(PRIM_DRAWPIXEL);
+	cbi(P_CS, B_CS);
+	setXY(x, y, x, y);
+	setPixel((fch<<8)|fcl);
+	sbi(P_CS, B_CS);
 }
 
 void UTFT::drawLine(int x1, int y1, int x2, int y2)
 {
+	PRIMITIVE(PRIM_DRAWLINE);
 	if (y1==y2)
 		drawHLine(x1, y1, x2-x1);
 	else if (x1==x2)
@@ -734,47 +1423,90 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 		unsigned int	dy = (y2 > y1 ? y2 - y1 : y1 - y2);
 		short			ystep =  y2 > y1 ? 1 : -1;
 		int				col = x1, row = y1;
+		int				start;
 
+		// Pixels that share a column (steep lines) or a row (shallow lines)
+		// are collected into a single run and sent with one window.
 		cbi(P_CS, B_CS);
 		if (dx < dy)
 		{
 			int t = - (dy >> 1);
+			start = row;
 			while (true)
 			{
-				setXY (col, row, col, row);
-				LCD_Write_DATA (fch, fcl);
 				if (row == y2)
-					return;
-				row += ystep;
+				{
+					_fill_run(col, start, col, row);
+					break;
+				}
 				t += dx;
 				if (t >= 0)
 				{
+					_fill_run(col, start, col, row);
 					col += xstep;
 					t   -= dy;
+					start = row + ystep;
 				}
+				row += ystep;
 			} 
 		}
 		else
 		{
 			int t = - (dx >> 1);
+			start = col;
 			while (true)
 			{
-				setXY (col, row, col, row);
-				LCD_Write_DATA (fch, fcl);
 				if (col == x2)
-					return;
-				col += xstep;
+				{
+					_fill_run(start, row, col, row);
+					break;
+				}
 				t += dy;
 				if (t >= 0)
 				{
+					_fill_run(start, row, col, row);
 					row += ystep;
 					t   -= dx;
+					start = col + xstep;
 				}
+				col += xstep;
 			} 
 		}
 		sbi(P_CS, B_CS);
 	}
-	clrXY();
+}
+
+void UTFT::_fill_run(int x1, int y1, int x2, int y2)
+{
+	long pix;
+
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+	pix=(long(x2-x1)+1)*(long(y2-y1)+1);
+
+	setXY(x1, y1, x2, y2);
+	if (pix==1)
+		LCD_Write_DATA(fch, fcl);
+	else if (display_transfer_mode==16)
+	{
+		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL16, fch, fcl, pix);
+		_fast_fill_16(fch,fcl,pix);
+	}
+	else if ((display_transfer_mode==8) and (fch==fcl))
+	{
+		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL8, fch, fch, pix);
+		_fast_fill_8(fch,pix);
+	}
+	else
+		_write_pixels(fch, fcl, pix);
 }
 
 void UTFT::drawHLine(int x, int y, int l)
@@ -789,11 +1521,13 @@ void UTFT::drawHLine(int x, int y, int l)
 	if (display_transfer_mode == 16)
 	{
 		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL16, fch, fcl, l);
 		_fast_fill_16(fch,fcl,l);
 	}
 	else if ((display_transfer_mode==8) and (fch==fcl))
 	{
 		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL8, fch, fch, l);
 		_fast_fill_8(fch,l);
 	}
 	else
@@ -804,7 +1538,6 @@ void UTFT::drawHLine(int x, int y, int l)
 		}
 	}
 	sbi(P_CS, B_CS);
-	clrXY();
 }
 
 void UTFT::drawVLine(int x, int y, int l)
@@ -819,11 +1552,13 @@ void UTFT::drawVLine(int x, int y, int l)
 	if (display_transfer_mode == 16)
 	{
 		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL16, fch, fcl, l);
 		_fast_fill_16(fch,fcl,l);
 	}
 	else if ((display_transfer_mode==8) and (fch==fcl))
 	{
 		sbi(P_RS, B_RS);
+		TRACE_FILL(TRACE_FILL8, fch, fch, l);
 		_fast_fill_8(fch,l);
 	}
 	else
@@ -834,397 +1569,1539 @@ void UTFT::drawVLine(int x, int y, int l)
 		}
 	}
 	sbi(P_CS, B_CS);
-	clrXY();
 }
 
 void UTFT::printChar(byte c, int x, int y)
 {
-	byte i,ch;
-	word j;
+	byte j;
 	word temp; 
+	int bpr=cfont.x_size/8;
+
+	if (cfont.bpp!=0)
+	{
+		char st[2] = {char(c), 0};
+
+		_print_prop(st, x, y);
+		return;
+	}
 
 	cbi(P_CS, B_CS);
   
+	temp=((c-cfont.offset)*(bpr*cfont.y_size))+4;
 	if (!_transparent)
 	{
-		if (orient==PORTRAIT)
-		{
-			setXY(x,y,x+cfont.x_size-1,y+cfont.y_size-1);
-	  
-			temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-			for(j=0;j<((cfont.x_size/8)*cfont.y_size);j++)
-			{
-				ch=pgm_read_byte(&cfont.font[temp]);
-				for(i=0;i<8;i++)
-				{   
-					if((ch&(1<<(7-i)))!=0)   
-					{
-						setPixel((fch<<8)|fcl);
-					} 
-					else
-					{
-						setPixel((bch<<8)|bcl);
-					}   
-				}
-				temp++;
-			}
-		}
-		else
+#if UTFT_GLYPH_CACHE>0
+		if ((cfont.x_size*cfont.y_size)<=UTFT_GLYPH_CACHE_PIXELS)
 		{
-			temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
+			_glyph_cache_entry *e=_glyph_lookup(c, temp);
 
-			for(j=0;j<((cfont.x_size/8)*cfont.y_size);j+=(cfont.x_size/8))
+			if (orient==PORTRAIT)
 			{
-				setXY(x,y+(j/(cfont.x_size/8)),x+cfont.x_size-1,y+(j/(cfont.x_size/8)));
-				for (int zz=(cfont.x_size/8)-1; zz>=0; zz--)
+				setXY(x,y,x+cfont.x_size-1,y+cfont.y_size-1);
+				_write_words(e->pixels, cfont.x_size*cfont.y_size);
+			}
+			else
+				for(j=0;j<cfont.y_size;j++)
 				{
-					ch=pgm_read_byte(&cfont.font[temp+zz]);
-					for(i=0;i<8;i++)
-					{   
-						if((ch&(1<<i))!=0)   
-						{
-							setPixel((fch<<8)|fcl);
-						} 
-						else
-						{
-							setPixel((bch<<8)|bcl);
-						}   
-					}
+					setXY(x,y+j,x+cfont.x_size-1,y+j);
+					_write_words(&e->pixels[j*cfont.x_size], cfont.x_size);
 				}
-				temp+=(cfont.x_size/8);
-			}
+			sbi(P_CS, B_CS);
+			return;
+		}
+#endif
+		if (orient==PORTRAIT)
+			setXY(x,y,x+cfont.x_size-1,y+cfont.y_size-1);
+		for(j=0;j<cfont.y_size;j++)
+		{
+			if (orient!=PORTRAIT)
+				setXY(x,y+j,x+cfont.x_size-1,y+j);
+			_glyph_row(temp, orient!=PORTRAIT);
+			temp+=bpr;
 		}
 	}
 	else
 	{
-		temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
 		for(j=0;j<cfont.y_size;j++) 
 		{
-			for (int zz=0; zz<(cfont.x_size/8); zz++)
+			int i=0, start;
+
+			// Only the foreground runs are drawn, one window per run
+			while (i<cfont.x_size)
 			{
-				ch=pgm_read_byte(&cfont.font[temp+zz]); 
-				for(i=0;i<8;i++)
-				{   
-				
-					if((ch&(1<<(7-i)))!=0)   
-					{
-						setXY(x+i+(zz*8),y+j,x+i+(zz*8)+1,y+j+1);
-						setPixel((fch<<8)|fcl);
-					} 
+				if (_font_bit(temp, i))
+				{
+					start=i;
+					while ((i<cfont.x_size) and _font_bit(temp, i))
+						i++;
+					setXY(x+start,y+j,x+i-1,y+j);
+					_write_pixels(fch, fcl, i-start);
 				}
+				else
+					i++;
 			}
-			temp+=(cfont.x_size/8);
+			temp+=bpr;
 		}
 	}
 
 	sbi(P_CS, B_CS);
-	clrXY();
 }
 
-void UTFT::rotateChar(byte c, int x, int y, int pos, int deg)
+boolean UTFT::_font_bit(word temp, int px)
 {
-	byte i,j,ch;
-	word temp; 
-	int newx,newy;
-	double radian;
-	radian=deg*0.0175;  
+	return (pgm_read_byte(&cfont.font[temp+(px>>3)]) & (0x80>>(px & 7)))!=0;
+}
 
-	cbi(P_CS, B_CS);
+void UTFT::_glyph_row(word temp, boolean reverse)
+{
+	int		n=0;
+	boolean	last=false, bit;
 
-	temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-	for(j=0;j<cfont.y_size;j++) 
+	// Landscape mode writes each row from right to left
+	for (int i=0; i<cfont.x_size; i++)
 	{
-		for (int zz=0; zz<(cfont.x_size/8); zz++)
+		bit=_font_bit(temp, reverse ? cfont.x_size-1-i : i);
+		if ((n>0) and (bit!=last))
 		{
-			ch=pgm_read_byte(&cfont.font[temp+zz]); 
-			for(i=0;i<8;i++)
-			{   
-				newx=x+(((i+(zz*8)+(pos*cfont.x_size))*cos(radian))-((j)*sin(radian)));
-				newy=y+(((j)*cos(radian))+((i+(zz*8)+(pos*cfont.x_size))*sin(radian)));
-
-				setXY(newx,newy,newx+1,newy+1);
-				
-				if((ch&(1<<(7-i)))!=0)   
-				{
-					setPixel((fch<<8)|fcl);
-				} 
-				else  
-				{
-					if (!_transparent)
-						setPixel((bch<<8)|bcl);
-				}   
-			}
+			if (last)
+				_write_pixels(fch, fcl, n);
+			else
+				_write_pixels(bch, bcl, n);
+			n=0;
 		}
-		temp+=(cfont.x_size/8);
+		last=bit;
+		n++;
 	}
-	sbi(P_CS, B_CS);
-	clrXY();
+	if (last)
+		_write_pixels(fch, fcl, n);
+	else
+		_write_pixels(bch, bcl, n);
 }
 
-void UTFT::print(char *st, int x, int y, int deg)
+#if UTFT_GLYPH_CACHE>0
+_glyph_cache_entry* UTFT::_glyph_lookup(byte c, word temp)
 {
-	int stl, i;
+	word				fg=(fch<<8)|fcl, bg=(bch<<8)|bcl;
+	_glyph_cache_entry	*e=&_glyph_cache[0];
+	int					bpr=cfont.x_size/8;
 
-	stl = strlen(st);
-
-	if (orient==PORTRAIT)
+	_glyph_clock++;
+	for (int i=0; i<UTFT_GLYPH_CACHE; i++)
 	{
-	if (x==RIGHT)
-		x=(disp_x_size+1)-(stl*cfont.x_size);
-	if (x==CENTER)
-		x=((disp_x_size+1)-(stl*cfont.x_size))/2;
+		_glyph_cache_entry *t=&_glyph_cache[i];
+
+		if ((t->font==cfont.font) and (t->c==c) and (t->orient==orient) and (t->fg==fg) and (t->bg==bg))
+		{
+			t->age=_glyph_clock;
+			return t;
+		}
+		if (t->age<e->age)
+			e=t;
 	}
-	else
+
+	// Replace the least recently used glyph
+	e->font=cfont.font;
+	e->c=c;
+	e->orient=orient;
+	e->fg=fg;
+	e->bg=bg;
+	e->age=_glyph_clock;
+	for (int j=0; j<cfont.y_size; j++)
 	{
-	if (x==RIGHT)
-		x=(disp_y_size+1)-(stl*cfont.x_size);
-	if (x==CENTER)
-		x=((disp_y_size+1)-(stl*cfont.x_size))/2;
+		for (int i=0; i<cfont.x_size; i++)
+			e->pixels[(j*cfont.x_size)+i]=_font_bit(temp, orient==PORTRAIT ? i : cfont.x_size-1-i) ? fg : bg;
+		temp+=bpr;
 	}
-
-	for (i=0; i<stl; i++)
-		if (deg==0)
-			printChar(*st++, x + (i*(cfont.x_size)), y);
-		else
-			rotateChar(*st++, x, y, i, deg);
+	return e;
 }
+#endif
 
-void UTFT::print(String st, int x, int y, int deg)
+void UTFT::_write_pixels(byte ch, byte cl, long pix)
 {
-	char buf[st.length()+1];
+#if defined(UTFT_BUS_STATS)
+	bus_data+=pix*2;
+#endif
+	TRACE_FILL(TRACE_PIXELS, ch, cl, pix);
+	if (display_transfer_mode!=1)
+	{
+		sbi(P_RS, B_RS);
+		for (long i=0; i<pix; i++)
+			LCD_Writ_Bus(ch,cl,display_transfer_mode);
+	}
+#if defined(UTFT_HW_SPI)
+	else if (_hw_spi)
+	{
+		for (long i=0; i<pix; i++)
+		{
+			LCD_Writ_Bus(1,ch,display_transfer_mode);
+			LCD_Writ_Bus(1,cl,display_transfer_mode);
+		}
+	}
+#endif
+	else
+	{
+		word	color=(word(byte(ch))<<8) | byte(cl);
 
-	st.toCharArray(buf, st.length()+1);
-	print(buf, x, y, deg);
+		_fast_serial(&color, pix, 0);
+	}
 }
 
-void UTFT::printNumI(long num, int x, int y, int length, char filler)
+void UTFT::_write_words(const uint16_t *data, long pix, int stride)
 {
-	char buf[25];
-	char st[27];
-	boolean neg=false;
-	int c=0, f=0;
-  
-	if (num==0)
+#if defined(UTFT_BUS_STATS)
+	bus_data+=pix*2;
+#endif
+#if defined(UTFT_PROFILE)
+	_prof_pixels+=pix;
+#endif
+#if defined(UTFT_BUS_TRACE)
+	for (long i=0; i<pix; i++)
+		_trace_data(TRACE_DATA16, data[i*stride]>>8, data[i*stride] & 0xFF);
+#endif
+	if (display_transfer_mode!=1)
 	{
-		if (length!=0)
-		{
-			for (c=0; c<(length-1); c++)
-				st[c]=filler;
-			st[c]=48;
-			st[c+1]=0;
-		}
-		else
-		{
-			st[0]=48;
-			st[1]=0;
-		}
+		sbi(P_RS, B_RS);
+		for (long i=0; i<pix; i++, data+=stride)
+			LCD_Writ_Bus(*data>>8,*data & 0xFF,display_transfer_mode);
 	}
-	else
+#if defined(UTFT_HW_SPI)
+	else if (_hw_spi)
 	{
-		if (num<0)
-		{
-			neg=true;
-			num=-num;
-		}
-	  
-		while (num>0)
-		{
-			buf[c]=48+(num % 10);
-			c++;
-			num=(num-(num % 10))/10;
-		}
-		buf[c]=0;
-	  
-		if (neg)
-		{
-			st[0]=45;
-		}
-	  
-		if (length>(c+neg))
+		for (long i=0; i<pix; i++, data+=stride)
 		{
-			for (int i=0; i<(length-c-neg); i++)
-			{
-				st[i+neg]=filler;
-				f++;
-			}
+			LCD_Writ_Bus(1,*data>>8,display_transfer_mode);
+			LCD_Writ_Bus(1,*data & 0xFF,display_transfer_mode);
 		}
+	}
+#endif
+	else
+		_fast_serial(data, pix, stride);
+}
 
-		for (int i=0; i<c; i++)
-		{
-			st[i+neg+f]=buf[c-i-1];
-		}
-		st[c+neg+f]=0;
+void UTFT::_push_rect(int x1, int y1, int x2, int y2, const uint16_t *data)
+{
+	int sx=x2-x1+1, sy=y2-y1+1;
 
+	cbi(P_CS, B_CS);
+	setXY(x1, y1, x2, y2);
+	if (orient==PORTRAIT)
+		_write_words(data, long(sx)*sy);
+	else
+	{
+		// In landscape mode the window is filled one column at a time,
+		// starting with the rightmost column
+		for (int tx=sx-1; tx>=0; tx--)
+			_write_words(&data[tx], sy, sx);
 	}
+	sbi(P_CS, B_CS);
+}
 
-	print(st,x,y);
+// *** Proportional fonts ***
+void UTFT::_prop_get_glyph(byte c, _prop_glyph *g)
+{
+	word e;
+
+	g->x=0;
+	if ((c<cfont.offset) or (c>=cfont.offset+cfont.numchars))
+	{
+		g->offset=0;
+		g->w=0;
+		g->h=0;
+		g->xoff=0;
+		g->yoff=0;
+		g->advance=0;
+		return;
+	}
+	e=8+((c-cfont.offset)*8);
+	g->offset=fontbyte(e) | (long(fontbyte(e+1))<<8) | (long(fontbyte(e+2))<<16);
+	g->w=fontbyte(e+3);
+	g->h=fontbyte(e+4);
+	g->xoff=int8_t(fontbyte(e+5));
+	g->yoff=fontbyte(e+6);
+	g->advance=fontbyte(e+7);
 }
 
-void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int length, char filler)
+int UTFT::_prop_kerning(byte left, byte right)
 {
-	char st[27];
-	boolean neg=false;
+	word base=8+(cfont.numchars*8);
+	word key=(left<<8) | right, k;
+	int lo=0, hi=fontbyte(7)-1, mid;
 
-	if (dec<1)
-		dec=1;
+	while (lo<=hi)
+	{
+		mid=(lo+hi)/2;
+		k=(fontbyte(base+(mid*3))<<8) | fontbyte(base+(mid*3)+1);
+		if (k==key)
+			return int8_t(fontbyte(base+(mid*3)+2));
+		if (k<key)
+			lo=mid+1;
+		else
+			hi=mid-1;
+	}
+	return 0;
+}
+
+// Alpha value of the glyph pixel at screen column col and line row (from
+// the top of the text line)
+byte UTFT::_prop_alpha(_prop_glyph *g, int col, int row)
+{
+	int gx=col-g->x, gy=row-g->yoff;
+	long p;
+
+	if ((gx<0) or (gx>=g->w) or (gy<0) or (gy>=g->h))
+		return 0;
+	gx*=cfont.bpp;
+	p=g->offset+(long(gy)*(((g->w*cfont.bpp)+7)>>3))+(gx>>3);
+	return (fontbyte(p)>>(8-cfont.bpp-(gx & 7))) & ((1<<cfont.bpp)-1);
+}
+
+#if defined(UTFT_AA_FONTS)
+// The blend table holds the color for each alpha value between the back
+// and front color. It is only rebuilt when the colors or the font change.
+void UTFT::_prop_lut()
+{
+	word fg=(fch<<8) | fcl, bg=(bch<<8) | bcl;
+	byte levels=(1<<cfont.bpp)-1;
+
+	if ((fg==_aa_fg) and (bg==_aa_bg) and (levels==_aa_levels))
+		return;
+	_aa_fg=fg;
+	_aa_bg=bg;
+	_aa_levels=levels;
+	for (int i=0; i<=levels; i++)
+	{
+		word r=((((bg>>11) & 0x1F)*(levels-i))+(((fg>>11) & 0x1F)*i)+(levels/2))/levels;
+		word g=((((bg>>5) & 0x3F)*(levels-i))+(((fg>>5) & 0x3F)*i)+(levels/2))/levels;
+		word b=(((bg & 0x1F)*(levels-i))+((fg & 0x1F)*i)+(levels/2))/levels;
+
+		_aa_lut[i]=(r<<11) | (g<<5) | b;
+	}
+}
+#endif
+
+// Draws the screen columns x1 to x2 of a text line. Neighbouring glyphs 
+// may reach into the columns because of kerning and glyph offsets, so
+// the largest alpha value of the three glyphs is used. Equal colors are
+// sent as runs, and transparent text only sends the foreground runs.
+void UTFT::_prop_cell(int x1, int x2, int y, _prop_glyph *prev, _prop_glyph *cur, _prop_glyph *next)
+{
+	int		h=cfont.y_size, half=(1<<cfont.bpp)>>1;
+	word	color, run_color=0;
+#if !defined(UTFT_AA_FONTS)
+	word	fg=(fch<<8) | fcl, bg=(bch<<8) | bcl;
+#endif
+	long	n=0;
+
+	if (_transparent)
+	{
+		for (int row=0; row<h; row++)
+		{
+			int col=x1, start;
+
+			while (col<=x2)
+			{
+				if (max(max(_prop_alpha(prev, col, row), _prop_alpha(cur, col, row)), _prop_alpha(next, col, row))>=half)
+				{
+					start=col;
+					while ((col<=x2) and (max(max(_prop_alpha(prev, col, row), _prop_alpha(cur, col, row)), _prop_alpha(next, col, row))>=half))
+						col++;
+					setXY(start, y+row, col-1, y+row);
+					_write_pixels(fch, fcl, col-start);
+				}
+				else
+					col++;
+			}
+		}
+		return;
+	}
+
+	if (orient==PORTRAIT)
+		setXY(x1, y, x2, y+h-1);
+	for (int row=0; row<h; row++)
+	{
+		if (orient!=PORTRAIT)
+			setXY(x1, y+row, x2, y+row);
+		for (int i=x1; i<=x2; i++)
+		{
+			// Rows are sent from the right in landscape mode
+			int col=(orient==PORTRAIT) ? i : x1+x2-i;
+
+#if defined(UTFT_AA_FONTS)
+			color=_aa_lut[max(max(_prop_alpha(prev, col, row), _prop_alpha(cur, col, row)), _prop_alpha(next, col, row))];
+#else
+			color=(max(max(_prop_alpha(prev, col, row), _prop_alpha(cur, col, row)), _prop_alpha(next, col, row))>=half) ? fg : bg;
+#endif
+			if ((n>0) and (color!=run_color))
+			{
+				_write_run(run_color>>8, run_color & 0xFF, n);
+				n=0;
+			}
+			run_color=color;
+			n++;
+		}
+		if (orient!=PORTRAIT)
+		{
+			_write_run(run_color>>8, run_color & 0xFF, n);
+			n=0;
+		}
+	}
+	if (n>0)
+		_write_run(run_color>>8, run_color & 0xFF, n);
+}
+
+// Each character is drawn from its pen position to the pen position of
+// the next character, so every column of the text is sent once.
+void UTFT::_print_prop(char *st, int x, int y)
+{
+	_prop_glyph	g[3] = {};
+	_prop_glyph	*prev=&g[0], *cur=&g[1], *next=&g[2], *t;
+	int			pen=x, next_pen, x1, x2;
+
+	if (*st==0)
+		return;
+#if defined(UTFT_AA_FONTS)
+	_prop_lut();
+#endif
+	cbi(P_CS, B_CS);
+
+	_prop_get_glyph(*st, cur);
+	cur->x=pen+cur->xoff;
+	x1=min(pen, cur->x);
+	for (; *st!=0; st++)
+	{
+		next_pen=pen+cur->advance;
+		if (st[1]!=0)
+		{
+			next_pen+=_prop_kerning(st[0], st[1]);
+			_prop_get_glyph(st[1], next);
+			next->x=next_pen+next->xoff;
+			x2=next_pen-1;
+		}
+		else
+		{
+			next->w=0;
+			x2=max(next_pen, cur->x+cur->w)-1;
+		}
+		if (x2>=x1)
+		{
+			_prop_cell(x1, x2, y, prev, cur, next);
+			x1=x2+1;
+		}
+		t=prev;
+		prev=cur;
+		cur=next;
+		next=t;
+		pen=next_pen;
+	}
+
+	sbi(P_CS, B_CS);
+}
+
+// Returns the width of st in pixels with the current font
+int UTFT::getTextWidth(char *st)
+{
+	_prop_glyph	g;
+	int			w=0;
+
+	if (cfont.bpp==0)
+		return strlen(st)*cfont.x_size;
+	for (; *st!=0; st++)
+	{
+		_prop_get_glyph(*st, &g);
+		w+=g.advance;
+		if (st[1]!=0)
+			w+=_prop_kerning(st[0], st[1]);
+	}
+	return w;
+}
+
+void UTFT::rotateChar(byte c, int x, int y, int pos, int deg)
+{
+	word temp; 
+
+	temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
+	_draw_rotated(x, y, -(pos*cfont.x_size), 0, cfont.x_size, cfont.y_size, deg, 0, temp);
+}
+
+void UTFT::print(char *st, int x, int y, int deg)
+{
+	int stl, i;
+
+	PRIMITIVE(PRIM_PRINT);
+	stl = strlen(st);
+
+	if (orient==PORTRAIT)
+	{
+	if (x==RIGHT)
+		x=(disp_x_size+1)-getTextWidth(st);
+	if (x==CENTER)
+		x=((disp_x_size+1)-getTextWidth(st))/2;
+	}
+	else
+	{
+	if (x==RIGHT)
+		x=(disp_y_size+1)-getTextWidth(st);
+	if (x==CENTER)
+		x=((disp_y_size+1)-getTextWidth(st))/2;
+	}
+
+	// Proportional fonts can not be rotated
+	if (cfont.bpp!=0)
+	{
+		_print_prop(st, x, y);
+		return;
+	}
+
+	for (i=0; i<stl; i++)
+		if (deg==0)
+			printChar(*st++, x + (i*(cfont.x_size)), y);
+		else
+			rotateChar(*st++, x, y, i, deg);
+}
+
+void UTFT::print(String st, int x, int y, int deg)
+{
+	char buf[st.length()+1];
+
+	PRIMITIVE(PRIM_PRINT);
+	st.toCharArray(buf, st.length()+1);
+	print(buf, x, y, deg);
+}
+
+// Numbers are drawn one character at a time, straight from the value
+void UTFT::_print_num(_num_format *f, int x, int y)
+{
+	unsigned long	p=1;
+	char			st[27];
+	byte			i;
+#if UTFT_NUM_DIFF>0
+	_num_diff_entry	*e=0;
+	boolean			diff=false;
+	word			fg=(fch<<8) | fcl, bg=(bch<<8) | bcl;
+#endif
+
+	for (i=1; i<f->digits; i++)
+		p*=10;
+
+	if (cfont.bpp==0)
+	{
+		if (orient==PORTRAIT)
+		{
+		if (x==RIGHT)
+			x=(disp_x_size+1)-(f->len*cfont.x_size);
+		if (x==CENTER)
+			x=((disp_x_size+1)-(f->len*cfont.x_size))/2;
+		}
+		else
+		{
+		if (x==RIGHT)
+			x=(disp_y_size+1)-(f->len*cfont.x_size);
+		if (x==CENTER)
+			x=((disp_y_size+1)-(f->len*cfont.x_size))/2;
+		}
+#if UTFT_NUM_DIFF>0
+		if ((_num_diff_on) and (f->len<=UTFT_NUM_DIFF_CHARS))
+		{
+			for (i=0; i<UTFT_NUM_DIFF; i++)
+				if ((_num_diff[i].len!=0) and (_num_diff[i].x==x) and (_num_diff[i].y==y))
+					e=&_num_diff[i];
+			if (e==0)
+			{
+				e=&_num_diff[_num_diff_next];
+				_num_diff_next=(_num_diff_next+1) % UTFT_NUM_DIFF;
+				e->len=0;
+			}
+			// Only the same number of characters in the same font and 
+			// colors can be updated
+			diff=(e->len==f->len) and (e->font==cfont.font) and (e->fg==fg) and (e->bg==bg) and (!_transparent);
+			e->x=x;
+			e->y=y;
+			e->font=cfont.font;
+			e->fg=fg;
+			e->bg=bg;
+			e->len=f->len;
+		}
+#endif
+	}
+
+	for (i=0; i<f->len; i++)
+	{
+		char c;
+
+		if (i<f->pad+f->neg)
+		{
+			if ((f->neg) and (i==(f->sign_first ? 0 : f->pad)))
+				c='-';
+			else
+				c=f->filler;
+		}
+		else if ((f->dec>0) and (i==f->pad+f->neg+f->digits-f->dec))
+			c=f->divider;
+		else
+		{
+			c='0'+((f->value/p) % 10);
+			p/=10;
+		}
+
+		if (cfont.bpp!=0)
+			st[i]=c;
+#if UTFT_NUM_DIFF>0
+		else if (e!=0)
+		{
+			if ((!diff) or (e->st[i]!=c))
+				printChar(c, x+(i*cfont.x_size), y);
+			e->st[i]=c;
+		}
+#endif
+		else
+			printChar(c, x+(i*cfont.x_size), y);
+	}
+	if (cfont.bpp!=0)
+	{
+		st[f->len]=0;
+		print(st, x, y);
+	}
+}
+
+void UTFT::printNumI(long num, int x, int y, int length, char filler)
+{
+	_num_format		f;
+	unsigned long	v;
+
+	PRIMITIVE(PRIM_PRINTNUMI);
+	f.neg=(num<0);
+	f.value=f.neg ? 0-(unsigned long)num : num;
+	f.dec=0;
+	f.digits=1;
+	for (v=f.value; v>=10; v/=10)
+		f.digits++;
+	f.sign_first=true;
+	f.filler=filler;
+	f.len=f.digits+f.neg;
+	f.pad=0;
+	if (length>26)
+		length=26;
+	if (length>f.len)
+	{
+		f.pad=length-f.len;
+		f.len=length;
+	}
+	_print_num(&f, x, y);
+}
+
+void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int length, char filler)
+{
+	_num_format		f;
+	unsigned long	v, scale=1;
+
+	PRIMITIVE(PRIM_PRINTNUMF);
+	if (dec<1)
+		dec=1;
 	else if (dec>5)
 		dec=5;
+	if (length>26)
+		length=26;
+
+	for (byte i=0; i<dec; i++)
+		scale*=10;
+	f.neg=(num<0);
+	if (f.neg)
+		num=-num;
+
+	// Numbers that do not fit in a long after scaling are left to the
+	// floating point conversion
+	if (num*scale<2147483647.0)
+	{
+		// Rounded from the binary value of num, as dtostrf() and sprintf()
+		// do: fma() gives the error of num*scale, which decides when the
+		// product lands on a half, and exact halves go to the even digit
+		double	p=num*scale, k=floor(p), d=(p-k)-0.5, err=fma(num, scale, -p);
+
+		f.value=(unsigned long)k;
+		if ((d>0) or ((d==0) and ((err>0) or ((err==0) and (f.value & 1)))))
+			f.value++;
+		f.dec=dec;
+		f.divider=divider;
+		f.digits=dec+1;
+		for (v=f.value/scale; v>=10; v/=10)
+			f.digits++;
+		f.sign_first=(filler!=' ');
+		f.filler=filler;
+		f.len=f.digits+1+f.neg;
+		f.pad=0;
+		if (length>f.len)
+		{
+			f.pad=length-f.len;
+			f.len=length;
+		}
+		_print_num(&f, x, y);
+		return;
+	}
 
-	if (num<0)
-		neg = true;
+	char st[27];
 
+	if (f.neg)
+		num=-num;
 	_convert_float(st, num, length, dec);
 
 	if (divider != '.')
 	{
-		for (int i=0; i<sizeof(st); i++)
+		for (unsigned i=0; i<sizeof(st); i++)
 			if (st[i]=='.')
 				st[i]=divider;
 	}
 
 	if (filler != ' ')
 	{
-		if (neg)
+		if (f.neg)
 		{
 			st[0]='-';
-			for (int i=1; i<sizeof(st); i++)
+			for (unsigned i=1; i<sizeof(st); i++)
 				if ((st[i]==' ') || (st[i]=='-'))
 					st[i]=filler;
 		}
 		else
 		{
-			for (int i=0; i<sizeof(st); i++)
+			for (unsigned i=0; i<sizeof(st); i++)
 				if (st[i]==' ')
 					st[i]=filler;
 		}
 	}
-
-	print(st,x,y);
+
+	print(st,x,y);
+}
+
+// In digit diff mode printNumI() and printNumF() only redraw the characters
+// that are different from the last number drawn at the same place. Any 
+// other drawing over a number must be followed by setNumDiff(true) to 
+// forget the numbers on the screen. clrScr() and fillScr() do this 
+// automatically. setNumDiff() does nothing unless UTFT_NUM_DIFF is set in
+// UTFT.h.
+void UTFT::setNumDiff(boolean enable)
+{
+#if UTFT_NUM_DIFF>0
+	_num_diff_on=enable;
+	_clear_num_diff();
+#else
+	(void)enable;
+#endif
+}
+
+void UTFT::_clear_num_diff()
+{
+#if UTFT_NUM_DIFF>0
+	for (int i=0; i<UTFT_NUM_DIFF; i++)
+		_num_diff[i].len=0;
+#endif
+}
+
+void UTFT::setFont(uint8_t* font)
+{
+	cfont.font=font;
+	cfont.x_size=fontbyte(0);
+	cfont.y_size=fontbyte(1);
+	cfont.offset=fontbyte(2);
+	cfont.numchars=fontbyte(3);
+	cfont.bpp=0;
+	if (cfont.x_size==0)
+	{
+		cfont.bpp=fontbyte(4);
+		cfont.x_size=fontbyte(5);
+	}
+}
+
+uint8_t* UTFT::getFont()
+{
+	return cfont.font;
+}
+
+uint8_t UTFT::getFontXsize()
+{
+	return cfont.x_size;
+}
+
+uint8_t UTFT::getFontYsize()
+{
+	return cfont.y_size;
+}
+
+void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale)
+{
+	unsigned int col;
+	int tx, ty, tsx, tsy;
+
+	PRIMITIVE(PRIM_DRAWBITMAP);
+	if (scale==1)
+	{
+		if (orient==PORTRAIT)
+		{
+			cbi(P_CS, B_CS);
+			setXY(x, y, x+sx-1, y+sy-1);
+			for (ty=0; ty<sy; ty++)
+				_write_sheet(&data[long(ty)*sx], sx, 1);
+			sbi(P_CS, B_CS);
+		}
+		else
+		{
+			cbi(P_CS, B_CS);
+			for (ty=0; ty<sy; ty++)
+			{
+				setXY(x, y+ty, x+sx-1, y+ty);
+				_write_sheet(&data[(long(ty)*sx)+sx-1], sx, -1);
+			}
+			sbi(P_CS, B_CS);
+		}
+	}
+	else
+	{
+		if (orient==PORTRAIT)
+		{
+			cbi(P_CS, B_CS);
+			for (ty=0; ty<sy; ty++)
+			{
+				setXY(x, y+(ty*scale), x+((sx*scale)-1), y+(ty*scale)+scale);
+				for (tsy=0; tsy<scale; tsy++)
+					for (tx=0; tx<sx; tx++)
+					{
+						col=pgm_read_word(&data[(ty*sx)+tx]);
+						for (tsx=0; tsx<scale; tsx++)
+							LCD_Write_DATA(col>>8,col & 0xff);
+					}
+			}
+			sbi(P_CS, B_CS);
+		}
+		else
+		{
+			cbi(P_CS, B_CS);
+			for (ty=0; ty<sy; ty++)
+			{
+				for (tsy=0; tsy<scale; tsy++)
+				{
+					setXY(x, y+(ty*scale)+tsy, x+((sx*scale)-1), y+(ty*scale)+tsy);
+					for (tx=sx-1; tx>=0; tx--)
+					{
+						col=pgm_read_word(&data[(ty*sx)+tx]);
+						for (tsx=0; tsx<scale; tsx++)
+							LCD_Write_DATA(col>>8,col & 0xff);
+					}
+				}
+			}
+			sbi(P_CS, B_CS);
+		}
+	}
+}
+
+void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy)
+{
+	PRIMITIVE(PRIM_DRAWBITMAP);
+	if (deg==0)
+		drawBitmap(x, y, sx, sy, data);
+	else
+		_draw_rotated(x+rox, y+roy, rox, roy, sx, sy, deg, data, 0);
+}
+
+// Packed bitmaps start with a 6 byte header: format, width and height 
+// (16 bit, low byte first) and the number of palette colors minus one. 
+// Palette formats are followed by the palette as RGB565 colors, high byte
+// first. BITMAP_PAL1/2/4/8 then store one index per pixel, packed MSB 
+// first with every row padded to a whole byte. BITMAP_RLE565 and 
+// BITMAP_PALRLE store each row as packets starting with a count byte: if
+// bit 7 is set the next color (or index) is repeated (count&0x7F)+1 
+// times, otherwise (count+1) literal colors (or indexes) follow. Packets
+// never cross the end of a row. Use the PackedBitmapConverter tool to 
+// create the arrays. Nothing is drawn if the format is not one of these.
+void UTFT::drawPackedBitmap(int x, int y, uint8_t* data)
+{
+	byte		format=pgm_read_byte(&data[0]);
+	int			sx=pgm_read_byte(&data[1])|(pgm_read_byte(&data[2])<<8);
+	int			sy=pgm_read_byte(&data[3])|(pgm_read_byte(&data[4])<<8);
+	int			colors=pgm_read_byte(&data[5])+1;
+	byte		size=(format==BITMAP_RLE565) ? 2 : 1;
+	uint8_t		*palette=&data[6];
+	uint8_t		*pix=&data[6];
+	uint8_t		*packet[16];
+	byte		count, ch, cl, np;
+	int			tx, ty, gx;
+
+	PRIMITIVE(PRIM_DRAWPACKEDBITMAP);
+	if ((format<BITMAP_RLE565) or (format>BITMAP_PALRLE))
+		return;
+	if (format!=BITMAP_RLE565)
+		pix+=colors*2;
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+		setXY(x, y, x+sx-1, y+sy-1);
+	for (ty=0; ty<sy; ty++)
+	{
+		if ((format>=BITMAP_PAL1) and (format<=BITMAP_PAL8))
+		{
+			if (orient==LANDSCAPE)
+				setXY(x, y+ty, x+sx-1, y+ty);
+			_packed_span(sx, pix, format, palette);
+			pix+=((long(sx)<<(format-BITMAP_PAL1))+7)/8;
+		}
+		else
+		{
+			tx=0;
+			while (tx<sx)
+			{
+				// Landscape rows are filled from the right, so a group of
+				// packets is located first and then written in reverse.
+				gx=tx;
+				np=0;
+				while ((tx<sx) and (np<16))
+				{
+					packet[np++]=pix;
+					count=pgm_read_byte(pix++);
+					tx+=(count&0x7F)+1;
+					pix+=(count&0x80) ? size : ((count&0x7F)+1)*size;
+				}
+				if (orient==LANDSCAPE)
+					setXY(x+gx, y+ty, x+tx-1, y+ty);
+				for (int i=0; i<np; i++)
+				{
+					uint8_t *p=packet[(orient==PORTRAIT) ? i : np-1-i];
+
+					count=pgm_read_byte(p++);
+					if (count&0x80)
+					{
+						if (format==BITMAP_RLE565)
+						{
+							ch=pgm_read_byte(&p[0]);
+							cl=pgm_read_byte(&p[1]);
+						}
+						else
+						{
+							ch=pgm_read_byte(&palette[pgm_read_byte(p)*2]);
+							cl=pgm_read_byte(&palette[(pgm_read_byte(p)*2)+1]);
+						}
+						_write_run(ch, cl, (count&0x7F)+1);
+					}
+					else
+						_packed_span(count+1, p, format, palette);
+				}
+			}
+		}
+	}
+	sbi(P_CS, B_CS);
+}
+
+// Writes pix pixels of one color into the current window. Unlike 
+// _fast_fill_16(), exactly pix pixels are written so the window can be
+// shared with other pixels.
+void UTFT::_write_run(byte ch, byte cl, long pix)
+{
+	long fast=pix & ~15L;
+
+	if ((fast>0) and ((display_transfer_mode==16) or ((display_transfer_mode==8) and (ch==cl))))
+	{
+		sbi(P_RS, B_RS);
+		if (display_transfer_mode==16)
+		{
+			TRACE_FILL(TRACE_FILL16, ch, cl, fast);
+			_fast_fill_16(ch, cl, fast);
+		}
+		else
+		{
+			TRACE_FILL(TRACE_FILL8, ch, ch, fast);
+			_fast_fill_8(ch, fast);
+		}
+		pix-=fast;
+	}
+	_write_pixels(ch, cl, pix);
+}
+
+// Writes n literal pixels of a packed bitmap into the current window. In
+// landscape mode rows are filled from the right, so the pixels are read 
+// in reverse.
+void UTFT::_packed_span(int n, uint8_t* data, byte format, uint8_t* palette)
+{
+	uint16_t	buf[16];
+	byte		bits=0;
+	int			cnt=0, i;
+
+	if (format==BITMAP_PALRLE)
+		bits=8;
+	else if ((format>=BITMAP_PAL1) and (format<=BITMAP_PAL8))
+		bits=1<<(format-BITMAP_PAL1);
+
+	for (int t=0; t<n; t++)
+	{
+		i=(orient==PORTRAIT) ? t : n-1-t;
+		if (format==BITMAP_RLE565)
+			buf[cnt++]=(pgm_read_byte(&data[i*2])<<8)|pgm_read_byte(&data[(i*2)+1]);
+		else
+		{
+			long	bit=long(i)*bits;
+			byte	c=(pgm_read_byte(&data[bit>>3])>>(8-bits-(bit&7))) & ((1<<bits)-1);
+
+			buf[cnt++]=(pgm_read_byte(&palette[c*2])<<8)|pgm_read_byte(&palette[(c*2)+1]);
+		}
+		if (cnt==16)
+		{
+			_write_words(buf, cnt);
+			cnt=0;
+		}
+	}
+	_write_words(buf, cnt);
+}
+
+// *** Streamed bitmaps ***
+static boolean _stream_read(Stream &s, uint8_t *buf, int n)
+{
+	return s.readBytes((char *)buf, n)==size_t(n);
+}
+
+static long _stream_le(const uint8_t *buf, byte n)
+{
+	long v=0;
+
+	while (n>0)
+		v=(v<<8)|buf[--n];
+	return v;
+}
+
+// Bitmaps are read from any Stream (a serial port, a network client, a
+// file on an SD card) UTFT_STREAM_CHUNK pixels at a time, so the image is
+// never kept in RAM. BITMAP_RAW565 is sx*sy RGB565 colors, high byte
+// first. BITMAP_RLE565 is sx*sy pixels stored as the row packets of
+// drawPackedBitmap(), without the header. BITMAP_BMP is a BMP file with
+// 16 bit (RGB565 or RGB555) or uncompressed 24 bit pixels. Its size is
+// read from the file and sx and sy are not used. Returns false if the
+// stream times out or the BMP file is not supported; the rest of the
+// bitmap is then left undrawn.
+boolean UTFT::drawBitmapStream(Stream &s, int x, int y, int sx, int sy, byte format)
+{
+	uint16_t	buf[((UTFT_STREAM_CHUNK*3)+1)/2];
+	uint8_t		*b=(uint8_t *)buf;
+	byte		size=2, pad=0, decode=0, count;
+	boolean		flip=false, ok=true;
+	long		skip;
+	int			tx, ty, row, n, left;
+
+	PRIMITIVE(PRIM_DRAWBITMAPSTREAM);
+	if (format==BITMAP_BMP)
+	{
+		// File header and the start of the info header
+		uint8_t	hdr[34];
+		int		bits;
+		long	comp, h;
+
+		if (!_stream_read(s, hdr, 34) or (hdr[0]!='B') or (hdr[1]!='M') or (_stream_le(&hdr[14], 4)<40))
+			return false;
+		skip=_stream_le(&hdr[10], 4)-34;
+		sx=int32_t(_stream_le(&hdr[18], 4));
+		h=int32_t(_stream_le(&hdr[22], 4));
+		bits=_stream_le(&hdr[28], 2);
+		comp=_stream_le(&hdr[30], 4);
+		if ((bits==24) and (comp==0))
+		{
+			size=3;
+			decode=3;
+		}
+		else if ((bits==16) and (comp==0))
+			decode=2;
+		else if ((bits==16) and (comp==3))
+		{
+			// The color masks follow the 40 byte info header
+			if (!_stream_read(s, hdr, 28))
+				return false;
+			skip-=28;
+			decode=(_stream_le(&hdr[24], 4)==0x03E0) ? 2 : 1;
+		}
+		else
+			return false;
+		flip=(h>0);
+		sy=flip ? h : -h;
+		pad=(4-((sx*size) & 3)) & 3;
+		for (; skip>0; skip-=n)
+		{
+			n=min(skip, long(UTFT_STREAM_CHUNK*3));
+			if (!_stream_read(s, b, n))
+				return false;
+		}
+		if (skip<0)
+			return false;
+	}
+	else if ((format!=BITMAP_RAW565) and (format!=BITMAP_RLE565))
+		return false;
+
+	cbi(P_CS, B_CS);
+	if ((orient==PORTRAIT) and !flip)
+		setXY(x, y, x+sx-1, y+sy-1);
+	for (ty=0; (ty<sy) and ok; ty++)
+	{
+		row=flip ? sy-1-ty : ty;
+		if ((orient==PORTRAIT) and flip)
+			setXY(x, y+row, x+sx-1, y+row);
+		tx=0;
+		while ((tx<sx) and ok)
+		{
+			left=sx-tx;
+			if (format==BITMAP_RLE565)
+			{
+				if (!(ok=_stream_read(s, &count, 1)))
+					break;
+				left=min((count & 0x7F)+1, left);
+				if (count & 0x80)
+				{
+					if (!(ok=_stream_read(s, b, 2)))
+						break;
+					if (orient==LANDSCAPE)
+						setXY(x+tx, y+row, x+tx+left-1, y+row);
+					_write_run(b[0], b[1], left);
+					tx+=left;
+					continue;
+				}
+			}
+			// Literal pixels, converted to RGB565 in place
+			for (; left>0; left-=n)
+			{
+				n=min(left, UTFT_STREAM_CHUNK);
+				if (!(ok=_stream_read(s, b, n*size)))
+					break;
+				for (int i=0; i<n; i++)
+				{
+					word	v;
+
+					if (decode==0)
+						v=(b[i*2]<<8) | b[(i*2)+1];
+					else if (decode==3)
+						v=((b[(i*3)+2] & 0xF8)<<8) | ((b[(i*3)+1] & 0xFC)<<3) | (b[i*3]>>3);
+					else
+					{
+						v=(b[(i*2)+1]<<8) | b[i*2];
+						if (decode==2)
+							v=((v & 0x7FE0)<<1) | ((v>>4) & 0x20) | (v & 0x1F);
+					}
+					buf[i]=v;
+				}
+				_stream_span(x+tx, y+row, n, buf);
+				tx+=n;
+			}
+		}
+		if (ok and (pad>0))
+			ok=_stream_read(s, b, pad);
+	}
+	sbi(P_CS, B_CS);
+	return ok;
+}
+
+// Writes n pixels of one row of a streamed bitmap. In landscape mode rows
+// are filled from the right, so every span gets its own window and is
+// written in reverse.
+void UTFT::_stream_span(int x, int y, int n, const uint16_t *data)
+{
+	if (orient==PORTRAIT)
+		_write_words(data, n);
+	else
+	{
+		setXY(x, y, x+n-1, y);
+		_write_words(&data[n-1], n, -1);
+	}
+}
+
+// *** Sprite sheets ***
+// The clip rectangle limits blit() only. The other drawing functions,
+// including the polygon fills, are only limited by the screen.
+void UTFT::setBlitClip(int x1, int y1, int x2, int y2)
+{
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+	_clip_x1=x1;
+	_clip_y1=y1;
+	_clip_x2=x2;
+	_clip_y2=y2;
+	_clip=true;
+}
+
+void UTFT::clrBlitClip()
+{
+	_clip=false;
+}
+
+void UTFT::setColorKey(word color)
+{
+	_color_key=color;
+	_key=true;
+}
+
+void UTFT::clrColorKey()
+{
+	_key=false;
+}
+
+// Draws the w*h pixel part of sheet starting at srcX,srcY. sheetWidth is
+// the width of the whole sheet in pixels. Only the part inside the screen
+// and the clip rectangle is sent. With a color key each run of visible 
+// pixels in a row gets a window of its own.
+void UTFT::blit(bitmapdatatype sheet, int sheetWidth, int srcX, int srcY, int w, int h, int dstX, int dstY)
+{
+	int x1=dstX, y1=dstY, x2=dstX+w-1, y2=dstY+h-1;
+
+	PRIMITIVE(PRIM_BLIT);
+	x1=max(x1, 0);
+	y1=max(y1, 0);
+	x2=min(x2, getDisplayXSize()-1);
+	y2=min(y2, getDisplayYSize()-1);
+	if (_clip)
+	{
+		x1=max(x1, _clip_x1);
+		y1=max(y1, _clip_y1);
+		x2=min(x2, _clip_x2);
+		y2=min(y2, _clip_y2);
+	}
+	if ((x1>x2) or (y1>y2))
+		return;
+
+	// Top left visible pixel in the sheet
+	sheet+=(long(srcY+y1-dstY)*sheetWidth)+srcX+x1-dstX;
+	w=x2-x1+1;
+	h=y2-y1+1;
+
+	cbi(P_CS, B_CS);
+	if (!_key)
+	{
+		setXY(x1, y1, x2, y2);
+		if (orient==PORTRAIT)
+			for (int ty=0; ty<h; ty++)
+				_write_sheet(sheet+(long(ty)*sheetWidth), w, 1);
+		else
+			for (int tx=w-1; tx>=0; tx--)
+				_write_sheet(sheet+tx, h, sheetWidth);
+	}
+	else
+	{
+		for (int ty=0; ty<h; ty++, sheet+=sheetWidth)
+		{
+			int tx=0;
+
+			while (tx<w)
+			{
+				int start;
+
+				while ((tx<w) and (pgm_read_word(&sheet[tx])==_color_key))
+					tx++;
+				start=tx;
+				while ((tx<w) and (pgm_read_word(&sheet[tx])!=_color_key))
+					tx++;
+				if (tx>start)
+				{
+					setXY(x1+start, y1+ty, x1+tx-1, y1+ty);
+					if (orient==PORTRAIT)
+						_write_sheet(sheet+start, tx-start, 1);
+					else
+						_write_sheet(sheet+tx-1, tx-start, -1);
+				}
+			}
+		}
+	}
+	sbi(P_CS, B_CS);
 }
 
-void UTFT::setFont(uint8_t* font)
+// Sends n pixels read from a bitmap in program memory, step pixels apart
+void UTFT::_write_sheet(bitmapdatatype data, int n, long step)
 {
-	cfont.font=font;
-	cfont.x_size=fontbyte(0);
-	cfont.y_size=fontbyte(1);
-	cfont.offset=fontbyte(2);
-	cfont.numchars=fontbyte(3);
-}
+	uint16_t	buf[16];
+	int			cnt=0;
 
-uint8_t* UTFT::getFont()
-{
-	return cfont.font;
+	for (int i=0; i<n; i++, data+=step)
+	{
+		buf[cnt++]=pgm_read_word(data);
+		if (cnt==16)
+		{
+			_write_words(buf, cnt);
+			cnt=0;
+		}
+	}
+	_write_words(buf, cnt);
 }
 
-uint8_t UTFT::getFontXsize()
+#if !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+// sin(0..90 degrees) in Q15
+static const int16_t _sin_q15[91] PROGMEM = {
+	0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+	5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+	11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+	16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+	21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+	25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+	28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+	30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+	32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+	32767
+};
+
+int UTFT::_sin_deg(int deg)
 {
-	return cfont.x_size;
+	deg%=360;
+	if (deg<0)
+		deg+=360;
+	if (deg<=90)
+		return pgm_read_word(&_sin_q15[deg]);
+	else if (deg<=180)
+		return pgm_read_word(&_sin_q15[180-deg]);
+	else if (deg<=270)
+		return -pgm_read_word(&_sin_q15[deg-180]);
+	else
+		return -pgm_read_word(&_sin_q15[360-deg]);
 }
 
-uint8_t UTFT::getFontYsize()
+// Returns the color of the rotated source at the Q15 source position 
+// (su,sv), or -1 if nothing should be drawn there.
+long UTFT::_rotated_sample(long su, long sv, int ox, int oy, int sx, int sy, bitmapdatatype data, word glyph)
 {
-	return cfont.y_size;
+	int u=ox+((su+0x4000)>>15);
+	int v=oy+((sv+0x4000)>>15);
+
+	if ((u<0) or (v<0) or (u>=sx) or (v>=sy))
+		return -1;
+	if (data!=0)
+		return pgm_read_word(&data[(v*sx)+u]);
+	if (_font_bit(glyph+(v*(cfont.x_size/8)), u))
+		return (fch<<8)|fcl;
+	if (_transparent)
+		return -1;
+	return (bch<<8)|bcl;
 }
 
-void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale)
+// Draws a sx*sy bitmap or glyph rotated deg degrees around (cx,cy), where
+// source pixel (ox,oy) is placed. Every destination pixel inside the 
+// rotated bounding box is mapped back to the source, so there are no 
+// holes, and each horizontal run of drawn pixels is sent with one window.
+void UTFT::_draw_rotated(int cx, int cy, int ox, int oy, int sx, int sy, int deg, bitmapdatatype data, word glyph)
 {
-	unsigned int col;
-	int tx, ty, tc, tsx, tsy;
+	long		c=_sin_deg(deg+90), s=_sin_deg(deg);
+	long		cu[4], cv[4], su, sv;
+	int			x1, y1, x2, y2, start, n;
+	uint16_t	buf[32];
+
+	// Bounding box of the rotated source corners
+	cu[0]=-ox;		cv[0]=-oy;
+	cu[1]=sx-ox;	cv[1]=-oy;
+	cu[2]=-ox;		cv[2]=sy-oy;
+	cu[3]=sx-ox;	cv[3]=sy-oy;
+	x1=x2=cx;
+	y1=y2=cy;
+	for (int i=0; i<4; i++)
+	{
+		int px=cx+(((cu[i]*c)-(cv[i]*s))>>15);
+		int py=cy+(((cv[i]*c)+(cu[i]*s))>>15);
+		x1=min(x1, px-1);
+		x2=max(x2, px+1);
+		y1=min(y1, py-1);
+		y2=max(y2, py+1);
+	}
+	x1=max(x1, 0);
+	y1=max(y1, 0);
+	x2=min(x2, getDisplayXSize()-1);
+	y2=min(y2, getDisplayYSize()-1);
 
-	if (scale==1)
+	cbi(P_CS, B_CS);
+	for (int y=y1; y<=y2; y++)
 	{
-		if (orient==PORTRAIT)
+		long u0=su=((long(x1-cx)*c)+(long(y-cy)*s));
+		long v0=sv=((long(y-cy)*c)-(long(x1-cx)*s));
+		int x=x1;
+
+		while (x<=x2)
 		{
-			cbi(P_CS, B_CS);
-			setXY(x, y, x+sx-1, y+sy-1);
-			for (tc=0; tc<(sx*sy); tc++)
+			if (_rotated_sample(su, sv, ox, oy, sx, sy, data, glyph)<0)
 			{
-				col=pgm_read_word(&data[tc]);
-				LCD_Write_DATA(col>>8,col & 0xff);
+				x++;
+				su+=c;
+				sv-=s;
+				continue;
 			}
-			sbi(P_CS, B_CS);
-		}
-		else
-		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
+			start=x;
+			while ((x<=x2) and (_rotated_sample(su, sv, ox, oy, sx, sy, data, glyph)>=0))
 			{
-				setXY(x, y+ty, x+sx-1, y+ty);
-				for (tx=sx-1; tx>=0; tx--)
+				x++;
+				su+=c;
+				sv-=s;
+			}
+
+			// Send the run [start, x-1]. Landscape windows fill from the right.
+			setXY(start, y, x-1, y);
+			n=0;
+			for (int i=0; i<x-start; i++)
+			{
+				int px=(orient==PORTRAIT) ? start+i : x-1-i;
+
+				buf[n++]=_rotated_sample(u0+(long(px-x1)*c), v0-(long(px-x1)*s), ox, oy, sx, sy, data, glyph);
+				if (n==32)
 				{
-					col=pgm_read_word(&data[(ty*sx)+tx]);
-					LCD_Write_DATA(col>>8,col & 0xff);
+					_write_words(buf, n);
+					n=0;
 				}
 			}
-			sbi(P_CS, B_CS);
+			_write_words(buf, n);
 		}
 	}
-	else
+	sbi(P_CS, B_CS);
+}
+
+// *** Bulk color conversion ***
+// 4x4 ordered dither thresholds
+static const uint8_t _bayer4[16] PROGMEM = {
+	0, 8, 2, 10,
+	12, 4, 14, 6,
+	3, 11, 1, 9,
+	15, 7, 13, 5
+};
+
+#if !defined(__AVR__) && !defined(UTFT_HAVE_UQADD8)
+// Adds the bytes of b to the bytes of a, limiting each byte to 255
+static inline uint32_t _utft_uqadd8(uint32_t a, uint32_t b)
+{
+	uint32_t s=((a & 0x7F7F7F7F)+(b & 0x7F7F7F7F)) ^ ((a ^ b) & 0x80808080);
+	uint32_t c=((a & b) | ((a | b) & ~s)) & 0x80808080;
+
+	return s | ((c>>7)*0xFF);
+}
+#endif
+
+void UTFT::pushPixels888(int x, int y, int sx, int sy, const uint8_t *data, boolean dither)
+{
+	PRIMITIVE(PRIM_PUSHPIXELS);
+	_push_converted(x, y, sx, sy, data, 3, dither);
+}
+
+void UTFT::pushPixelsGray8(int x, int y, int sx, int sy, const uint8_t *data, boolean dither)
+{
+	PRIMITIVE(PRIM_PUSHPIXELS);
+	_push_converted(x, y, sx, sy, data, 1, dither);
+}
+
+// Converts the image 32 pixels at a time and sends each part as soon as
+// it is converted. The dither pattern follows the screen position, so 
+// the image looks the same in both orientations.
+void UTFT::_push_converted(int x, int y, int sx, int sy, const uint8_t *data, byte bpp, boolean dither)
+{
+	uint16_t	buf[32];
+	uint8_t		d[4];
+	int			tx, n;
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+		setXY(x, y, x+sx-1, y+sy-1);
+	for (int ty=0; ty<sy; ty++)
 	{
-		if (orient==PORTRAIT)
+		const uint8_t *row=data+(long(ty)*sx*bpp);
+
+		// In landscape mode each row is a window of its own, filled from
+		// the right
+		if (orient!=PORTRAIT)
+			setXY(x, y+ty, x+sx-1, y+ty);
+		for (int i=0; i<sx; i+=n)
 		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
-			{
-				setXY(x, y+(ty*scale), x+((sx*scale)-1), y+(ty*scale)+scale);
-				for (tsy=0; tsy<scale; tsy++)
-					for (tx=0; tx<sx; tx++)
-					{
-						col=pgm_read_word(&data[(ty*sx)+tx]);
-						for (tsx=0; tsx<scale; tsx++)
-							LCD_Write_DATA(col>>8,col & 0xff);
-					}
-			}
-			sbi(P_CS, B_CS);
+			n=min(sx-i, 32);
+			tx=(orient==PORTRAIT) ? i : sx-i-n;
+			if (dither)
+				for (int k=0; k<4; k++)
+					d[k]=pgm_read_byte(&_bayer4[((y+ty) & 3)*4+((x+tx+k) & 3)]);
+			if (bpp==3)
+				_convert_888(buf, row+(tx*3), n, dither ? d : 0);
+			else
+				_convert_gray8(buf, row+tx, n, dither ? d : 0);
+			if (orient==PORTRAIT)
+				_write_words(buf, n);
+			else
+				_write_words(&buf[n-1], n, -1);
 		}
-		else
+	}
+	sbi(P_CS, B_CS);
+}
+
+// Converts n pixels stored as R, G, B bytes to RGB565. dither holds the
+// thresholds (0-15) for the first four pixels, or is 0 for no dithering.
+// On 32 bit MCUs four pixels are read as three words, and the pixels are
+// taken from the words with shifts and masks. The MCUs supported by the
+// library are all little endian, so the first byte is the lowest byte of
+// a word.
+void UTFT::_convert_888(uint16_t *dst, const uint8_t *src, int n, const uint8_t *dither)
+{
+	int		i=0;
+
+#if !defined(__AVR__)
+	uint32_t	w0, w1, w2, d0=0, d1=0, d2=0;
+
+	if (dither)
+	{
+		d0=(dither[0]>>1) | ((dither[0]>>2)<<8) | ((dither[0]>>1)<<16) | (uint32_t(dither[1]>>1)<<24);
+		d1=(dither[1]>>2) | ((dither[1]>>1)<<8) | ((dither[2]>>1)<<16) | (uint32_t(dither[2]>>2)<<24);
+		d2=(dither[2]>>1) | ((dither[3]>>1)<<8) | ((dither[3]>>2)<<16) | (uint32_t(dither[3]>>1)<<24);
+	}
+	for (; i+4<=n; i+=4, src+=12, dst+=4)
+	{
+		memcpy(&w0, src, 4);
+		memcpy(&w1, src+4, 4);
+		memcpy(&w2, src+8, 4);
+		if (dither)
 		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
-			{
-				for (tsy=0; tsy<scale; tsy++)
-				{
-					setXY(x, y+(ty*scale)+tsy, x+((sx*scale)-1), y+(ty*scale)+tsy);
-					for (tx=sx-1; tx>=0; tx--)
-					{
-						col=pgm_read_word(&data[(ty*sx)+tx]);
-						for (tsx=0; tsx<scale; tsx++)
-							LCD_Write_DATA(col>>8,col & 0xff);
-					}
-				}
-			}
-			sbi(P_CS, B_CS);
+			w0=_utft_uqadd8(w0, d0);
+			w1=_utft_uqadd8(w1, d1);
+			w2=_utft_uqadd8(w2, d2);
 		}
+		dst[0]=((w0<<8) & 0xF800) | ((w0>>5) & 0x07E0) | ((w0>>19) & 0x001F);
+		dst[1]=((w0>>16) & 0xF800) | ((w1<<3) & 0x07E0) | ((w1>>11) & 0x001F);
+		dst[2]=((w1>>8) & 0xF800) | ((w1>>21) & 0x07E0) | ((w2>>3) & 0x001F);
+		dst[3]=(w2 & 0xF800) | ((w2>>13) & 0x07E0) | ((w2>>27) & 0x001F);
+	}
+#endif
+	for (; i<n; i++, src+=3)
+	{
+		byte	d=dither ? dither[i & 3] : 0;
+		int		r=min(src[0]+(d>>1), 255), g=min(src[1]+(d>>2), 255), b=min(src[2]+(d>>1), 255);
+
+		*dst++=((r & 0xF8)<<8) | ((g & 0xFC)<<3) | (b>>3);
 	}
-	clrXY();
 }
 
-void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy)
+// Converts n 8 bit gray levels to RGB565. On 32 bit MCUs four pixels are
+// converted at a time, with the 5 and 6 bit levels of all four in one 
+// word each.
+void UTFT::_convert_gray8(uint16_t *dst, const uint8_t *src, int n, const uint8_t *dither)
 {
-	unsigned int col;
-	int tx, ty, newx, newy;
-	double radian;
-	radian=deg*0.0175;  
+	int		i=0;
 
-	if (deg==0)
-		drawBitmap(x, y, sx, sy, data);
-	else
-	{
-		cbi(P_CS, B_CS);
-		for (ty=0; ty<sy; ty++)
-			for (tx=0; tx<sx; tx++)
-			{
-				col=pgm_read_word(&data[(ty*sx)+tx]);
+#if !defined(__AVR__)
+	uint32_t	v, v5, v6, d5=0, d6=0;
 
-				newx=x+rox+(((tx-rox)*cos(radian))-((ty-roy)*sin(radian)));
-				newy=y+roy+(((ty-roy)*cos(radian))+((tx-rox)*sin(radian)));
+	if (dither)
+		for (int k=0; k<4; k++)
+		{
+			d5|=uint32_t(dither[k]>>1)<<(k*8);
+			d6|=uint32_t(dither[k]>>2)<<(k*8);
+		}
+	for (; i+4<=n; i+=4, src+=4, dst+=4)
+	{
+		memcpy(&v, src, 4);
+		v5=((dither ? _utft_uqadd8(v, d5) : v)>>3) & 0x1F1F1F1F;
+		v6=((dither ? _utft_uqadd8(v, d6) : v)>>2) & 0x3F3F3F3F;
+		dst[0]=((v5 & 0x1F)*0x0801) | ((v6 & 0x3F)<<5);
+		dst[1]=(((v5>>8) & 0x1F)*0x0801) | (((v6>>8) & 0x3F)<<5);
+		dst[2]=(((v5>>16) & 0x1F)*0x0801) | (((v6>>16) & 0x3F)<<5);
+		dst[3]=((v5>>24)*0x0801) | ((v6>>24)<<5);
+	}
+#endif
+	for (; i<n; i++, src++)
+	{
+		byte	d=dither ? dither[i & 3] : 0;
+		int		g5=min(*src+(d>>1), 255)>>3, g6=min(*src+(d>>2), 255)>>2;
 
-				setXY(newx, newy, newx, newy);
-				LCD_Write_DATA(col>>8,col & 0xff);
-			}
-		sbi(P_CS, B_CS);
+		*dst++=(g5<<11) | (g6<<5) | g5;
 	}
-	clrXY();
 }
 
 void UTFT::lcdOff()
@@ -1330,3 +3207,431 @@ void UTFT::setWritePage(byte page)
 	}
 	sbi(P_CS, B_CS);
 }
+
+byte UTFT::getPageCount()
+{
+	switch (display_model)
+	{
+	case CPLD:
+		return 8;
+	default:
+		return 1;
+	}
+}
+
+// Double buffering shows one page while all drawing goes to another page.
+// swapBuffers() shows the page that was drawn and makes the other page the
+// new drawing page. That page still holds the frame before last, so the 
+// areas drawn in the last frame are passed to the repair function, which 
+// must draw them as they are now (usually the background) before the
+// changes for the next frame are drawn as they would be without double 
+// buffering. Without UTFT_DIRTY_RECTS the whole page is passed to the 
+// repair function. Drawing done by the repair function is not recorded.
+// Only controllers with more than one page of display memory 
+// (getPageCount()) are supported; the SSD1963 can only address a single
+// frame of its memory.
+boolean UTFT::beginDoubleBuffer()
+{
+	if (getPageCount()<2)
+		return false;
+	_page_show=0;
+	_page_write=1;
+	setDisplayPage(_page_show);
+	setWritePage(_page_write);
+#if UTFT_DIRTY_RECTS>0
+	_dirty_n=0;
+#endif
+	_dbuf=true;
+	return true;
+}
+
+void UTFT::endDoubleBuffer()
+{
+	if (!_dbuf)
+		return;
+	_dbuf=false;
+	setWritePage(_page_show);
+}
+
+void UTFT::swapBuffers(void (*repair)(int x1, int y1, int x2, int y2))
+{
+	if (!_dbuf)
+		return;
+	waitForVSync();
+	setDisplayPage(_page_write);
+	swap(byte, _page_show, _page_write);
+	setWritePage(_page_write);
+
+	// The remembered numbers are on the other page
+	_clear_num_diff();
+
+	_dbuf=false;
+#if UTFT_DIRTY_RECTS>0
+	if (repair)
+		for (byte i=0; i<_dirty_n; i++)
+			repair(_dirty[i].x1, _dirty[i].y1, _dirty[i].x2, _dirty[i].y2);
+	_dirty_n=0;
+#else
+	if (repair)
+		repair(0, 0, getDisplayXSize()-1, getDisplayYSize()-1);
+#endif
+	_dbuf=true;
+}
+
+#if UTFT_DIRTY_RECTS>0
+void UTFT::_mark_dirty(int x1, int y1, int x2, int y2)
+{
+	_dirty_rect	*d=_dirty;
+	byte		n=_dirty_n;
+	long		best=0x7FFFFFFF, area;
+	byte		a=0, b=0;
+
+	for (byte i=0; i<n; i++)
+		if ((x1>=d[i].x1) and (y1>=d[i].y1) and (x2<=d[i].x2) and (y2<=d[i].y2))
+			return;
+	if (n<UTFT_DIRTY_RECTS)
+	{
+		d[n].x1=x1;
+		d[n].y1=y1;
+		d[n].x2=x2;
+		d[n].y2=y2;
+		_dirty_n++;
+		return;
+	}
+
+	// Merge the two rectangles (including the new one) whose bounding box
+	// adds the least area
+	_dirty_rect	r[UTFT_DIRTY_RECTS+1];
+
+	for (byte i=0; i<n; i++)
+		r[i]=d[i];
+	r[n].x1=x1;
+	r[n].y1=y1;
+	r[n].x2=x2;
+	r[n].y2=y2;
+	for (byte i=0; i<n; i++)
+		for (byte j=i+1; j<=n; j++)
+		{
+			area=long(max(r[i].x2, r[j].x2)-min(r[i].x1, r[j].x1)+1)*(max(r[i].y2, r[j].y2)-min(r[i].y1, r[j].y1)+1)
+				-(long(r[i].x2-r[i].x1+1)*(r[i].y2-r[i].y1+1))-(long(r[j].x2-r[j].x1+1)*(r[j].y2-r[j].y1+1));
+			if (area<best)
+			{
+				best=area;
+				a=i;
+				b=j;
+			}
+		}
+	r[a].x1=min(r[a].x1, r[b].x1);
+	r[a].y1=min(r[a].y1, r[b].y1);
+	r[a].x2=max(r[a].x2, r[b].x2);
+	r[a].y2=max(r[a].y2, r[b].y2);
+	r[b]=r[n];
+	for (byte i=0; i<n; i++)
+		d[i]=r[i];
+}
+#endif
+
+// TE is the tearing effect output of the controller, which is high while
+// the panel is not being refreshed from display memory. With a TE pin set,
+// waitForVSync() and swapBuffers() wait for the start of that period. If
+// TE does not change for UTFT_VSYNC_TIMEOUT microseconds (a wrong pin, a
+// module without TE or a sleeping controller), they stop waiting.
+void UTFT::setTearPin(int pin)
+{
+	_te_pin=pin;
+	if (pin!=NOTINUSE)
+		pinMode(pin, INPUT);
+
+	cbi(P_CS, B_CS);
+	switch (display_model)
+	{
+	case ILI9341_S5P:
+	case ILI9341_S4P:
+	case ILI9481:
+	case ILI9486:
+	case R61581:
+	case ST7735:
+	case ST7735_ALT:
+	case ST7735S:
+	case HX8353C:
+	case SSD1963_480:
+	case SSD1963_800:
+	case SSD1963_800ALT:
+		if (pin!=NOTINUSE)
+		{
+			LCD_Write_COM(0x35);
+			LCD_Write_DATA(0x00);
+		}
+		else
+			LCD_Write_COM(0x34);
+		break;
+	}
+	sbi(P_CS, B_CS);
+}
+
+void UTFT::waitForVSync()
+{
+	unsigned long start;
+
+	if (_te_pin==NOTINUSE)
+		return;
+	start=micros();
+	while (digitalRead(_te_pin)==HIGH)
+		if (micros()-start>=UTFT_VSYNC_TIMEOUT)
+			return;
+	while (digitalRead(_te_pin)==LOW)
+		if (micros()-start>=UTFT_VSYNC_TIMEOUT)
+			return;
+}
+
+// Returns the axis (in the current orientation) that the controller can 
+// scroll along, or SCROLL_NONE if hardware scrolling is not supported. 
+// The controllers scroll whole GRAM lines, so a scroll area always spans
+// the full width (SCROLL_Y) or height (SCROLL_X) of the screen.
+byte UTFT::getScrollAxis()
+{
+	switch (display_model)
+	{
+	case ILI9341_S5P:
+	case ILI9341_S4P:
+	case ILI9481:
+	case ILI9486:
+	case R61581:
+	case ST7735:
+	case ST7735_ALT:
+	case ST7735S:
+	case HX8353C:
+		return (orient==PORTRAIT) ? SCROLL_Y : SCROLL_X;
+	case SSD1963_480:
+	case SSD1963_800:
+	case SSD1963_800ALT:
+		return (orient==PORTRAIT) ? SCROLL_X : SCROLL_Y;
+	}
+	return SCROLL_NONE;
+}
+
+// Number of GRAM lines the controller scrolls
+int UTFT::_scroll_lines()
+{
+	switch (display_model)
+	{
+	case SSD1963_480:
+	case SSD1963_800:
+	case SSD1963_800ALT:
+		return disp_x_size+1;
+	}
+	return disp_y_size+1;
+}
+
+// Sets the lines from first to last (along the scroll axis) as the 
+// scroll area and resets the scroll offset. All lines outside the area 
+// stay in place.
+boolean UTFT::setScrollArea(int first, int last)
+{
+	byte	axis = getScrollAxis();
+	int		lines, size;
+
+	if (axis==SCROLL_NONE)
+		return false;
+	size = (axis==SCROLL_X) ? getDisplayXSize() : getDisplayYSize();
+	if (first>last)
+		swap(int, first, last);
+	if ((first<0) or (last>=size))
+		return false;
+
+	// Lines are numbered the other way around in landscape mode on 
+	// controllers that scroll along the portrait Y axis
+	lines = _scroll_lines();
+	_scroll_rev = (axis==SCROLL_X) and (orient==LANDSCAPE);
+	_scroll_first = first;
+	_scroll_len = last-first+1;
+	_scroll_top = _scroll_rev ? lines-1-last : first;
+
+	cbi(P_CS, B_CS);
+	LCD_Write_COM(0x33);
+	LCD_Write_DATA(_scroll_top>>8);
+	LCD_Write_DATA(_scroll_top);
+	LCD_Write_DATA(_scroll_len>>8);
+	LCD_Write_DATA(_scroll_len);
+	LCD_Write_DATA((lines-_scroll_top-_scroll_len)>>8);
+	LCD_Write_DATA(lines-_scroll_top-_scroll_len);
+	sbi(P_CS, B_CS);
+	scrollTo(0);
+	return true;
+}
+
+// Shows the scroll area starting offset lines into it. After scrollTo(n)
+// the line at first+n is shown at first, and the first n lines of the 
+// area are shown at its end.
+void UTFT::scrollTo(int offset)
+{
+	int	vsp;
+
+	if ((getScrollAxis()==SCROLL_NONE) or (_scroll_len==0))
+		return;
+	offset %= _scroll_len;
+	if (offset<0)
+		offset += _scroll_len;
+	if (_scroll_rev)
+		vsp = _scroll_top + ((_scroll_len-offset) % _scroll_len);
+	else
+		vsp = _scroll_top + offset;
+
+	cbi(P_CS, B_CS);
+	LCD_Write_COM(0x37);
+	LCD_Write_DATA(vsp>>8);
+	LCD_Write_DATA(vsp);
+	sbi(P_CS, B_CS);
+}
+
+void UTFT::waitForDMA()
+{
+#if defined(UTFT_SPI_DMA)
+	if (_dma)
+		_dma_sync();
+#endif
+}
+
+#if defined(UTFT_BUS_STATS)
+void UTFT::resetBusStats()
+{
+	bus_com=0;
+	bus_data=0;
+}
+#endif
+
+#if defined(UTFT_PROFILE)
+static const char _prim_names[] PROGMEM = "(other)\0clrScr\0fillScr\0drawPixel\0drawLine\0"
+	"drawRect\0drawRoundRect\0fillRect\0fillRoundRect\0drawCircle\0fillCircle\0"
+	"fillEllipse\0drawArc\0fillArc\0print\0printNumI\0printNumF\0drawBitmap\0"
+	"drawPackedBitmap\0pushPixels\0blit\0drawBitmapStream\0fillTriangle\0fillPolygon\0"
+	"drawPolyline";
+
+// The DWT cycle counter is started here, as nothing else on the Due or
+// Teensy 3.x turns it on
+void UTFT::resetProfile()
+{
+	for (int i=0; i<PRIM_COUNT; i++)
+	{
+		profile[i].calls=0;
+		profile[i].pixels=0;
+		profile[i].windows=0;
+		profile[i].time=0;
+	}
+	_prof_pixels=0;
+	_prof_windows=0;
+#if defined(UTFT_PROFILE_CYCLES)
+	UTFT_DEMCR|=UTFT_DEMCR_TRCENA;
+	UTFT_DWT_CTRL|=UTFT_DWT_CYCCNTENA;
+#endif
+}
+
+// One line of tab separated values for every primitive that was called
+void UTFT::printProfile(Print &out)
+{
+	const char	*name=_prim_names;
+
+	out.print("Primitive\tCalls\tPixels\tsetXY\t");
+	out.println(UTFT_PROFILE_UNIT);
+	for (int i=0; i<PRIM_COUNT; i++)
+	{
+		if (profile[i].calls>0)
+		{
+			for (const char *c=name; pgm_read_byte(c)!=0; c++)
+				out.print(char(pgm_read_byte(c)));
+			out.print('\t');
+			out.print(profile[i].calls);
+			out.print('\t');
+			out.print(profile[i].pixels);
+			out.print('\t');
+			out.print(profile[i].windows);
+			out.print('\t');
+			out.println(profile[i].time);
+		}
+		while (pgm_read_byte(name++)!=0);
+	}
+}
+#endif
+
+#if defined(UTFT_BUS_TRACE)
+// The trace starts with the display model, so a sink set before InitLCD()
+// records everything needed to replay the session
+void UTFT::setBusTrace(void (*sink)(const uint8_t *data, int len))
+{
+	flushBusTrace();
+	_trace_sink=sink;
+	_trace_len=0;
+	_trace_run=-1;
+	_trace_event(TRACE_INIT, display_model | (orient==LANDSCAPE ? 0x80 : 0));
+}
+
+void UTFT::flushBusTrace()
+{
+	if ((_trace_sink) and (_trace_len>0))
+		_trace_sink(_trace_buf, _trace_len);
+	_trace_len=0;
+	_trace_run=-1;
+}
+
+void UTFT::markBusFrame()
+{
+	_trace_event(TRACE_FRAME);
+}
+
+void UTFT::_trace_byte(uint8_t b)
+{
+	if (_trace_len==UTFT_TRACE_BUFFER)
+		flushBusTrace();
+	_trace_buf[_trace_len++]=b;
+}
+
+void UTFT::_trace_event(uint8_t tag, int arg)
+{
+	if (_trace_sink==0)
+		return;
+	_trace_run=-1;
+	_trace_byte(tag);
+	if (arg>=0)
+		_trace_byte(arg);
+}
+
+// Consecutive data writes of the same size share one event. _trace_run is
+// the position of the count in the buffer, so a run ends when the buffer
+// is flushed.
+void UTFT::_trace_data(uint8_t tag, uint8_t VH, uint8_t VL)
+{
+	if (_trace_sink==0)
+		return;
+	if ((_trace_run<0) or (_trace_buf[_trace_run-1]!=tag) or (_trace_buf[_trace_run]==255))
+	{
+		if (_trace_len>UTFT_TRACE_BUFFER-2)
+			flushBusTrace();
+		_trace_buf[_trace_len++]=tag;
+		_trace_buf[_trace_len++]=1;
+		_trace_run=_trace_len-1;
+	}
+	else
+		_trace_buf[_trace_run]++;
+	if (tag==TRACE_DATA16)
+		_trace_byte(VH);
+	_trace_byte(VL);
+}
+
+void UTFT::_trace_fill(uint8_t tag, byte ch, byte cl, long pix)
+{
+#if defined(UTFT_PROFILE)
+	_prof_pixels+=pix;
+#endif
+	if ((_trace_sink==0) or (pix<=0))
+		return;
+	_trace_event(tag, ch);
+	if (tag!=TRACE_FILL8)
+		_trace_byte(cl);
+	while (pix>0x7F)
+	{
+		_trace_byte((pix & 0x7F) | 0x80);
+		pix>>=7;
+	}
+	_trace_byte(pix);
+}
+#endif
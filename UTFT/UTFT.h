@@ -147,6 +147,180 @@
 
 #define NOTINUSE		255
 
+// Scroll axis returned by getScrollAxis()
+#define SCROLL_NONE		0
+#define SCROLL_X		1
+#define SCROLL_Y		2
+
+// Packed bitmap formats for drawPackedBitmap() and drawBitmapStream()
+#define BITMAP_RLE565	1
+#define BITMAP_PAL1		2
+#define BITMAP_PAL2		3
+#define BITMAP_PAL4		4
+#define BITMAP_PAL8		5
+#define BITMAP_PALRLE	6
+#define BITMAP_RAW565	7
+#define BITMAP_BMP		8
+
+// Bus trace events. Counts are sent 7 bits at a time, least significant
+// bits first, with bit 7 set when more bytes follow.
+#define TRACE_INIT		0x01	// Model, bit 7 set in landscape mode
+#define TRACE_COM		0x02	// Command byte
+#define TRACE_DATA8		0x03	// Count (1-255), data bytes
+#define TRACE_DATA16	0x04	// Count (1-255), data words (high byte first)
+#define TRACE_PIXELS	0x05	// Color (high, low), count: _write_pixels()
+#define TRACE_FILL16	0x06	// Color (high, low), count: _fast_fill_16()
+#define TRACE_FILL8		0x07	// Color byte, count: _fast_fill_8()
+#define TRACE_BEGIN		0x08	// Primitive
+#define TRACE_END		0x09
+#define TRACE_FRAME		0x0A
+
+// Primitives marked in the bus trace and counted by the profiler
+#define PRIM_CLRSCR				1
+#define PRIM_FILLSCR			2
+#define PRIM_DRAWPIXEL			3
+#define PRIM_DRAWLINE			4
+#define PRIM_DRAWRECT			5
+#define PRIM_DRAWROUNDRECT		6
+#define PRIM_FILLRECT			7
+#define PRIM_FILLROUNDRECT		8
+#define PRIM_DRAWCIRCLE			9
+#define PRIM_FILLCIRCLE			10
+#define PRIM_FILLELLIPSE		11
+#define PRIM_DRAWARC			12
+#define PRIM_FILLARC			13
+#define PRIM_PRINT				14
+#define PRIM_PRINTNUMI			15
+#define PRIM_PRINTNUMF			16
+#define PRIM_DRAWBITMAP			17
+#define PRIM_DRAWPACKEDBITMAP	18
+#define PRIM_PUSHPIXELS			19
+#define PRIM_BLIT				20
+#define PRIM_DRAWBITMAPSTREAM	21
+#define PRIM_FILLTRIANGLE		22
+#define PRIM_FILLPOLYGON		23
+#define PRIM_DRAWPOLYLINE		24
+#define PRIM_COUNT				25
+
+// Uncomment the following line to count the number of commands and data 
+// bytes sent through LCD_Write_COM() and LCD_Write_DATA(). This is only
+// meant for benchmarking (see the UTFT_Line_Benchmark example) as it adds
+// a small overhead to every bus write.
+//#define UTFT_BUS_STATS 1
+
+// Uncomment the following line to record everything sent to the display
+// as a compact binary trace (see setBusTrace()). Events are collected in
+// a buffer of UTFT_TRACE_BUFFER bytes which is handed to the sink when it
+// is full or when flushBusTrace() is called. The trace can be replayed and
+// analysed on a PC with the UTFT_Host_BusTrace example.
+//#define UTFT_BUS_TRACE 1
+#if !defined(UTFT_TRACE_BUFFER)
+	#define UTFT_TRACE_BUFFER		64
+#endif
+
+// Uncomment the following line to keep a table of the calls, pixels,
+// setXY() calls and time of every public drawing function (the PRIM_
+// values above) in profile[]. The time is in CPU cycles on the Arduino
+// Due and Teensy 3.x and in microseconds elsewhere (see UTFT_PROFILE_UNIT).
+// The table takes 16 bytes of RAM for every primitive and can be printed
+// with printProfile() (see the UTFT_Profile example).
+//#define UTFT_PROFILE 1
+
+// Uncomment the following line to blend the edges of proportional fonts
+// with more than 1 bit per pixel (see the FontConverter tool) between the
+// front and back color. The blend table takes 37 bytes of RAM. Without it
+// such fonts are drawn like 1 bit fonts, with the pixels of at least half
+// coverage in the front color.
+//#define UTFT_AA_FONTS 1
+
+// Serial modules use the hardware SPI port of the Arduino Due and Teensy 
+// 3.x when the SDA and SCL pins given to the constructor are the MOSI and
+// SCK pins of the board. Uncomment the following line to also send pixel
+// data for SERIAL_5PIN modules with DMA. Data is then collected in two 
+// buffers of UTFT_DMA_BUFFER bytes, and one buffer is sent while the 
+// other is being filled. CS is kept low between drawing operations, so 
+// call waitForDMA() before using other devices on the same SPI bus.
+//#define UTFT_SPI_DMA 1
+#if !defined(UTFT_DMA_BUFFER)
+	#define UTFT_DMA_BUFFER			640
+#endif
+
+// Sketches that only use one display model can fix the model at compile
+// time by uncommenting the following line and setting it to the model 
+// passed to the constructor. The controller and bus width are then known
+// when the library is compiled, so setXY() and the bus writes are reduced
+// to the code for that model, and support for all other controllers is 
+// left out. memorysaver.h is not used when UTFT_MODEL is defined, and the
+// model passed to the constructor is then ignored.
+//#define UTFT_MODEL	ITDB32S
+
+// printChar() can keep the most recently used glyphs pre-expanded to
+// RGB565 for the current colors. Uncomment the following line to enable
+// the cache. UTFT_GLYPH_CACHE sets the number of glyphs in the cache and
+// UTFT_GLYPH_CACHE_PIXELS the largest glyph (width*height) that will be
+// cached. Each glyph uses UTFT_GLYPH_CACHE_PIXELS*2+16 bytes of RAM in
+// every UTFT instance. The setting must be made here, as a #define in the
+// sketch does not change how UTFT.cpp is compiled.
+//#define UTFT_GLYPH_CACHE		4
+#if !defined(UTFT_GLYPH_CACHE)
+	#define UTFT_GLYPH_CACHE		0
+#endif
+#if !defined(UTFT_GLYPH_CACHE_PIXELS)
+	#define UTFT_GLYPH_CACHE_PIXELS	256
+#endif
+
+// printNumI() and printNumF() can redraw only the characters that changed
+// since the last number drawn at the same place (see setNumDiff()). 
+// Uncomment the following line to enable the digit diff mode.
+// UTFT_NUM_DIFF sets the number of places that are remembered and 
+// UTFT_NUM_DIFF_CHARS the longest number. Each place uses 
+// UTFT_NUM_DIFF_CHARS+10 bytes of RAM.
+//#define UTFT_NUM_DIFF		4
+#if !defined(UTFT_NUM_DIFF)
+	#define UTFT_NUM_DIFF		0
+#endif
+#if !defined(UTFT_NUM_DIFF_CHARS)
+	#define UTFT_NUM_DIFF_CHARS	12
+#endif
+
+// With double buffering (see beginDoubleBuffer()) swapBuffers() has the
+// whole page repaired after every swap. Uncomment the following line to
+// keep the areas drawn in each frame as up to UTFT_DIRTY_RECTS rectangles
+// and only repair those. When more areas are drawn, the two rectangles
+// that are closest are merged. Each rectangle uses 8 bytes of RAM.
+//#define UTFT_DIRTY_RECTS	4
+#if !defined(UTFT_DIRTY_RECTS)
+	#define UTFT_DIRTY_RECTS	0
+#endif
+
+// waitForVSync() gives up when the TE pin (see setTearPin()) has not gone
+// from low to high within UTFT_VSYNC_TIMEOUT microseconds, about two frames
+// at 50 Hz.
+#if !defined(UTFT_VSYNC_TIMEOUT)
+	#define UTFT_VSYNC_TIMEOUT	40000UL
+#endif
+
+// fillPolygon() keeps the edges of the polygon on the stack, so polygons
+// with more than UTFT_POLY_POINTS points are not drawn and fillPolygon()
+// returns false for them. Each point uses 18 bytes.
+#if !defined(UTFT_POLY_POINTS)
+	#if defined(__AVR__)
+		#define UTFT_POLY_POINTS	12
+	#else
+		#define UTFT_POLY_POINTS	64
+	#endif
+#endif
+
+// drawBitmapStream() reads UTFT_STREAM_CHUNK pixels from the stream at a
+// time into a buffer of UTFT_STREAM_CHUNK*3 bytes on the stack.
+#if !defined(UTFT_STREAM_CHUNK)
+	#if defined(__AVR__)
+		#define UTFT_STREAM_CHUNK	16
+	#else
+		#define UTFT_STREAM_CHUNK	64
+	#endif
+#endif
+
 //*********************************
 // COLORS
 //*********************************
@@ -169,7 +343,9 @@
 #define VGA_PURPLE		0x8010
 #define VGA_TRANSPARENT	0xFFFFFFFF
 
-#if defined(__AVR__)
+#if defined(UTFT_HOST)
+	#include "hardware/host/HW_Host_defines.h"
+#elif defined(__AVR__)
 	#include "Arduino.h"
 	#include "hardware/avr/HW_AVR_defines.h"
 #elif defined(__PIC32MX__)
@@ -180,6 +356,38 @@
 	#include "hardware/arm/HW_ARM_defines.h"
 #endif
 
+#if defined(UTFT_MODEL)
+	#if (UTFT_MODEL==ILI9325C) || (UTFT_MODEL==ILI9325D_8) || (UTFT_MODEL==HX8340B_8) || (UTFT_MODEL==S6D1121_8) || (UTFT_MODEL==SSD1289_8) || (UTFT_MODEL==S6D0164)
+		#define UTFT_TRANSFER_MODE	8
+	#elif (UTFT_MODEL==HX8340B_S) || (UTFT_MODEL==ILI9341_S4P)
+		#define UTFT_TRANSFER_MODE	1
+		#define UTFT_SERIAL_MODE	SERIAL_4PIN
+	#elif (UTFT_MODEL==ST7735) || (UTFT_MODEL==PCF8833) || (UTFT_MODEL==ST7735S) || (UTFT_MODEL==ILI9341_S5P) || (UTFT_MODEL==HX8353C) || (UTFT_MODEL==ST7735_ALT)
+		#define UTFT_TRANSFER_MODE	1
+		#define UTFT_SERIAL_MODE	SERIAL_5PIN
+	#elif (UTFT_MODEL==SSD1289LATCHED)
+		#define UTFT_TRANSFER_MODE	LATCHED_16
+	#else
+		#define UTFT_TRANSFER_MODE	16
+	#endif
+	#if !defined(UTFT_SERIAL_MODE)
+		#define UTFT_SERIAL_MODE	0
+	#endif
+	#define UTFT_BUS_MODE(mode)		((void)(mode), UTFT_TRANSFER_MODE)
+#else
+	#define UTFT_BUS_MODE(mode)		(mode)
+#endif
+
+#if defined(UTFT_SPI_DMA) && !defined(UTFT_HW_SPI)
+	#undef UTFT_SPI_DMA
+#endif
+
+#if defined(UTFT_PROFILE_CYCLES)
+	#define UTFT_PROFILE_UNIT	"cycles"
+#else
+	#define UTFT_PROFILE_UNIT	"us"
+#endif
+
 struct _current_font
 {
 	uint8_t* font;
@@ -187,8 +395,86 @@ struct _current_font
 	uint8_t y_size;
 	uint8_t offset;
 	uint8_t numchars;
+	uint8_t bpp;
+};
+
+// Proportional fonts start with a 0 where fixed width fonts store the
+// character width:
+//   0     0x00
+//   1     Line height
+//   2     First character
+//   3     Number of characters
+//   4     Bits per pixel (1, 2 or 4)
+//   5     Largest advance (returned by getFontXsize())
+//   6     Baseline (pixels from the top of the line)
+//   7     Number of kerning pairs
+//   8     Glyph table, 8 bytes per character: bitmap offset from the start
+//         of the font (24 bits, LSB first), width, height, x offset 
+//         (signed), y offset from the top of the line, advance
+//   ...   Kerning pairs, 3 bytes each sorted by characters: left, right,
+//         adjustment (signed)
+//   ...   Glyph bitmaps. Rows start on a new byte, leftmost pixel in the
+//         most significant bits. 0 is background and the largest value 
+//         is foreground.
+// Fonts in this format can be made with the FontConverter tool.
+struct _prop_glyph
+{
+	long	offset;
+	uint8_t	w, h;
+	int8_t	xoff;
+	uint8_t	yoff, advance;
+	int		x;
+};
+
+// A number ready to be drawn one character at a time
+struct _num_format
+{
+	unsigned long	value;
+	byte			digits, dec, len, pad;
+	boolean			neg, sign_first;
+	char			divider, filler;
 };
 
+#if defined(UTFT_PROFILE)
+struct _prim_stats
+{
+	unsigned long	calls;
+	unsigned long	pixels;
+	unsigned long	windows;		// setXY() and clrXY() calls
+	unsigned long	time;			// In UTFT_PROFILE_UNIT
+};
+#endif
+
+struct _dirty_rect
+{
+	int		x1, y1, x2, y2;
+};
+
+#if UTFT_NUM_DIFF>0
+struct _num_diff_entry
+{
+	int		x, y;
+	uint8_t* font;
+	uint16_t fg;
+	uint16_t bg;
+	byte	len;
+	char	st[UTFT_NUM_DIFF_CHARS];
+};
+#endif
+
+#if UTFT_GLYPH_CACHE>0
+struct _glyph_cache_entry
+{
+	uint8_t* font;
+	uint8_t c;
+	uint8_t orient;
+	uint16_t fg;
+	uint16_t bg;
+	unsigned long age;
+	uint16_t pixels[UTFT_GLYPH_CACHE_PIXELS];
+};
+#endif
+
 class UTFT
 {
 	public:
@@ -206,6 +492,12 @@ class UTFT
 		void	fillRoundRect(int x1, int y1, int x2, int y2);
 		void	drawCircle(int x, int y, int radius);
 		void	fillCircle(int x, int y, int radius);
+		void	fillEllipse(int x, int y, int rx, int ry);
+		void	drawArc(int x, int y, int radius, int startAngle, int endAngle);
+		void	fillArc(int x, int y, int outerRadius, int innerRadius, int startAngle, int endAngle);
+		void	fillTriangle(int x1, int y1, int x2, int y2, int x3, int y3);
+		boolean	fillPolygon(const int *x, const int *y, int n, byte frac=0);
+		void	drawPolyline(const int *x, const int *y, int n, boolean closed=false);
 		void	setColor(byte r, byte g, byte b);
 		void	setColor(word color);
 		word	getColor();
@@ -216,12 +508,23 @@ class UTFT
 		void	print(String st, int x, int y, int deg=0);
 		void	printNumI(long num, int x, int y, int length=0, char filler=' ');
 		void	printNumF(double num, byte dec, int x, int y, char divider='.', int length=0, char filler=' ');
+		void	setNumDiff(boolean enable);
 		void	setFont(uint8_t* font);
 		uint8_t* getFont();
 		uint8_t	getFontXsize();
 		uint8_t	getFontYsize();
+		int		getTextWidth(char *st);
 		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale=1);
 		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy);
+		void	drawPackedBitmap(int x, int y, uint8_t* data);
+		boolean	drawBitmapStream(Stream &s, int x, int y, int sx, int sy, byte format=BITMAP_RAW565);
+		void	pushPixels888(int x, int y, int sx, int sy, const uint8_t *data, boolean dither=false);
+		void	pushPixelsGray8(int x, int y, int sx, int sy, const uint8_t *data, boolean dither=false);
+		void	blit(bitmapdatatype sheet, int sheetWidth, int srcX, int srcY, int w, int h, int dstX, int dstY);
+		void	setBlitClip(int x1, int y1, int x2, int y2);	// Only blit() is clipped
+		void	clrBlitClip();
+		void	setColorKey(word color);
+		void	clrColorKey();
 		void	lcdOff();
 		void	lcdOn();
 		void	setContrast(char c);
@@ -230,6 +533,28 @@ class UTFT
 		void	setBrightness(byte br);
 		void	setDisplayPage(byte page);
 		void	setWritePage(byte page);
+		byte	getPageCount();
+		boolean	beginDoubleBuffer();
+		void	endDoubleBuffer();
+		void	swapBuffers(void (*repair)(int x1, int y1, int x2, int y2)=0);
+		void	setTearPin(int pin);
+		void	waitForVSync();
+		void	waitForDMA();
+		byte	getScrollAxis();
+		boolean	setScrollArea(int first, int last);
+		void	scrollTo(int offset);
+#if defined(UTFT_BUS_STATS)
+		void	resetBusStats();
+#endif
+#if defined(UTFT_BUS_TRACE)
+		void	setBusTrace(void (*sink)(const uint8_t *data, int len));
+		void	flushBusTrace();
+		void	markBusFrame();
+#endif
+#if defined(UTFT_PROFILE)
+		void	resetProfile();
+		void	printProfile(Print &out);
+#endif
 
 /*
 	The functions and variables below should not normally be used.
@@ -242,12 +567,71 @@ class UTFT
 		byte			fch, fcl, bch, bcl;
 		byte			orient;
 		long			disp_x_size, disp_y_size;
+#if defined(UTFT_MODEL)
+		static const byte	display_model = UTFT_MODEL;
+		static const byte	display_transfer_mode = UTFT_TRANSFER_MODE;
+		static const byte	display_serial_mode = UTFT_SERIAL_MODE;
+#else
 		byte			display_model, display_transfer_mode, display_serial_mode;
+#endif
 		regtype			*P_RS, *P_WR, *P_CS, *P_RST, *P_SDA, *P_SCL, *P_ALE;
 		regsize			B_RS, B_WR, B_CS, B_RST, B_SDA, B_SCL, B_ALE;
 		byte			__p1, __p2, __p3, __p4, __p5;
 		_current_font	cfont;
 		boolean			_transparent;
+		int				_scroll_first, _scroll_len, _scroll_top;
+#if defined(UTFT_AA_FONTS)
+		word			_aa_lut[16], _aa_fg, _aa_bg;
+		byte			_aa_levels;
+#endif
+		boolean			_scroll_rev;
+		boolean			_dbuf;
+		byte			_page_show, _page_write;
+		int				_te_pin;
+		int				_clip_x1, _clip_y1, _clip_x2, _clip_y2;
+		boolean			_clip, _key;
+		word			_color_key;
+#if UTFT_DIRTY_RECTS>0
+		_dirty_rect		_dirty[UTFT_DIRTY_RECTS];
+		byte			_dirty_n;
+#endif
+		word			_win_x1, _win_y1, _win_x2, _win_y2;
+		boolean			_win_valid;
+#if defined(UTFT_BUS_STATS)
+		unsigned long	bus_com, bus_data;
+#endif
+#if defined(UTFT_BUS_TRACE)
+		void			(*_trace_sink)(const uint8_t *data, int len);
+		uint8_t			_trace_buf[UTFT_TRACE_BUFFER];
+		int				_trace_len, _trace_run;
+#endif
+#if defined(UTFT_PROFILE)
+		_prim_stats		profile[PRIM_COUNT];
+		unsigned long	_prof_pixels, _prof_windows;
+#endif
+#if defined(UTFT_BUS_TRACE) || defined(UTFT_PROFILE)
+		byte			_prim_depth;
+#endif
+#if UTFT_NUM_DIFF>0
+		_num_diff_entry	_num_diff[UTFT_NUM_DIFF];
+		byte			_num_diff_next;
+		boolean			_num_diff_on;
+#endif
+#if UTFT_GLYPH_CACHE>0
+		_glyph_cache_entry	_glyph_cache[UTFT_GLYPH_CACHE];
+		unsigned long		_glyph_clock;
+#endif
+#if defined(UTFT_HW_SPI)
+		boolean			_hw_spi;
+#endif
+#if defined(UTFT_SPI_DMA)
+		regtype			*P_SPI_CS, _cs_shadow;
+		regsize			B_SPI_CS;
+		boolean			_dma;
+		uint8_t			_dma_buf[2][UTFT_DMA_BUFFER];
+		int				_dma_len;
+		byte			_dma_cur;
+#endif
 
 		void LCD_Writ_Bus(char VH,char VL, byte mode);
 		void LCD_Write_COM(char VL);
@@ -255,17 +639,74 @@ class UTFT
 		void LCD_Write_DATA(char VL);
 		void LCD_Write_COM_DATA(char com1,int dat1);
 		void _hw_special_init();
+		void _init_table(const uint8_t *table);
 		void setPixel(word color);
 		void drawHLine(int x, int y, int l);
 		void drawVLine(int x, int y, int l);
+		void _fill_run(int x1, int y1, int x2, int y2);
 		void printChar(byte c, int x, int y);
+		void _print_prop(char *st, int x, int y);
+		void _print_num(_num_format *f, int x, int y);
+		void _clear_num_diff();
+		void _prop_get_glyph(byte c, _prop_glyph *g);
+		int _prop_kerning(byte left, byte right);
+		byte _prop_alpha(_prop_glyph *g, int col, int row);
+#if defined(UTFT_AA_FONTS)
+		void _prop_lut();
+#endif
+		void _prop_cell(int x1, int x2, int y, _prop_glyph *prev, _prop_glyph *cur, _prop_glyph *next);
+		boolean _font_bit(word temp, int px);
+		void _glyph_row(word temp, boolean reverse);
+#if UTFT_GLYPH_CACHE>0
+		_glyph_cache_entry* _glyph_lookup(byte c, word temp);
+#endif
+		void _write_pixels(byte ch, byte cl, long pix);
+		void _write_words(const uint16_t *data, long pix, int stride=1);
+		void _push_rect(int x1, int y1, int x2, int y2, const uint16_t *data);
 		void setXY(word x1, word y1, word x2, word y2);
+		void _set_window(word x1, word y1, word x2, word y2);
+#if UTFT_DIRTY_RECTS>0
+		void _mark_dirty(int x1, int y1, int x2, int y2);
+#endif
 		void clrXY();
 		void rotateChar(byte c, int x, int y, int pos, int deg);
+		int _sin_deg(int deg);
+		long _rotated_sample(long su, long sv, int ox, int oy, int sx, int sy, bitmapdatatype data, word glyph);
+#if defined(UTFT_HW_SPI)
+		boolean _spi_pins(int sda, int scl);
+		void _spi_begin();
+		void _spi_bus(char VH, char VL);
+		void _spi_write(char VH, char VL);
+#endif
+#if defined(UTFT_SPI_DMA)
+		void _dma_start(const uint8_t *buf, int len);
+		boolean _dma_busy();
+		void _dma_flush();
+		void _dma_sync();
+#endif
+		void _circle_runs(int x, int y, int xs, int xe, int yy);
+		void _arc_span(int x, int y, int l, int r, int dy, long ax, long ay, long bx, long by, byte mode);
+		void _clip_run(int x1, int x2, int y);
+		void _write_run(byte ch, byte cl, long pix);
+		int _scroll_lines();
+		void _packed_span(int n, uint8_t* data, byte format, uint8_t* palette);
+		void _stream_span(int x, int y, int n, const uint16_t *data);
+		void _push_converted(int x, int y, int sx, int sy, const uint8_t *data, byte bpp, boolean dither);
+		void _convert_888(uint16_t *dst, const uint8_t *src, int n, const uint8_t *dither);
+		void _convert_gray8(uint16_t *dst, const uint8_t *src, int n, const uint8_t *dither);
+		void _write_sheet(bitmapdatatype data, int n, long step);
+		void _draw_rotated(int cx, int cy, int ox, int oy, int sx, int sy, int deg, bitmapdatatype data, word glyph);
 		void _set_direction_registers(byte mode);
 		void _fast_fill_16(int ch, int cl, long pix);
 		void _fast_fill_8(int ch, long pix);
+		void _fast_serial(const uint16_t *data, long pix, int stride);
 		void _convert_float(char *buf, double num, int width, byte prec);
+#if defined(UTFT_BUS_TRACE)
+		void _trace_byte(uint8_t b);
+		void _trace_event(uint8_t tag, int arg=-1);
+		void _trace_data(uint8_t tag, uint8_t VH, uint8_t VL);
+		void _trace_fill(uint8_t tag, byte ch, byte cl, long pix);
+#endif
 
 #if defined(ENERGIA)
 		volatile uint32_t* portOutputRegister(int value);
@@ -0,0 +1,92 @@
+// UTFT_BusTrace 
+//
+// This program records everything that is sent to the display while a
+// few frames of a simple dashboard are drawn, and sends the trace to the
+// serial port as binary data at 115200 baud.
+//
+// Save the data to a file on the PC, for example on Linux with:
+//   stty -F /dev/ttyACM0 115200 raw
+//   cat /dev/ttyACM0 > capture.bin
+// and reset the board. The trace ends when the display stops changing.
+// The file can then be replayed and analysed with the UTFT_Host_BusTrace
+// example (in the Host (Linux) folder):
+//   ./bustrace capture.bin
+// which prints the bytes sent by each primitive, the number of windows
+// set up per frame and the number of pixels written with the value they
+// already had.
+//
+// Drawing is slower while the trace is sent, as the serial port can not
+// keep up with the display.
+//
+// This program requires the UTFT library, and the line
+//   #define UTFT_BUS_TRACE 1
+// in UTFT.h must be uncommented.
+//
+
+#include <UTFT.h>
+
+#if !defined(UTFT_BUS_TRACE)
+  #error "Please uncomment the UTFT_BUS_TRACE define in UTFT.h"
+#endif
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+// Uncomment the line for your display:
+//UTFT myGLCD(ITDB32S,38,39,40,41);                // ITead ITDB02-3.2S
+//UTFT myGLCD(MI0283QT9,11,13,7,8);                // Watterott MI0283QT9
+//UTFT myGLCD(DMTFT28105,MOSI,SCK,10,NOTINUSE,9);  // DisplayModule DM-TFT28-105
+UTFT myGLCD(TFT22SHLD,3,4,7,5,6);                  // ElecFreaks TFT2.2SP Shield
+
+void sendTrace(const uint8_t *data, int len)
+{
+  Serial.write(data, len);
+}
+
+void drawFrame(int frame)
+{
+  int w = myGLCD.getDisplayXSize(), h = myGLCD.getDisplayYSize();
+  int cx = w/2, cy = h/2, r = min(w, h)/4;
+  int angle = (frame*12) % 360;
+
+  myGLCD.setColor(VGA_NAVY);
+  myGLCD.fillRect(0, 0, w-1, 17);
+  myGLCD.setFont(SmallFont);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_NAVY);
+  myGLCD.print("Bus trace", CENTER, 3);
+
+  myGLCD.setColor(VGA_BLACK);
+  myGLCD.fillCircle(cx, cy, r);
+  myGLCD.setColor(VGA_YELLOW);
+  myGLCD.drawArc(cx, cy, r, 0, angle);
+  myGLCD.setColor(VGA_RED);
+  myGLCD.drawLine(cx, cy, cx+int(r*sin(angle*0.0175)), cy-int(r*cos(angle*0.0175)));
+
+  myGLCD.setFont(BigFont);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+  myGLCD.printNumF(20.0+(frame*0.25), 2, CENTER, h-40, '.', 6);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  // Start the trace before InitLCD() so it can be replayed exactly
+  myGLCD.setBusTrace(sendTrace);
+  myGLCD.InitLCD();
+  myGLCD.clrScr();
+  for (int i=0; i<10; i++)
+  {
+    drawFrame(i);
+    myGLCD.markBusFrame();
+  }
+  myGLCD.flushBusTrace();
+  myGLCD.setBusTrace(0);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,77 @@
+// UTFT_CPLD_DoubleBuffer 
+//
+// This program is a demo of double buffering on CPLD-based display modules.
+// Every frame is drawn on a hidden page and shown with swapBuffers(), so
+// the ball moves without flicker.
+//
+// This demo was made for modules with a screen resolution 
+// of 800x480 pixels.
+//
+// This program requires the UTFT library. Uncomment the UTFT_DIRTY_RECTS
+// line in UTFT.h so that only the areas drawn are repaired after every
+// swap instead of the whole page.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+// Set the pins to the correct ones for your development shield
+// ------------------------------------------------------------
+// Standard Arduino Mega/Due shield            : <display model>,38,39,40,41
+// CTE TFT LCD/SD Shield for Arduino Due       : <display model>,25,26,27,28
+// Teensy 3.x TFT Test Board                   : <display model>,23,22, 3, 4
+// ElecHouse TFT LCD/SD Shield for Arduino Due : <display model>,22,23,31,33
+//
+// Remember to change the model parameter to suit your display module!
+UTFT myGLCD(EHOUSE50CPLD,22,23,31,33);
+
+// If the TE (tearing effect) output of your module is connected, set the
+// pin here to change pages while the panel is not being refreshed.
+#define TEAR_PIN NOTINUSE
+
+int  x = 100, y = 100, dx = 5, dy = 3;
+long frame = 0;
+
+// Draws any part of the background. swapBuffers() calls this for the 
+// areas that were drawn on the other page.
+void drawBackground(int x1, int y1, int x2, int y2)
+{
+  word color = myGLCD.getColor();
+
+  myGLCD.setColor(0, 0, 64);
+  myGLCD.fillRect(x1, y1, x2, y2);
+  myGLCD.setColor(color);
+}
+
+void setup()
+{
+  myGLCD.InitLCD();
+  myGLCD.setFont(BigFont);
+  myGLCD.setTearPin(TEAR_PIN);
+  myGLCD.beginDoubleBuffer();
+  drawBackground(0, 0, 799, 479);
+}
+
+void loop()
+{
+  // Remove the ball and draw it at the new position, just as without 
+  // double buffering
+  drawBackground(x-20, y-20, x+20, y+20);
+  x += dx;
+  y += dy;
+  if ((x<20) or (x>779))
+    dx = -dx;
+  if ((y<60) or (y>459))
+    dy = -dy;
+  myGLCD.setColor(VGA_YELLOW);
+  myGLCD.fillCircle(x, y, 20);
+
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+  myGLCD.print("Frame:", 10, 10);
+  myGLCD.printNumI(frame++, 114, 10, 6);
+
+  myGLCD.swapBuffers(drawBackground);
+}
@@ -0,0 +1,167 @@
+// UTFT_Circle_Benchmark 
+//
+// This program compares the span-based fillCircle() and drawCircle()
+// with the old versions that tested every pixel of the bounding square
+// and set a window for every pixel. For radii from 5 to 200 pixels it
+// reports the time used in microseconds and CPU cycles. The new 
+// fillEllipse() and fillArc() are timed as well.
+//
+// This demo was made for modules with a screen resolution of 320x240 
+// pixels, but will work with any module. The largest circles are 
+// partly outside the screen on small modules.
+//
+// This program requires the UTFT library.
+//
+// The results are printed to the serial monitor at 115200 baud.
+//
+
+#include <UTFT.h>
+
+// Uncomment the line for your display:
+//UTFT myGLCD(MI0283QT9,11,13,7,8);                // Watterott MI0283QT9
+//UTFT myGLCD(DMTFT28105,MOSI,SCK,10,NOTINUSE,9);  // DisplayModule DM-TFT28-105
+//UTFT myGLCD(TFT01_22SP,9,8,12,11,10);            // ElecFreaks TFT01-2.2SP
+//UTFT myGLCD(TFT01_24SP,9,8,12,11,10);            // ElecFreaks TFT01-2.4SP
+UTFT myGLCD(TFT22SHLD,3,4,7,5,6);                  // ElecFreaks TFT2.2SP Shield
+
+int radii[] = {5, 10, 25, 50, 100, 150, 200};
+
+// The fillCircle() used before it was changed to send spans
+void fillCircleOld(int x, int y, int radius)
+{
+  for(int y1=-radius; y1<=0; y1++) 
+    for(int x1=-radius; x1<=0; x1++)
+      if(x1*x1+y1*y1 <= radius*radius) 
+      {
+        myGLCD.drawHLine(x+x1, y+y1, 2*(-x1));
+        myGLCD.drawHLine(x+x1, y-y1, 2*(-x1));
+        break;
+      }
+}
+
+// The drawCircle() used before it was changed to send runs.
+// Every pixel gets its own window.
+void drawCircleOld(int x, int y, int radius)
+{
+  int f = 1 - radius;
+  int ddF_x = 1;
+  int ddF_y = -2 * radius;
+  int x1 = 0;
+  int y1 = radius;
+  int px[8], py[8];
+
+  cbi(myGLCD.P_CS, myGLCD.B_CS);
+  myGLCD.setXY(x, y + radius, x, y + radius);
+  myGLCD.LCD_Write_DATA(myGLCD.fch, myGLCD.fcl);
+  myGLCD.setXY(x, y - radius, x, y - radius);
+  myGLCD.LCD_Write_DATA(myGLCD.fch, myGLCD.fcl);
+  myGLCD.setXY(x + radius, y, x + radius, y);
+  myGLCD.LCD_Write_DATA(myGLCD.fch, myGLCD.fcl);
+  myGLCD.setXY(x - radius, y, x - radius, y);
+  myGLCD.LCD_Write_DATA(myGLCD.fch, myGLCD.fcl);
+  while(x1 < y1)
+  {
+    if(f >= 0) 
+    {
+      y1--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x1++;
+    ddF_x += 2;
+    f += ddF_x;    
+    px[0] = x + x1; py[0] = y + y1;
+    px[1] = x - x1; py[1] = y + y1;
+    px[2] = x + x1; py[2] = y - y1;
+    px[3] = x - x1; py[3] = y - y1;
+    px[4] = x + y1; py[4] = y + x1;
+    px[5] = x - y1; py[5] = y + x1;
+    px[6] = x + y1; py[6] = y - x1;
+    px[7] = x - y1; py[7] = y - x1;
+    for (int i=0; i<8; i++)
+    {
+      myGLCD.setXY(px[i], py[i], px[i], py[i]);
+      myGLCD.LCD_Write_DATA(myGLCD.fch, myGLCD.fcl);
+    }
+  }
+  sbi(myGLCD.P_CS, myGLCD.B_CS);
+  myGLCD.clrXY();
+}
+
+void printResult(unsigned long us)
+{
+  Serial.print("\t");
+  Serial.print(us);
+  Serial.print("\t");
+  Serial.print(us*(F_CPU/1000000L));
+}
+
+void setup()
+{
+  int           cx, cy, r;
+  unsigned long t;
+
+  Serial.begin(115200);
+
+  myGLCD.InitLCD();
+  myGLCD.clrScr();
+  cx = myGLCD.getDisplayXSize()/2;
+  cy = myGLCD.getDisplayYSize()/2;
+
+  Serial.println("fillCircle()");
+  Serial.println("Radius\tOld us\tOld cyc\tNew us\tNew cyc");
+  for (int i=0; i<sizeof(radii)/sizeof(int); i++)
+  {
+    r = radii[i];
+    Serial.print(r);
+    myGLCD.setColor(255, 0, 0);
+    t = micros();
+    fillCircleOld(cx, cy, r);
+    printResult(micros() - t);
+    myGLCD.setColor(0, 255, 0);
+    t = micros();
+    myGLCD.fillCircle(cx, cy, r);
+    printResult(micros() - t);
+    Serial.println();
+  }
+
+  myGLCD.clrScr();
+  Serial.println("drawCircle()");
+  Serial.println("Radius\tOld us\tOld cyc\tNew us\tNew cyc");
+  for (int i=0; i<sizeof(radii)/sizeof(int); i++)
+  {
+    r = radii[i];
+    Serial.print(r);
+    myGLCD.setColor(255, 0, 0);
+    t = micros();
+    drawCircleOld(cx, cy, r);
+    printResult(micros() - t);
+    myGLCD.setColor(0, 255, 0);
+    t = micros();
+    myGLCD.drawCircle(cx, cy, r);
+    printResult(micros() - t);
+    Serial.println();
+  }
+
+  myGLCD.clrScr();
+  Serial.println("fillEllipse(r, r/2), fillArc(r, r*3/4, 135, 405)");
+  Serial.println("Radius\tEll us\tEll cyc\tArc us\tArc cyc");
+  for (int i=0; i<sizeof(radii)/sizeof(int); i++)
+  {
+    r = radii[i];
+    Serial.print(r);
+    myGLCD.setColor(0, 0, 255);
+    t = micros();
+    myGLCD.fillEllipse(cx, cy, r, r/2);
+    printResult(micros() - t);
+    myGLCD.setColor(255, 255, 0);
+    t = micros();
+    myGLCD.fillArc(cx, cy, r, (r*3)/4, 135, 405);
+    printResult(micros() - t);
+    Serial.println();
+  }
+}
+
+void loop()
+{
+}
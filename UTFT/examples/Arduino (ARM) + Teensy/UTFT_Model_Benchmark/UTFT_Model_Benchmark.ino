@@ -0,0 +1,100 @@
+// UTFT_Model_Benchmark 
+//
+// This program times the drawing functions that are most affected by
+// selecting the display model at runtime: single pixels, short lines,
+// small rectangles and text. Run it once as it is, and once with 
+//   #define UTFT_MODEL	TFT22SHLD
+// (or the model of your display) uncommented in UTFT.h, and compare the
+// results and the sketch size reported by the compiler.
+//
+// This demo was made for modules with a screen resolution of 320x240 
+// pixels, but will work with any module.
+//
+// This program requires the UTFT library.
+//
+// The results are printed to the serial monitor at 115200 baud.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+
+// Uncomment the line for your display:
+//UTFT myGLCD(MI0283QT9,11,13,7,8);                // Watterott MI0283QT9
+//UTFT myGLCD(DMTFT28105,MOSI,SCK,10,NOTINUSE,9);  // DisplayModule DM-TFT28-105
+//UTFT myGLCD(TFT01_22SP,9,8,12,11,10);            // ElecFreaks TFT01-2.2SP
+//UTFT myGLCD(TFT01_24SP,9,8,12,11,10);            // ElecFreaks TFT01-2.4SP
+//UTFT myGLCD(ITDB32S,38,39,40,41);                // ITead ITDB02-3.2S
+UTFT myGLCD(TFT22SHLD,3,4,7,5,6);                  // ElecFreaks TFT2.2SP Shield
+
+void printResult(const char *name, long count, unsigned long us)
+{
+  Serial.print(name);
+  Serial.print("\t");
+  Serial.print(count);
+  Serial.print("\t");
+  Serial.print(us);
+  Serial.print("\t");
+  Serial.println(float(us)/count, 2);
+}
+
+void setup()
+{
+  unsigned long t;
+
+  Serial.begin(115200);
+
+  myGLCD.InitLCD();
+  myGLCD.setFont(SmallFont);
+  myGLCD.clrScr();
+
+#if defined(UTFT_MODEL)
+  Serial.println("Display model selected at compile time (UTFT_MODEL)");
+#else
+  Serial.println("Display model selected at runtime");
+#endif
+  Serial.println("Test\t\tCount\tus\tus each");
+
+  myGLCD.setColor(VGA_RED);
+  t = micros();
+  for (int y=0; y<100; y++)
+    for (int x=0; x<100; x++)
+      myGLCD.drawPixel(x, y);
+  printResult("drawPixel\t", 10000, micros() - t);
+
+  myGLCD.setColor(VGA_GREEN);
+  t = micros();
+  for (int y=0; y<100; y++)
+    for (int x=0; x<100; x+=4)
+      myGLCD.drawHLine(x, y, 3);
+  printResult("drawHLine(3)\t", 2500, micros() - t);
+
+  myGLCD.setColor(VGA_BLUE);
+  t = micros();
+  for (int y=0; y<100; y+=4)
+    for (int x=0; x<100; x+=4)
+      myGLCD.fillRect(x, y, x+2, y+2);
+  printResult("fillRect(3x3)\t", 625, micros() - t);
+
+  myGLCD.setColor(VGA_YELLOW);
+  t = micros();
+  for (int i=0; i<100; i++)
+    myGLCD.drawLine(0, i, 99, 99-i);
+  printResult("drawLine(100)\t", 100, micros() - t);
+
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+  t = micros();
+  for (int i=0; i<10; i++)
+    myGLCD.print("0123456789", 0, i*12);
+  printResult("print(10 chars)\t", 10, micros() - t);
+
+  t = micros();
+  myGLCD.fillScr(VGA_BLACK);
+  printResult("fillScr\t\t", 1, micros() - t);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,92 @@
+// UTFT_Profile
+//
+// This program draws a screen with most of the drawing functions of
+// the library and prints the profile of every function used: the
+// number of calls, the pixels and windows (setXY() calls) sent to the
+// display and the time spent, in CPU cycles on the Arduino Due and
+// Teensy 3.x (counted by the DWT unit of the Cortex-M3 and M4) and in
+// microseconds on other boards.
+//
+// The frame is drawn ten times between the reports, so the numbers are
+// those of ten frames.
+//
+// This program requires the UTFT library, and the line
+//   #define UTFT_PROFILE 1
+// in UTFT.h must be uncommented.
+//
+// The results are printed to the serial monitor at 115200 baud.
+//
+
+#include <UTFT.h>
+
+#if !defined(UTFT_PROFILE)
+  #error "Please uncomment the UTFT_PROFILE define in UTFT.h"
+#endif
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+
+// Set the pins to the correct ones for your development shield
+// ------------------------------------------------------------
+// Standard Arduino Mega/Due shield            : <display model>,38,39,40,41
+// CTE TFT LCD/SD Shield for Arduino Due       : <display model>,25,26,27,28
+// Teensy 3.x TFT Test Board                   : <display model>,23,22, 3, 4
+// ElecHouse TFT LCD/SD Shield for Arduino Due : <display model>,22,23,31,33
+//
+// Remember to change the model parameter to suit your display module!
+UTFT myGLCD(ITDB32S,38,39,40,41);
+
+extern unsigned int info[0x400];
+
+void drawFrame(int frame)
+{
+  int px[] = {150, 230, 200, 100}, py[] = {200, 220, 300, 280};
+
+  myGLCD.clrScr();
+  myGLCD.setColor(0, 0, 255);
+  myGLCD.fillRect(0, 0, 239, 13);
+  myGLCD.setColor(255, 255, 255);
+  myGLCD.setBackColor(0, 0, 255);
+  myGLCD.print("UTFT profiler", CENTER, 1);
+  myGLCD.setColor(128, 128, 128);
+  myGLCD.drawRect(0, 14, 239, 319);
+  myGLCD.setColor(255, 0, 0);
+  myGLCD.fillRoundRect(10, 30, 110, 80);
+  myGLCD.setColor(0, 255, 0);
+  myGLCD.fillCircle(170, 55, 25);
+  myGLCD.drawCircle(170, 55, 30);
+  for (int i=0; i<10; i++)
+  {
+    myGLCD.setColor(255, 255, 0);
+    myGLCD.drawLine(10, 100+(i*8), 230, 180-(i*8));
+    myGLCD.drawPixel(5, 100+(i*8));
+  }
+  myGLCD.setColor(255, 255, 255);
+  myGLCD.setBackColor(0, 0, 0);
+  myGLCD.printNumI(frame, 10, 190);
+  myGLCD.printNumF(frame/7.0, 3, 10, 205);
+  for (int i=0; i<4; i++)
+    myGLCD.drawBitmap(10+(i*36), 230, 32, 32, info);
+  myGLCD.setColor(0, 255, 255);
+  myGLCD.fillPolygon(px, py, 4);
+  myGLCD.fillTriangle(20, 300, 60, 260, 90, 310);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.setFont(SmallFont);
+}
+
+void loop()
+{
+  static int frame = 0;
+
+  myGLCD.resetProfile();
+  for (int i=0; i<10; i++)
+    drawFrame(frame++);
+  myGLCD.printProfile(Serial);
+  Serial.println();
+}
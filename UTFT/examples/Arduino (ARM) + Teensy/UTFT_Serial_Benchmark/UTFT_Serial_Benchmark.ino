@@ -0,0 +1,97 @@
+// UTFT_Serial_Benchmark
+//
+// This program compares two ways of sending pixels to a serial
+// module: one LCD_Write_DATA() call for every pixel, as the library
+// used to, and fillRect() and drawBitmap(), which send the whole run
+// of pixels in one call with RS held high. The speed of both is
+// reported in pixels per second.
+//
+// This demo was made for serial modules with a screen
+// resolution of 320x240 pixels, but will work with any module.
+//
+// This program requires the UTFT library.
+//
+// The results are printed to the serial monitor at 115200 baud.
+//
+
+#include <UTFT.h>
+
+// Uncomment the line for your display:
+//UTFT myGLCD(MI0283QT9,11,13,7,8);                // Watterott MI0283QT9
+//UTFT myGLCD(TFT01_22SP,9,8,12,11,10);            // ElecFreaks TFT01-2.2SP
+//UTFT myGLCD(TFT01_24SP,9,8,12,11,10);            // ElecFreaks TFT01-2.4SP
+UTFT myGLCD(TFT22SHLD,3,4,7,5,6);                  // ElecFreaks TFT2.2SP Shield
+
+extern unsigned short info[0x400];
+
+// The pixel-by-pixel drawing used before the runs were sent in one call
+void fillRectPerPixel(int x1, int y1, int x2, int y2)
+{
+  cbi(myGLCD.P_CS, myGLCD.B_CS);
+  myGLCD.setXY(x1, y1, x2, y2);
+  for (long i=0; i<long(x2-x1+1)*(y2-y1+1); i++)
+    myGLCD.LCD_Write_DATA(myGLCD.fch, myGLCD.fcl);
+  sbi(myGLCD.P_CS, myGLCD.B_CS);
+}
+
+void drawBitmapPerPixel(int x, int y, int sx, int sy, unsigned short *data)
+{
+  cbi(myGLCD.P_CS, myGLCD.B_CS);
+  myGLCD.setXY(x, y, x+sx-1, y+sy-1);
+  for (int i=0; i<sx*sy; i++)
+    myGLCD.LCD_Write_DATA(data[i]>>8, data[i] & 0xFF);
+  sbi(myGLCD.P_CS, myGLCD.B_CS);
+}
+
+void printResult(long pixels, unsigned long us)
+{
+  Serial.print("\t");
+  Serial.print(us);
+  Serial.print("\t");
+  Serial.print((pixels*1000)/(us/1000));
+}
+
+void setup()
+{
+  int           w, h;
+  unsigned long t;
+
+  Serial.begin(115200);
+
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.clrScr();
+  w = myGLCD.getDisplayXSize();
+  h = myGLCD.getDisplayYSize();
+
+  Serial.println("Function\tOld us\tOld px/s\tNew us\tNew px/s");
+
+  Serial.print("fillRect");
+  myGLCD.setColor(255, 0, 0);
+  t = micros();
+  fillRectPerPixel(0, 0, w-1, h-1);
+  t = micros() - t;
+  printResult(long(w)*h, t);
+  myGLCD.setColor(0, 0, 255);
+  t = micros();
+  myGLCD.fillRect(0, 0, w-1, h-1);
+  t = micros() - t;
+  printResult(long(w)*h, t);
+  Serial.println();
+
+  Serial.print("drawBitmap");
+  t = micros();
+  for (int i=0; i<16; i++)
+    drawBitmapPerPixel((i % 4)*32, (i / 4)*32, 32, 32, info);
+  t = micros() - t;
+  printResult(16L*32*32, t);
+  t = micros();
+  for (int i=0; i<16; i++)
+    myGLCD.drawBitmap((i % 4)*32, 128+(i / 4)*32, 32, 32, info);
+  t = micros() - t;
+  printResult(16L*32*32, t);
+  Serial.println();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,60 @@
+// UTFT_Stream_Bitmap
+//
+// This program shows pictures sent from a PC over the serial port with
+// drawBitmapStream(), so the screen can be updated without reflashing
+// the board. The picture is drawn while it is received and is never
+// kept in RAM.
+//
+// Send one command letter followed by the picture:
+//   R  a full screen of raw RGB565 colors, high byte first
+//   B  a 16 or 24 bit BMP file, drawn in the top left corner
+// On Linux, for example:
+//   stty -F /dev/ttyACM0 115200 raw
+//   (printf R; cat screen.raw) > /dev/ttyACM0
+//   (printf B; cat picture.bmp) > /dev/ttyACM0
+// The board answers OK or ERROR when the picture has been drawn.
+//
+// This program requires the UTFT library.
+//
+
+#include <UTFT.h>
+
+// Set the pins to the correct ones for your development shield
+// ------------------------------------------------------------
+// Standard Arduino Mega/Due shield            : <display model>,38,39,40,41
+// CTE TFT LCD/SD Shield for Arduino Due       : <display model>,25,26,27,28
+// Teensy 3.x TFT Test Board                   : <display model>,23,22, 3, 4
+// ElecHouse TFT LCD/SD Shield for Arduino Due : <display model>,22,23,31,33
+//
+// Remember to change the model parameter to suit your display module!
+UTFT myGLCD(ITDB32S,38,39,40,41);
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.setTimeout(500);
+
+  myGLCD.InitLCD();
+  myGLCD.clrScr();
+}
+
+void loop()
+{
+  boolean ok;
+
+  if (Serial.available())
+  {
+    switch (Serial.read())
+    {
+    case 'R':
+      ok = myGLCD.drawBitmapStream(Serial, 0, 0, myGLCD.getDisplayXSize(), myGLCD.getDisplayYSize(), BITMAP_RAW565);
+      break;
+    case 'B':
+      ok = myGLCD.drawBitmapStream(Serial, 0, 0, 0, 0, BITMAP_BMP);
+      break;
+    default:
+      return;
+    }
+    Serial.println(ok ? "OK" : "ERROR");
+  }
+}
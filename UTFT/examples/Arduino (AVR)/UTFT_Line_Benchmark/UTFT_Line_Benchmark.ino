@@ -0,0 +1,139 @@
+// UTFT_Line_Benchmark 
+//
+// This program compares the run-based drawLine() with the old
+// pixel-by-pixel line drawing. For a number of line lengths and
+// slopes it reports the number of commands and data bytes sent to 
+// the display controller, and the time used to draw the line.
+//
+// This demo was made for serial modules with a screen 
+// resolution of 320x240 pixels, but will work with any module.
+//
+// This program requires the UTFT library, and the line
+//   #define UTFT_BUS_STATS 1
+// in UTFT.h must be uncommented.
+//
+// The results are printed to the serial monitor at 115200 baud.
+//
+
+#include <UTFT.h>
+
+#if !defined(UTFT_BUS_STATS)
+  #error "Please uncomment the UTFT_BUS_STATS define in UTFT.h"
+#endif
+
+// Uncomment the line for your display:
+//UTFT myGLCD(MI0283QT9,11,13,7,8);                // Watterott MI0283QT9
+//UTFT myGLCD(DMTFT28105,MOSI,SCK,10,NOTINUSE,9);  // DisplayModule DM-TFT28-105 (Works with both Arduino Uno and Arduino Mega)
+//UTFT myGLCD(TFT01_22SP,9,8,12,11,10);            // ElecFreaks TFT01-2.2SP
+//UTFT myGLCD(TFT01_24SP,9,8,12,11,10);            // ElecFreaks TFT01-2.4SP
+UTFT myGLCD(TFT22SHLD,3,4,7,5,6);                  // ElecFreaks TFT2.2SP Shield
+
+int lengths[] = {8, 32, 64, 128, 200};
+int slopes[]  = {0, 10, 30, 45, 60, 80, 90};    // Degrees
+
+// The line drawing used before drawLine() was changed to send runs.
+// Every pixel gets its own window.
+void drawLinePerPixel(int x1, int y1, int x2, int y2)
+{
+  unsigned int dx = (x2 > x1 ? x2 - x1 : x1 - x2);
+  short        xstep =  x2 > x1 ? 1 : -1;
+  unsigned int dy = (y2 > y1 ? y2 - y1 : y1 - y2);
+  short        ystep =  y2 > y1 ? 1 : -1;
+  int          col = x1, row = y1;
+  int          t;
+
+  cbi(myGLCD.P_CS, myGLCD.B_CS);
+  if (dx < dy)
+  {
+    t = - (dy >> 1);
+    while (true)
+    {
+      myGLCD.setXY (col, row, col, row);
+      myGLCD.LCD_Write_DATA (myGLCD.fch, myGLCD.fcl);
+      if (row == y2)
+        break;
+      row += ystep;
+      t += dx;
+      if (t >= 0)
+      {
+        col += xstep;
+        t   -= dy;
+      }
+    }
+  }
+  else
+  {
+    t = - (dx >> 1);
+    while (true)
+    {
+      myGLCD.setXY (col, row, col, row);
+      myGLCD.LCD_Write_DATA (myGLCD.fch, myGLCD.fcl);
+      if (col == x2)
+        break;
+      col += xstep;
+      t += dy;
+      if (t >= 0)
+      {
+        row += ystep;
+        t   -= dx;
+      }
+    }
+  }
+  sbi(myGLCD.P_CS, myGLCD.B_CS);
+  myGLCD.clrXY();
+}
+
+void printResult(unsigned long com, unsigned long dat, unsigned long us)
+{
+  Serial.print("\t");
+  Serial.print(com);
+  Serial.print("\t");
+  Serial.print(dat);
+  Serial.print("\t");
+  Serial.print(us);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+
+  myGLCD.InitLCD();
+  myGLCD.clrScr();
+
+  Serial.println("Length\tSlope\tOld COM\tOld DAT\tOld us\tNew COM\tNew DAT\tNew us");
+  for (int l=0; l<sizeof(lengths)/sizeof(int); l++)
+    for (int s=0; s<sizeof(slopes)/sizeof(int); s++)
+    {
+      int           x2 = lengths[l]*cos(slopes[s]*0.0175);
+      int           y2 = lengths[l]*sin(slopes[s]*0.0175);
+      unsigned long t;
+
+      if (x2 > myGLCD.getDisplayXSize()-1)
+        x2 = myGLCD.getDisplayXSize()-1;
+      if (y2 > myGLCD.getDisplayYSize()-1)
+        y2 = myGLCD.getDisplayYSize()-1;
+
+      Serial.print(lengths[l]);
+      Serial.print("\t");
+      Serial.print(slopes[s]);
+
+      myGLCD.setColor(255, 0, 0);
+      myGLCD.resetBusStats();
+      t = micros();
+      drawLinePerPixel(0, 0, x2, y2);
+      t = micros() - t;
+      printResult(myGLCD.bus_com, myGLCD.bus_data, t);
+
+      myGLCD.setColor(0, 255, 0);
+      myGLCD.resetBusStats();
+      t = micros();
+      myGLCD.drawLine(0, 0, x2, y2);
+      t = micros() - t;
+      printResult(myGLCD.bus_com, myGLCD.bus_data, t);
+      Serial.println();
+    }
+}
+
+void loop()
+{
+}
@@ -0,0 +1,199 @@
+// Generated by  : FontConverter
+// Generated from: Lato-Regular.ttf
+// Font Size     : 17 pixels, 2 bits per pixel
+// Memory usage  : 2866 bytes
+// # characters  : 95 (141 kerning pairs)
+
+#if defined(UTFT_HOST)
+	#define PROGMEM
+	#define fontdatatype const unsigned char
+#elif defined(__AVR__)
+	#include <avr/pgmspace.h>
+	#define fontdatatype const uint8_t
+#else
+	#define PROGMEM
+	#define fontdatatype const unsigned char
+#endif
+
+fontdatatype Lato14[2866] PROGMEM={
+0x00, 0x11, 0x20, 0x5F, 0x02, 0x0E, 0x0E, 0x8D, 0xA7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+0xA7, 0x04, 0x00, 0x02, 0x0A, 0x01, 0x04, 0x05, 0xB1, 0x04, 0x00, 0x04, 0x03, 0x01, 0x04, 0x06,
+0xB4, 0x04, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08, 0xC8, 0x04, 0x00, 0x07, 0x0D, 0x01, 0x03, 0x08,
+0xE2, 0x04, 0x00, 0x0B, 0x0A, 0x00, 0x04, 0x0B, 0x00, 0x05, 0x00, 0x0A, 0x0A, 0x00, 0x04, 0x0A,
+0x1E, 0x05, 0x00, 0x01, 0x03, 0x01, 0x04, 0x03, 0x21, 0x05, 0x00, 0x03, 0x0D, 0x01, 0x03, 0x04,
+0x2E, 0x05, 0x00, 0x03, 0x0D, 0x00, 0x03, 0x04, 0x3B, 0x05, 0x00, 0x04, 0x04, 0x01, 0x04, 0x06,
+0x3F, 0x05, 0x00, 0x08, 0x07, 0x00, 0x06, 0x08, 0x4D, 0x05, 0x00, 0x03, 0x03, 0x00, 0x0D, 0x03,
+0x50, 0x05, 0x00, 0x04, 0x01, 0x00, 0x09, 0x05, 0x51, 0x05, 0x00, 0x03, 0x01, 0x00, 0x0D, 0x03,
+0x52, 0x05, 0x00, 0x05, 0x0B, 0x00, 0x04, 0x05, 0x68, 0x05, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08,
+0x7C, 0x05, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x08, 0x90, 0x05, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08,
+0xA4, 0x05, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x08, 0xB8, 0x05, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08,
+0xCC, 0x05, 0x00, 0x06, 0x0A, 0x01, 0x04, 0x08, 0xE0, 0x05, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08,
+0xF4, 0x05, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08, 0x08, 0x06, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08,
+0x1C, 0x06, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x08, 0x30, 0x06, 0x00, 0x02, 0x07, 0x01, 0x07, 0x04,
+0x37, 0x06, 0x00, 0x02, 0x09, 0x01, 0x07, 0x04, 0x40, 0x06, 0x00, 0x06, 0x06, 0x01, 0x06, 0x08,
+0x4C, 0x06, 0x00, 0x06, 0x03, 0x01, 0x08, 0x08, 0x52, 0x06, 0x00, 0x06, 0x06, 0x01, 0x06, 0x08,
+0x5E, 0x06, 0x00, 0x06, 0x0A, 0x00, 0x04, 0x06, 0x72, 0x06, 0x00, 0x0B, 0x0B, 0x00, 0x05, 0x0C,
+0x93, 0x06, 0x00, 0x0A, 0x0A, 0x00, 0x04, 0x0A, 0xB1, 0x06, 0x00, 0x08, 0x0A, 0x01, 0x04, 0x09,
+0xC5, 0x06, 0x00, 0x09, 0x0A, 0x00, 0x04, 0x0A, 0xE3, 0x06, 0x00, 0x09, 0x0A, 0x01, 0x04, 0x0B,
+0x01, 0x07, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x08, 0x15, 0x07, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x08,
+0x29, 0x07, 0x00, 0x0A, 0x0A, 0x00, 0x04, 0x0A, 0x47, 0x07, 0x00, 0x09, 0x0A, 0x01, 0x04, 0x0B,
+0x65, 0x07, 0x00, 0x02, 0x0A, 0x01, 0x04, 0x04, 0x6F, 0x07, 0x00, 0x05, 0x0A, 0x00, 0x04, 0x06,
+0x83, 0x07, 0x00, 0x08, 0x0A, 0x01, 0x04, 0x0A, 0x97, 0x07, 0x00, 0x06, 0x0A, 0x01, 0x04, 0x07,
+0xAB, 0x07, 0x00, 0x0B, 0x0A, 0x01, 0x04, 0x0D, 0xC9, 0x07, 0x00, 0x09, 0x0A, 0x01, 0x04, 0x0B,
+0xE7, 0x07, 0x00, 0x0B, 0x0A, 0x00, 0x04, 0x0B, 0x05, 0x08, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x09,
+0x19, 0x08, 0x00, 0x0B, 0x0C, 0x00, 0x04, 0x0B, 0x3D, 0x08, 0x00, 0x08, 0x0A, 0x01, 0x04, 0x09,
+0x51, 0x08, 0x00, 0x07, 0x0A, 0x00, 0x04, 0x07, 0x65, 0x08, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x08,
+0x79, 0x08, 0x00, 0x08, 0x0A, 0x01, 0x04, 0x0A, 0x8D, 0x08, 0x00, 0x0A, 0x0A, 0x00, 0x04, 0x0A,
+0xAB, 0x08, 0x00, 0x0E, 0x0A, 0x00, 0x04, 0x0E, 0xD3, 0x08, 0x00, 0x09, 0x0A, 0x00, 0x04, 0x09,
+0xF1, 0x08, 0x00, 0x09, 0x0A, 0x00, 0x04, 0x09, 0x0F, 0x09, 0x00, 0x08, 0x0A, 0x00, 0x04, 0x09,
+0x23, 0x09, 0x00, 0x03, 0x0D, 0x01, 0x03, 0x04, 0x30, 0x09, 0x00, 0x05, 0x0B, 0x00, 0x04, 0x05,
+0x46, 0x09, 0x00, 0x04, 0x0D, 0x00, 0x03, 0x04, 0x53, 0x09, 0x00, 0x06, 0x05, 0x01, 0x04, 0x08,
+0x5D, 0x09, 0x00, 0x06, 0x01, 0x00, 0x0F, 0x06, 0x5F, 0x09, 0x00, 0x03, 0x02, 0x00, 0x04, 0x04,
+0x61, 0x09, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0x6F, 0x09, 0x00, 0x07, 0x0A, 0x01, 0x04, 0x08,
+0x83, 0x09, 0x00, 0x06, 0x07, 0x00, 0x07, 0x07, 0x91, 0x09, 0x00, 0x07, 0x0A, 0x00, 0x04, 0x08,
+0xA5, 0x09, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07, 0xB3, 0x09, 0x00, 0x05, 0x0A, 0x00, 0x04, 0x05,
+0xC7, 0x09, 0x00, 0x07, 0x09, 0x00, 0x07, 0x07, 0xD9, 0x09, 0x00, 0x06, 0x0A, 0x01, 0x04, 0x08,
+0xED, 0x09, 0x00, 0x02, 0x0A, 0x01, 0x04, 0x04, 0xF7, 0x09, 0x00, 0x04, 0x0C, 0xFF, 0x04, 0x04,
+0x03, 0x0A, 0x00, 0x06, 0x0A, 0x01, 0x04, 0x07, 0x17, 0x0A, 0x00, 0x02, 0x0A, 0x01, 0x04, 0x04,
+0x21, 0x0A, 0x00, 0x0A, 0x07, 0x01, 0x07, 0x0C, 0x36, 0x0A, 0x00, 0x06, 0x07, 0x01, 0x07, 0x08,
+0x44, 0x0A, 0x00, 0x08, 0x07, 0x00, 0x07, 0x08, 0x52, 0x0A, 0x00, 0x07, 0x09, 0x01, 0x07, 0x08,
+0x64, 0x0A, 0x00, 0x07, 0x09, 0x00, 0x07, 0x08, 0x76, 0x0A, 0x00, 0x05, 0x07, 0x01, 0x07, 0x06,
+0x84, 0x0A, 0x00, 0x06, 0x07, 0x00, 0x07, 0x06, 0x92, 0x0A, 0x00, 0x05, 0x0A, 0x00, 0x04, 0x05,
+0xA6, 0x0A, 0x00, 0x06, 0x07, 0x01, 0x07, 0x08, 0xB4, 0x0A, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07,
+0xC2, 0x0A, 0x00, 0x0B, 0x07, 0x00, 0x07, 0x0B, 0xD7, 0x0A, 0x00, 0x07, 0x07, 0x00, 0x07, 0x07,
+0xE5, 0x0A, 0x00, 0x07, 0x09, 0x00, 0x07, 0x07, 0xF7, 0x0A, 0x00, 0x06, 0x07, 0x00, 0x07, 0x06,
+0x05, 0x0B, 0x00, 0x04, 0x0D, 0x00, 0x03, 0x04, 0x12, 0x0B, 0x00, 0x02, 0x0D, 0x01, 0x03, 0x04,
+0x1F, 0x0B, 0x00, 0x04, 0x0D, 0x00, 0x03, 0x04, 0x2C, 0x0B, 0x00, 0x07, 0x03, 0x01, 0x09, 0x08,
+0x22, 0x26, 0xFF, 0x22, 0x2C, 0xFF, 0x22, 0x2D, 0xFF, 0x22, 0x2E, 0xFF, 0x22, 0x2F, 0xFF, 0x22,
+0x41, 0xFF, 0x27, 0x26, 0xFF, 0x27, 0x2C, 0xFF, 0x27, 0x2D, 0xFF, 0x27, 0x2E, 0xFF, 0x27, 0x2F,
+0xFF, 0x27, 0x41, 0xFF, 0x2A, 0x26, 0xFF, 0x2A, 0x2C, 0xFF, 0x2A, 0x2D, 0xFF, 0x2A, 0x2E, 0xFF,
+0x2A, 0x2F, 0xFF, 0x2A, 0x41, 0xFF, 0x2C, 0x22, 0xFF, 0x2C, 0x27, 0xFF, 0x2C, 0x2A, 0xFF, 0x2C,
+0x2D, 0xFF, 0x2C, 0x54, 0xFF, 0x2C, 0x56, 0xFF, 0x2C, 0x59, 0xFF, 0x2C, 0x5C, 0xFF, 0x2C, 0x76,
+0xFF, 0x2C, 0x79, 0xFF, 0x2D, 0x22, 0xFF, 0x2D, 0x27, 0xFF, 0x2D, 0x2A, 0xFF, 0x2D, 0x2C, 0xFF,
+0x2D, 0x2E, 0xFF, 0x2D, 0x54, 0xFF, 0x2D, 0x59, 0xFF, 0x2E, 0x22, 0xFF, 0x2E, 0x27, 0xFF, 0x2E,
+0x2A, 0xFF, 0x2E, 0x2D, 0xFF, 0x2E, 0x54, 0xFF, 0x2E, 0x56, 0xFF, 0x2E, 0x59, 0xFF, 0x2E, 0x5C,
+0xFF, 0x2E, 0x76, 0xFF, 0x2E, 0x79, 0xFF, 0x2F, 0x26, 0xFF, 0x2F, 0x2C, 0xFF, 0x2F, 0x2E, 0xFF,
+0x2F, 0x2F, 0xFF, 0x2F, 0x41, 0xFF, 0x2F, 0x4A, 0xFF, 0x2F, 0x67, 0xFF, 0x41, 0x22, 0xFF, 0x41,
+0x27, 0xFF, 0x41, 0x2A, 0xFF, 0x41, 0x54, 0xFF, 0x41, 0x56, 0xFF, 0x41, 0x59, 0xFF, 0x41, 0x5C,
+0xFF, 0x43, 0x2D, 0xFF, 0x46, 0x26, 0xFF, 0x46, 0x2C, 0xFF, 0x46, 0x2E, 0xFF, 0x46, 0x2F, 0xFF,
+0x46, 0x41, 0xFF, 0x46, 0x4A, 0xFF, 0x4C, 0x22, 0xFF, 0x4C, 0x27, 0xFF, 0x4C, 0x2A, 0xFF, 0x4C,
+0x2D, 0xFF, 0x4C, 0x54, 0xFF, 0x4C, 0x56, 0xFF, 0x4C, 0x57, 0xFF, 0x4C, 0x59, 0xFF, 0x4C, 0x5C,
+0xFF, 0x50, 0x26, 0xFF, 0x50, 0x2C, 0xFF, 0x50, 0x2E, 0xFF, 0x50, 0x2F, 0xFF, 0x50, 0x41, 0xFF,
+0x50, 0x4A, 0xFF, 0x54, 0x26, 0xFF, 0x54, 0x2C, 0xFF, 0x54, 0x2D, 0xFF, 0x54, 0x2E, 0xFF, 0x54,
+0x2F, 0xFF, 0x54, 0x3A, 0xFF, 0x54, 0x3B, 0xFF, 0x54, 0x41, 0xFF, 0x54, 0x4A, 0xFF, 0x54, 0x61,
+0xFF, 0x54, 0x63, 0xFF, 0x54, 0x64, 0xFF, 0x54, 0x65, 0xFF, 0x54, 0x67, 0xFF, 0x54, 0x6D, 0xFF,
+0x54, 0x6E, 0xFF, 0x54, 0x6F, 0xFF, 0x54, 0x70, 0xFF, 0x54, 0x71, 0xFF, 0x54, 0x72, 0xFF, 0x54,
+0x73, 0xFF, 0x54, 0x75, 0xFF, 0x54, 0x76, 0xFF, 0x54, 0x77, 0xFF, 0x54, 0x78, 0xFF, 0x54, 0x79,
+0xFF, 0x56, 0x26, 0xFF, 0x56, 0x2C, 0xFF, 0x56, 0x2E, 0xFF, 0x56, 0x2F, 0xFF, 0x56, 0x41, 0xFF,
+0x56, 0x4A, 0xFF, 0x56, 0x67, 0xFF, 0x59, 0x26, 0xFF, 0x59, 0x2C, 0xFF, 0x59, 0x2D, 0xFF, 0x59,
+0x2E, 0xFF, 0x59, 0x2F, 0xFF, 0x59, 0x41, 0xFF, 0x59, 0x4A, 0xFF, 0x59, 0x63, 0xFF, 0x59, 0x64,
+0xFF, 0x59, 0x65, 0xFF, 0x59, 0x67, 0xFF, 0x59, 0x6F, 0xFF, 0x59, 0x71, 0xFF, 0x59, 0x78, 0xFF,
+0x5C, 0x22, 0xFF, 0x5C, 0x27, 0xFF, 0x5C, 0x2A, 0xFF, 0x5C, 0x54, 0xFF, 0x5C, 0x56, 0xFF, 0x5C,
+0x59, 0xFF, 0x5C, 0x5C, 0xFF, 0x72, 0x2C, 0xFF, 0x72, 0x2E, 0xFF, 0x76, 0x2C, 0xFF, 0x76, 0x2E,
+0xFF, 0x79, 0x2C, 0xFF, 0x79, 0x2E, 0xFF, 0x70, 0x70, 0x70, 0x70, 0x30, 0x30, 0x00, 0x00, 0x00,
+0x70, 0xC9, 0xC9, 0x85, 0x03, 0x18, 0x06, 0x18, 0x06, 0x24, 0x7F, 0xFE, 0x09, 0x30, 0x0C, 0x60,
+0xBF, 0xFD, 0x18, 0x90, 0x24, 0x90, 0x24, 0xC0, 0x02, 0x00, 0x1F, 0x90, 0x76, 0x60, 0x92, 0x00,
+0xA2, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x06, 0x34, 0x05, 0x34, 0xD5, 0x70, 0x6F, 0x90, 0x09, 0x00,
+0x08, 0x00, 0x2E, 0x40, 0x90, 0x61, 0x81, 0x80, 0x60, 0xC7, 0x00, 0x61, 0x8D, 0x00, 0x2E, 0x24,
+0x00, 0x00, 0x66, 0xE0, 0x01, 0xC9, 0x24, 0x03, 0x4C, 0x24, 0x09, 0x09, 0x24, 0x18, 0x06, 0xE0,
+0x02, 0xE4, 0x00, 0x0A, 0x1C, 0x00, 0x0C, 0x04, 0x00, 0x0D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x2A,
+0xD1, 0x80, 0x70, 0x76, 0x40, 0x70, 0x1F, 0x00, 0x34, 0x1F, 0x40, 0x1B, 0xE1, 0xD0, 0xC0, 0xC0,
+0x80, 0x14, 0x34, 0x60, 0x90, 0xD0, 0xC0, 0xC0, 0xC0, 0xD0, 0x90, 0x60, 0x34, 0x14, 0x50, 0x70,
+0x24, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x24, 0x30, 0x60, 0x20, 0xA9, 0xA9, 0x20, 0x01,
+0x80, 0x01, 0x80, 0x01, 0x80, 0x7F, 0xFD, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x74, 0x20, 0x10,
+0x7F, 0x74, 0x00, 0x80, 0x01, 0x80, 0x02, 0x40, 0x03, 0x00, 0x09, 0x00, 0x0C, 0x00, 0x18, 0x00,
+0x24, 0x00, 0x60, 0x00, 0x90, 0x00, 0x40, 0x00, 0x0B, 0xE0, 0x28, 0x28, 0x70, 0x0D, 0x60, 0x0A,
+0xA0, 0x0A, 0xA0, 0x0A, 0x60, 0x0A, 0x70, 0x0D, 0x28, 0x28, 0x0B, 0xE0, 0x07, 0x40, 0x1F, 0x40,
+0x76, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x02, 0x40, 0x3F, 0xF4,
+0x0B, 0xE0, 0x28, 0x2C, 0x24, 0x0C, 0x00, 0x1C, 0x00, 0x28, 0x00, 0xB0, 0x01, 0xD0, 0x07, 0x40,
+0x1D, 0x00, 0x7F, 0xFD, 0x2F, 0x90, 0xA0, 0x70, 0x50, 0x34, 0x00, 0xA0, 0x07, 0xD0, 0x00, 0x70,
+0x00, 0x24, 0xC0, 0x34, 0xA0, 0xB0, 0x2F, 0x80, 0x00, 0x74, 0x00, 0xF4, 0x02, 0x64, 0x0A, 0x24,
+0x18, 0x24, 0x70, 0x24, 0xBF, 0xFE, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x3F, 0xE0, 0x30, 0x00,
+0x60, 0x00, 0x60, 0x00, 0xBF, 0x80, 0x00, 0xA0, 0x00, 0x70, 0x00, 0x70, 0x91, 0xA0, 0x7F, 0x40,
+0x00, 0xB0, 0x01, 0xD0, 0x07, 0x40, 0x0E, 0x00, 0x2E, 0xE4, 0x38, 0x1C, 0x70, 0x0D, 0x30, 0x0D,
+0x28, 0x2C, 0x0B, 0xE0, 0x7F, 0xFE, 0x00, 0x0D, 0x00, 0x28, 0x00, 0x34, 0x00, 0xA0, 0x00, 0xD0,
+0x02, 0x80, 0x03, 0x40, 0x0A, 0x00, 0x0D, 0x00, 0x0B, 0xE0, 0x28, 0x28, 0x34, 0x1C, 0x28, 0x28,
+0x0B, 0xF0, 0x28, 0x2C, 0x70, 0x0D, 0x70, 0x0D, 0x38, 0x2C, 0x0B, 0xE4, 0x1F, 0x90, 0x74, 0x70,
+0xD0, 0x24, 0xD0, 0x28, 0xA0, 0x74, 0x2F, 0xA0, 0x01, 0xD0, 0x03, 0x40, 0x0A, 0x00, 0x1C, 0x00,
+0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x50, 0x80,
+0x00, 0x50, 0x06, 0x90, 0x6D, 0x00, 0xB4, 0x00, 0x1A, 0x40, 0x01, 0xD0, 0xFF, 0xF0, 0x00, 0x00,
+0xFF, 0xF0, 0x50, 0x00, 0x29, 0x00, 0x06, 0x90, 0x01, 0xF0, 0x1B, 0x40, 0x74, 0x00, 0x6F, 0x40,
+0x51, 0xC0, 0x00, 0xD0, 0x01, 0xC0, 0x07, 0x40, 0x0D, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1D, 0x00, 0x01, 0xBE, 0x40, 0x0A, 0x41, 0xA0, 0x28, 0x00, 0x24, 0x30, 0x6F, 0x48, 0x60, 0xD3,
+0x0C, 0x62, 0x46, 0x08, 0x62, 0x4A, 0x24, 0x31, 0xF6, 0xE0, 0x28, 0x00, 0x00, 0x0A, 0x40, 0x60,
+0x01, 0xBF, 0x80, 0x00, 0xE0, 0x00, 0x02, 0xB0, 0x00, 0x03, 0x64, 0x00, 0x07, 0x1C, 0x00, 0x0A,
+0x0D, 0x00, 0x0C, 0x0A, 0x00, 0x2F, 0xFF, 0x00, 0x34, 0x02, 0x40, 0x70, 0x01, 0xC0, 0xA0, 0x00,
+0xD0, 0xBF, 0xE0, 0xA0, 0x78, 0xA0, 0x1C, 0xA0, 0x2C, 0xA0, 0x74, 0xBF, 0xE0, 0xA0, 0x2C, 0xA0,
+0x0D, 0xA0, 0x2C, 0xBF, 0xE4, 0x02, 0xFE, 0x40, 0x0E, 0x41, 0x80, 0x28, 0x00, 0x00, 0x34, 0x00,
+0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x74, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1E, 0x02, 0x80,
+0x02, 0xFE, 0x00, 0xBF, 0xE4, 0x00, 0xA0, 0x1E, 0x00, 0xA0, 0x07, 0x40, 0xA0, 0x02, 0x80, 0xA0,
+0x02, 0xC0, 0xA0, 0x02, 0xC0, 0xA0, 0x02, 0x80, 0xA0, 0x07, 0x40, 0xA0, 0x1E, 0x00, 0xBF, 0xE4,
+0x00, 0xBF, 0xF4, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xBF, 0xD0, 0xA0, 0x00, 0xA0,
+0x00, 0xA0, 0x00, 0xBF, 0xF4, 0xBF, 0xF4, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xBF,
+0xE0, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x02, 0xFE, 0x40, 0x0E, 0x41, 0x80, 0x28,
+0x00, 0x00, 0x34, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x0B, 0xD0, 0x34, 0x00, 0x90, 0x28, 0x00,
+0x90, 0x0E, 0x41, 0xD0, 0x02, 0xFE, 0x40, 0xA0, 0x03, 0x40, 0xA0, 0x03, 0x40, 0xA0, 0x03, 0x40,
+0xA0, 0x03, 0x40, 0xA0, 0x03, 0x40, 0xBF, 0xFF, 0x40, 0xA0, 0x03, 0x40, 0xA0, 0x03, 0x40, 0xA0,
+0x03, 0x40, 0xA0, 0x03, 0x40, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x01,
+0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x07,
+0x40, 0x7E, 0x00, 0xA0, 0x0A, 0xA0, 0x2C, 0xA0, 0x74, 0xA1, 0xD0, 0xA3, 0x80, 0xBF, 0x00, 0xA2,
+0xC0, 0xA0, 0xB0, 0xA0, 0x2C, 0xA0, 0x0A, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0,
+0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xBF, 0xF0, 0xA0, 0x00, 0x38, 0xB4, 0x00,
+0xB8, 0xAC, 0x00, 0xE8, 0x9A, 0x02, 0xA8, 0x97, 0x07, 0x28, 0x92, 0x8A, 0x28, 0x90, 0xDC, 0x28,
+0x90, 0xB4, 0x28, 0x90, 0x20, 0x28, 0x90, 0x00, 0x28, 0xA0, 0x03, 0x40, 0xB4, 0x03, 0x40, 0xAD,
+0x03, 0x40, 0x9B, 0x03, 0x40, 0x92, 0x83, 0x40, 0x90, 0xD3, 0x40, 0x90, 0x77, 0x40, 0x90, 0x2F,
+0x40, 0x90, 0x0B, 0x40, 0x90, 0x03, 0x40, 0x02, 0xFE, 0x00, 0x0E, 0x42, 0xD0, 0x28, 0x00, 0xB0,
+0x34, 0x00, 0x34, 0x70, 0x00, 0x34, 0x70, 0x00, 0x34, 0x34, 0x00, 0x34, 0x28, 0x00, 0xB0, 0x0E,
+0x02, 0xD0, 0x02, 0xFE, 0x00, 0xBF, 0xE0, 0xA0, 0x78, 0xA0, 0x1C, 0xA0, 0x1C, 0xA0, 0x78, 0xBF,
+0xD0, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0xA0, 0x00, 0x02, 0xFE, 0x00, 0x0E, 0x42, 0xD0, 0x28,
+0x00, 0xB0, 0x34, 0x00, 0x34, 0x70, 0x00, 0x34, 0x70, 0x00, 0x34, 0x34, 0x00, 0x34, 0x28, 0x00,
+0xB0, 0x0E, 0x02, 0xD0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x78, 0xBF, 0xD0, 0xA0,
+0x74, 0xA0, 0x28, 0xA0, 0x28, 0xA0, 0x74, 0xBF, 0x90, 0xA1, 0xC0, 0xA0, 0xA0, 0xA0, 0x38, 0xA0,
+0x1D, 0x0B, 0xE4, 0x28, 0x14, 0x30, 0x00, 0x38, 0x00, 0x1F, 0x90, 0x01, 0xB4, 0x00, 0x28, 0x00,
+0x18, 0x64, 0x74, 0x2F, 0xD0, 0xBF, 0xFF, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02,
+0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80, 0xD0, 0x07, 0xD0, 0x07, 0xD0, 0x07, 0xD0,
+0x07, 0xD0, 0x07, 0xD0, 0x07, 0xE0, 0x07, 0xA0, 0x0A, 0x38, 0x1D, 0x0B, 0xE4, 0xA0, 0x00, 0xD0,
+0x70, 0x02, 0xC0, 0x34, 0x03, 0x40, 0x2C, 0x07, 0x00, 0x0D, 0x0A, 0x00, 0x0A, 0x1D, 0x00, 0x07,
+0x28, 0x00, 0x03, 0x74, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xE0, 0x00, 0xA0, 0x0B, 0x00, 0x70, 0x70,
+0x0F, 0x40, 0xA0, 0x34, 0x1E, 0x80, 0xD0, 0x28, 0x29, 0xC1, 0xC0, 0x1C, 0x34, 0xD2, 0x80, 0x1D,
+0x70, 0xA3, 0x40, 0x0E, 0xA0, 0x77, 0x00, 0x0A, 0xD0, 0x3A, 0x00, 0x07, 0xC0, 0x2D, 0x00, 0x03,
+0x80, 0x1D, 0x00, 0x70, 0x03, 0x40, 0x28, 0x0A, 0x00, 0x0D, 0x1C, 0x00, 0x07, 0x74, 0x00, 0x02,
+0xE0, 0x00, 0x03, 0xF0, 0x00, 0x0B, 0x38, 0x00, 0x1D, 0x1D, 0x00, 0x38, 0x0B, 0x00, 0xB0, 0x03,
+0x80, 0xA0, 0x03, 0x40, 0x34, 0x0A, 0x00, 0x1C, 0x1D, 0x00, 0x0A, 0x28, 0x00, 0x07, 0x70, 0x00,
+0x02, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x3F,
+0xFF, 0x00, 0x0E, 0x00, 0x2C, 0x00, 0x74, 0x00, 0xE0, 0x02, 0x80, 0x07, 0x40, 0x1D, 0x00, 0x38,
+0x00, 0x7F, 0xFF, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8,
+0x80, 0x00, 0x90, 0x00, 0x30, 0x00, 0x24, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00,
+0x02, 0x40, 0x01, 0x80, 0x00, 0x40, 0x7D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+0x0D, 0x0D, 0x7D, 0x0A, 0x00, 0x1F, 0x40, 0x25, 0x80, 0x60, 0x90, 0x50, 0x10, 0xFF, 0xE0, 0x70,
+0x18, 0x1B, 0xD0, 0x24, 0x70, 0x00, 0x34, 0x1B, 0xF4, 0x34, 0x34, 0x70, 0x74, 0x2F, 0x64, 0xD0,
+0x00, 0xD0, 0x00, 0xD0, 0x00, 0xDB, 0x90, 0xE0, 0xB0, 0xD0, 0x34, 0xD0, 0x34, 0xD0, 0x30, 0xE0,
+0xA0, 0xDF, 0x80, 0x0B, 0xE0, 0x38, 0x10, 0x70, 0x00, 0x60, 0x00, 0x70, 0x00, 0x38, 0x20, 0x1B,
+0xE0, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x0B, 0xA8, 0x38, 0x28, 0x70, 0x18, 0x60, 0x18, 0x70,
+0x18, 0x34, 0x78, 0x1F, 0x98, 0x0B, 0xD0, 0x38, 0x74, 0x70, 0x18, 0x7F, 0xF8, 0x70, 0x00, 0x38,
+0x14, 0x0B, 0xE0, 0x0B, 0x80, 0x28, 0x00, 0x28, 0x00, 0xBF, 0x80, 0x28, 0x00, 0x28, 0x00, 0x28,
+0x00, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00, 0x1F, 0xFC, 0x34, 0x70, 0x34, 0x70, 0x2F, 0x90, 0x34,
+0x00, 0x2F, 0xF4, 0x60, 0x28, 0xA0, 0x24, 0x2F, 0xD0, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xDB,
+0x80, 0xE0, 0xA0, 0xD0, 0x70, 0xD0, 0x70, 0xD0, 0x70, 0xD0, 0x70, 0xD0, 0x70, 0xD0, 0x00, 0x00,
+0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0x0D, 0x00, 0x00, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+0x0D, 0x0D, 0x78, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x90, 0xD2, 0x80, 0xDA, 0x00, 0xFD,
+0x00, 0xDB, 0x00, 0xD2, 0x80, 0xD0, 0xA0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0, 0xD0,
+0xD0, 0xDF, 0x5F, 0x80, 0xE1, 0xE0, 0xD0, 0xD0, 0xD0, 0xA0, 0xD0, 0x90, 0xA0, 0xD0, 0x90, 0xA0,
+0xD0, 0x90, 0xA0, 0xD0, 0x90, 0xA0, 0xDB, 0x80, 0xE0, 0xA0, 0xD0, 0x70, 0xD0, 0x70, 0xD0, 0x70,
+0xD0, 0x70, 0xD0, 0x70, 0x0B, 0xE0, 0x38, 0x28, 0x70, 0x1C, 0x60, 0x0D, 0x70, 0x1C, 0x38, 0x28,
+0x0B, 0xE0, 0xDB, 0x90, 0xE0, 0xA0, 0xD0, 0x30, 0xD0, 0x34, 0xD0, 0x70, 0xE0, 0xA0, 0xEF, 0x80,
+0xD0, 0x00, 0xD0, 0x00, 0x0B, 0x98, 0x38, 0x28, 0x70, 0x18, 0x60, 0x18, 0x70, 0x18, 0x34, 0x78,
+0x1F, 0xA8, 0x00, 0x18, 0x00, 0x18, 0xDB, 0x40, 0xE0, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x00,
+0xD0, 0x00, 0xD0, 0x00, 0x2F, 0x80, 0x74, 0x40, 0x74, 0x00, 0x1B, 0x80, 0x00, 0xD0, 0x50, 0xD0,
+0x2F, 0x80, 0x04, 0x00, 0x18, 0x00, 0x18, 0x00, 0xBF, 0x80, 0x28, 0x00, 0x28, 0x00, 0x28, 0x00,
+0x28, 0x00, 0x28, 0x00, 0x0F, 0x80, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60,
+0xE1, 0xE0, 0x7E, 0x60, 0xA0, 0x18, 0x70, 0x24, 0x34, 0x70, 0x18, 0xA0, 0x0D, 0xD0, 0x0B, 0x80,
+0x07, 0x40, 0xA0, 0x70, 0x24, 0x70, 0xB4, 0x30, 0x30, 0xD8, 0x60, 0x25, 0x8C, 0x90, 0x1A, 0x49,
+0xC0, 0x0F, 0x07, 0xC0, 0x0A, 0x03, 0x80, 0x70, 0x34, 0x28, 0xA0, 0x0E, 0xC0, 0x07, 0x80, 0x0D,
+0xC0, 0x28, 0xA0, 0x60, 0x34, 0xA0, 0x18, 0x70, 0x34, 0x28, 0x70, 0x1C, 0x90, 0x0A, 0xC0, 0x07,
+0x80, 0x03, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x7F, 0xF0, 0x00, 0x90, 0x02, 0x80, 0x06, 0x00, 0x1C,
+0x00, 0x34, 0x00, 0x7F, 0xE0, 0x1E, 0x34, 0x30, 0x30, 0x24, 0x34, 0xA0, 0x34, 0x24, 0x30, 0x30,
+0x34, 0x1E, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x74,
+0x0C, 0x09, 0x0C, 0x0C, 0x0C, 0x0B, 0x0C, 0x0C, 0x0C, 0x09, 0x0C, 0x74, 0x79, 0x34, 0xC6, 0xE0,
+0x40, 0x00
+};
@@ -0,0 +1,486 @@
+// Generated by  : FontConverter
+// Generated from: Lato-Regular.ttf
+// Font Size     : 25 pixels, 4 bits per pixel
+// Memory usage  : 7469 bytes
+// # characters  : 95 (255 kerning pairs)
+
+#if defined(UTFT_HOST)
+	#define PROGMEM
+	#define fontdatatype const unsigned char
+#elif defined(__AVR__)
+	#include <avr/pgmspace.h>
+	#define fontdatatype const uint8_t
+#else
+	#define PROGMEM
+	#define fontdatatype const unsigned char
+#endif
+
+fontdatatype Lato20[7469] PROGMEM={
+0x00, 0x19, 0x20, 0x5F, 0x04, 0x14, 0x14, 0xFF, 0xFD, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+0xFD, 0x05, 0x00, 0x03, 0x0E, 0x02, 0x06, 0x07, 0x19, 0x06, 0x00, 0x06, 0x05, 0x01, 0x06, 0x08,
+0x28, 0x06, 0x00, 0x0B, 0x0E, 0x00, 0x06, 0x0C, 0x7C, 0x06, 0x00, 0x0A, 0x12, 0x01, 0x04, 0x0C,
+0xD6, 0x06, 0x00, 0x0F, 0x0E, 0x00, 0x06, 0x10, 0x46, 0x07, 0x00, 0x0E, 0x0E, 0x00, 0x06, 0x0E,
+0xA8, 0x07, 0x00, 0x03, 0x05, 0x01, 0x06, 0x05, 0xB2, 0x07, 0x00, 0x05, 0x13, 0x01, 0x04, 0x06,
+0xEB, 0x07, 0x00, 0x05, 0x13, 0x00, 0x04, 0x06, 0x24, 0x08, 0x00, 0x06, 0x06, 0x01, 0x06, 0x08,
+0x36, 0x08, 0x00, 0x0A, 0x0A, 0x01, 0x08, 0x0C, 0x68, 0x08, 0x00, 0x03, 0x04, 0x01, 0x13, 0x04,
+0x70, 0x08, 0x00, 0x05, 0x01, 0x01, 0x0E, 0x07, 0x73, 0x08, 0x00, 0x03, 0x01, 0x01, 0x13, 0x04,
+0x75, 0x08, 0x00, 0x08, 0x0F, 0x00, 0x06, 0x07, 0xB1, 0x08, 0x00, 0x0B, 0x0E, 0x00, 0x06, 0x0C,
+0x05, 0x09, 0x00, 0x09, 0x0E, 0x02, 0x06, 0x0C, 0x4B, 0x09, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C,
+0x91, 0x09, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C, 0xD7, 0x09, 0x00, 0x0C, 0x0E, 0x00, 0x06, 0x0C,
+0x2B, 0x0A, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C, 0x71, 0x0A, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C,
+0xB7, 0x0A, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C, 0xFD, 0x0A, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C,
+0x43, 0x0B, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C, 0x89, 0x0B, 0x00, 0x03, 0x0A, 0x01, 0x0A, 0x05,
+0x9D, 0x0B, 0x00, 0x03, 0x0D, 0x01, 0x0A, 0x05, 0xB7, 0x0B, 0x00, 0x09, 0x09, 0x01, 0x09, 0x0C,
+0xE4, 0x0B, 0x00, 0x0A, 0x04, 0x01, 0x0C, 0x0C, 0xF8, 0x0B, 0x00, 0x09, 0x09, 0x02, 0x09, 0x0C,
+0x25, 0x0C, 0x00, 0x08, 0x0E, 0x00, 0x06, 0x08, 0x5D, 0x0C, 0x00, 0x10, 0x0F, 0x00, 0x07, 0x10,
+0xD5, 0x0C, 0x00, 0x0E, 0x0E, 0x00, 0x06, 0x0E, 0x37, 0x0D, 0x00, 0x0B, 0x0E, 0x01, 0x06, 0x0D,
+0x8B, 0x0D, 0x00, 0x0D, 0x0E, 0x00, 0x06, 0x0E, 0xED, 0x0D, 0x00, 0x0E, 0x0E, 0x01, 0x06, 0x0F,
+0x4F, 0x0E, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0C, 0x95, 0x0E, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0B,
+0xDB, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x06, 0x0F, 0x3D, 0x0F, 0x00, 0x0D, 0x0E, 0x01, 0x06, 0x0F,
+0x9F, 0x0F, 0x00, 0x03, 0x0E, 0x02, 0x06, 0x06, 0xBB, 0x0F, 0x00, 0x08, 0x0E, 0x00, 0x06, 0x09,
+0xF3, 0x0F, 0x00, 0x0D, 0x0E, 0x01, 0x06, 0x0E, 0x55, 0x10, 0x00, 0x09, 0x0E, 0x01, 0x06, 0x0A,
+0x9B, 0x10, 0x00, 0x10, 0x0E, 0x01, 0x06, 0x12, 0x0B, 0x11, 0x00, 0x0D, 0x0E, 0x01, 0x06, 0x0F,
+0x6D, 0x11, 0x00, 0x0F, 0x0E, 0x00, 0x06, 0x10, 0xDD, 0x11, 0x00, 0x0B, 0x0E, 0x01, 0x06, 0x0C,
+0x31, 0x12, 0x00, 0x10, 0x11, 0x00, 0x06, 0x10, 0xB9, 0x12, 0x00, 0x0C, 0x0E, 0x01, 0x06, 0x0D,
+0x0D, 0x13, 0x00, 0x0A, 0x0E, 0x00, 0x06, 0x0B, 0x53, 0x13, 0x00, 0x0C, 0x0E, 0x00, 0x06, 0x0C,
+0xA7, 0x13, 0x00, 0x0C, 0x0E, 0x01, 0x06, 0x0F, 0xFB, 0x13, 0x00, 0x0E, 0x0E, 0x00, 0x06, 0x0E,
+0x5D, 0x14, 0x00, 0x15, 0x0E, 0x00, 0x06, 0x14, 0xF7, 0x14, 0x00, 0x0D, 0x0E, 0x00, 0x06, 0x0D,
+0x59, 0x15, 0x00, 0x0D, 0x0E, 0x00, 0x06, 0x0D, 0xBB, 0x15, 0x00, 0x0C, 0x0E, 0x00, 0x06, 0x0C,
+0x0F, 0x16, 0x00, 0x05, 0x12, 0x01, 0x05, 0x06, 0x45, 0x16, 0x00, 0x09, 0x0F, 0xFF, 0x06, 0x08,
+0x90, 0x16, 0x00, 0x05, 0x12, 0x00, 0x05, 0x06, 0xC6, 0x16, 0x00, 0x09, 0x07, 0x01, 0x06, 0x0C,
+0xE9, 0x16, 0x00, 0x08, 0x01, 0x00, 0x16, 0x08, 0xED, 0x16, 0x00, 0x05, 0x03, 0x00, 0x06, 0x06,
+0xF6, 0x16, 0x00, 0x08, 0x0A, 0x01, 0x0A, 0x0A, 0x1E, 0x17, 0x00, 0x0A, 0x0E, 0x01, 0x06, 0x0B,
+0x64, 0x17, 0x00, 0x09, 0x0A, 0x00, 0x0A, 0x09, 0x96, 0x17, 0x00, 0x0A, 0x0E, 0x00, 0x06, 0x0B,
+0xDC, 0x17, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A, 0x0E, 0x18, 0x00, 0x07, 0x0E, 0x00, 0x06, 0x07,
+0x46, 0x18, 0x00, 0x0A, 0x0D, 0x00, 0x0A, 0x0A, 0x87, 0x18, 0x00, 0x09, 0x0E, 0x01, 0x06, 0x0B,
+0xCD, 0x18, 0x00, 0x03, 0x0E, 0x01, 0x06, 0x05, 0xE9, 0x18, 0x00, 0x05, 0x11, 0xFF, 0x06, 0x05,
+0x1C, 0x19, 0x00, 0x09, 0x0E, 0x01, 0x06, 0x0A, 0x62, 0x19, 0x00, 0x03, 0x0E, 0x01, 0x06, 0x05,
+0x7E, 0x19, 0x00, 0x0F, 0x0A, 0x01, 0x0A, 0x10, 0xCE, 0x19, 0x00, 0x09, 0x0A, 0x01, 0x0A, 0x0B,
+0x00, 0x1A, 0x00, 0x0B, 0x0A, 0x00, 0x0A, 0x0B, 0x3C, 0x1A, 0x00, 0x0A, 0x0D, 0x01, 0x0A, 0x0B,
+0x7D, 0x1A, 0x00, 0x0A, 0x0D, 0x00, 0x0A, 0x0B, 0xBE, 0x1A, 0x00, 0x07, 0x0A, 0x01, 0x0A, 0x08,
+0xE6, 0x1A, 0x00, 0x08, 0x0A, 0x00, 0x0A, 0x09, 0x0E, 0x1B, 0x00, 0x07, 0x0D, 0x00, 0x07, 0x07,
+0x42, 0x1B, 0x00, 0x09, 0x0A, 0x01, 0x0A, 0x0B, 0x74, 0x1B, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+0xA6, 0x1B, 0x00, 0x10, 0x0A, 0x00, 0x0A, 0x0F, 0xF6, 0x1B, 0x00, 0x0A, 0x0A, 0x00, 0x0A, 0x0A,
+0x28, 0x1C, 0x00, 0x0A, 0x0D, 0x00, 0x0A, 0x0A, 0x69, 0x1C, 0x00, 0x09, 0x0A, 0x00, 0x0A, 0x09,
+0x9B, 0x1C, 0x00, 0x06, 0x12, 0x00, 0x05, 0x06, 0xD1, 0x1C, 0x00, 0x02, 0x12, 0x02, 0x05, 0x06,
+0xE3, 0x1C, 0x00, 0x06, 0x12, 0x00, 0x05, 0x06, 0x19, 0x1D, 0x00, 0x0A, 0x04, 0x01, 0x0C, 0x0C,
+0x22, 0x26, 0xFF, 0x22, 0x2C, 0xFE, 0x22, 0x2D, 0xFF, 0x22, 0x2E, 0xFE, 0x22, 0x2F, 0xFF, 0x22,
+0x41, 0xFF, 0x22, 0x61, 0xFF, 0x22, 0x63, 0xFF, 0x22, 0x64, 0xFF, 0x22, 0x65, 0xFF, 0x22, 0x6F,
+0xFF, 0x22, 0x71, 0xFF, 0x27, 0x26, 0xFF, 0x27, 0x2C, 0xFE, 0x27, 0x2D, 0xFF, 0x27, 0x2E, 0xFE,
+0x27, 0x2F, 0xFF, 0x27, 0x41, 0xFF, 0x27, 0x61, 0xFF, 0x27, 0x63, 0xFF, 0x27, 0x64, 0xFF, 0x27,
+0x65, 0xFF, 0x27, 0x6F, 0xFF, 0x27, 0x71, 0xFF, 0x2A, 0x26, 0xFF, 0x2A, 0x2C, 0xFE, 0x2A, 0x2D,
+0xFF, 0x2A, 0x2E, 0xFE, 0x2A, 0x2F, 0xFF, 0x2A, 0x41, 0xFF, 0x2A, 0x61, 0xFF, 0x2A, 0x63, 0xFF,
+0x2A, 0x64, 0xFF, 0x2A, 0x65, 0xFF, 0x2A, 0x6F, 0xFF, 0x2A, 0x71, 0xFF, 0x2C, 0x22, 0xFE, 0x2C,
+0x27, 0xFE, 0x2C, 0x2A, 0xFE, 0x2C, 0x2D, 0xFF, 0x2C, 0x54, 0xFF, 0x2C, 0x56, 0xFF, 0x2C, 0x57,
+0xFF, 0x2C, 0x59, 0xFF, 0x2C, 0x5C, 0xFF, 0x2C, 0x76, 0xFF, 0x2C, 0x79, 0xFF, 0x2D, 0x22, 0xFF,
+0x2D, 0x27, 0xFF, 0x2D, 0x2A, 0xFF, 0x2D, 0x2C, 0xFF, 0x2D, 0x2E, 0xFF, 0x2D, 0x54, 0xFF, 0x2D,
+0x56, 0xFF, 0x2D, 0x59, 0xFF, 0x2D, 0x5C, 0xFF, 0x2E, 0x22, 0xFE, 0x2E, 0x27, 0xFE, 0x2E, 0x2A,
+0xFE, 0x2E, 0x2D, 0xFF, 0x2E, 0x54, 0xFF, 0x2E, 0x56, 0xFF, 0x2E, 0x57, 0xFF, 0x2E, 0x59, 0xFF,
+0x2E, 0x5C, 0xFF, 0x2E, 0x76, 0xFF, 0x2E, 0x79, 0xFF, 0x2F, 0x26, 0xFF, 0x2F, 0x2C, 0xFE, 0x2F,
+0x2D, 0xFF, 0x2F, 0x2E, 0xFE, 0x2F, 0x2F, 0xFF, 0x2F, 0x3A, 0xFF, 0x2F, 0x3B, 0xFF, 0x2F, 0x41,
+0xFF, 0x2F, 0x4A, 0xFF, 0x2F, 0x61, 0xFF, 0x2F, 0x63, 0xFF, 0x2F, 0x64, 0xFF, 0x2F, 0x65, 0xFF,
+0x2F, 0x67, 0xFF, 0x2F, 0x6D, 0xFF, 0x2F, 0x6E, 0xFF, 0x2F, 0x6F, 0xFF, 0x2F, 0x70, 0xFF, 0x46,
+0x4A, 0xFE, 0x4C, 0x22, 0xFE, 0x4C, 0x27, 0xFE, 0x4C, 0x2A, 0xFE, 0x4C, 0x2D, 0xFE, 0x4C, 0x40,
+0xFF, 0x4C, 0x43, 0xFF, 0x4C, 0x47, 0xFF, 0x4C, 0x4F, 0xFF, 0x4C, 0x51, 0xFF, 0x4C, 0x54, 0xFF,
+0x4C, 0x56, 0xFF, 0x4C, 0x57, 0xFF, 0x4C, 0x59, 0xFE, 0x4C, 0x5C, 0xFF, 0x4C, 0x76, 0xFF, 0x4C,
+0x77, 0xFF, 0x4C, 0x79, 0xFF, 0x4F, 0x54, 0xFF, 0x4F, 0x59, 0xFF, 0x4F, 0x5A, 0xFF, 0x50, 0x26,
+0xFF, 0x50, 0x2C, 0xFE, 0x50, 0x2E, 0xFE, 0x50, 0x2F, 0xFF, 0x50, 0x41, 0xFF, 0x54, 0x4A, 0xFE,
+0x54, 0x61, 0xFE, 0x54, 0x63, 0xFE, 0x54, 0x64, 0xFE, 0x54, 0x65, 0xFE, 0x54, 0x67, 0xFF, 0x54,
+0x6D, 0xFF, 0x54, 0x6E, 0xFF, 0x54, 0x6F, 0xFE, 0x54, 0x70, 0xFF, 0x54, 0x71, 0xFE, 0x54, 0x72,
+0xFF, 0x54, 0x73, 0xFF, 0x54, 0x75, 0xFF, 0x54, 0x76, 0xFF, 0x54, 0x77, 0xFF, 0x54, 0x78, 0xFF,
+0x54, 0x79, 0xFF, 0x54, 0x7A, 0xFF, 0x56, 0x26, 0xFF, 0x56, 0x2C, 0xFE, 0x56, 0x2D, 0xFF, 0x56,
+0x2E, 0xFE, 0x56, 0x2F, 0xFF, 0x56, 0x3A, 0xFF, 0x56, 0x3B, 0xFF, 0x56, 0x41, 0xFF, 0x56, 0x4A,
+0xFF, 0x56, 0x61, 0xFF, 0x56, 0x63, 0xFF, 0x56, 0x64, 0xFF, 0x56, 0x65, 0xFF, 0x56, 0x67, 0xFF,
+0x56, 0x6D, 0xFF, 0x56, 0x6E, 0xFF, 0x56, 0x6F, 0xFF, 0x56, 0x70, 0xFF, 0x56, 0x71, 0xFF, 0x56,
+0x72, 0xFF, 0x56, 0x73, 0xFF, 0x56, 0x75, 0xFF, 0x56, 0x7A, 0xFF, 0x57, 0x26, 0xFF, 0x57, 0x2C,
+0xFF, 0x57, 0x2E, 0xFF, 0x57, 0x2F, 0xFF, 0x57, 0x41, 0xFF, 0x57, 0x4A, 0xFF, 0x57, 0x61, 0xFF,
+0x57, 0x67, 0xFF, 0x58, 0x74, 0xFF, 0x58, 0x76, 0xFF, 0x58, 0x79, 0xFF, 0x59, 0x26, 0xFF, 0x59,
+0x2C, 0xFF, 0x59, 0x2D, 0xFF, 0x59, 0x2E, 0xFF, 0x59, 0x2F, 0xFF, 0x59, 0x3A, 0xFF, 0x59, 0x3B,
+0xFF, 0x59, 0x40, 0xFF, 0x59, 0x41, 0xFF, 0x59, 0x43, 0xFF, 0x59, 0x47, 0xFF, 0x59, 0x4A, 0xFE,
+0x59, 0x4F, 0xFF, 0x59, 0x51, 0xFF, 0x59, 0x61, 0xFF, 0x59, 0x63, 0xFF, 0x59, 0x64, 0xFF, 0x59,
+0x65, 0xFF, 0x59, 0x67, 0xFF, 0x59, 0x6D, 0xFF, 0x59, 0x6E, 0xFF, 0x59, 0x6F, 0xFF, 0x59, 0x70,
+0xFF, 0x59, 0x71, 0xFF, 0x59, 0x72, 0xFF, 0x59, 0x73, 0xFF, 0x59, 0x75, 0xFF, 0x59, 0x76, 0xFF,
+0x59, 0x77, 0xFF, 0x59, 0x78, 0xFF, 0x59, 0x79, 0xFF, 0x5A, 0x2D, 0xFF, 0x5C, 0x22, 0xFF, 0x5C,
+0x27, 0xFF, 0x5C, 0x2A, 0xFF, 0x5C, 0x54, 0xFF, 0x5C, 0x56, 0xFF, 0x5C, 0x57, 0xFF, 0x5C, 0x59,
+0xFF, 0x5C, 0x5C, 0xFF, 0x5C, 0x76, 0xFF, 0x5C, 0x79, 0xFF, 0x61, 0x22, 0xFF, 0x61, 0x27, 0xFF,
+0x61, 0x2A, 0xFF, 0x62, 0x22, 0xFF, 0x62, 0x27, 0xFF, 0x62, 0x2A, 0xFF, 0x62, 0x56, 0xFF, 0x62,
+0x5C, 0xFF, 0x65, 0x22, 0xFF, 0x65, 0x27, 0xFF, 0x65, 0x2A, 0xFF, 0x65, 0x56, 0xFF, 0x65, 0x5C,
+0xFF, 0x66, 0x22, 0x01, 0x66, 0x27, 0x01, 0x66, 0x2A, 0x01, 0x66, 0x2C, 0xFF, 0x66, 0x2E, 0xFF,
+0x68, 0x22, 0xFF, 0x68, 0x27, 0xFF, 0x68, 0x2A, 0xFF, 0x6D, 0x22, 0xFF, 0x6D, 0x27, 0xFF, 0x6D,
+0x2A, 0xFF, 0x6E, 0x22, 0xFF, 0x6E, 0x27, 0xFF, 0x6E, 0x2A, 0xFF, 0x6F, 0x22, 0xFF, 0x6F, 0x27,
+0xFF, 0x6F, 0x2A, 0xFF, 0x6F, 0x56, 0xFF, 0x6F, 0x5C, 0xFF, 0x70, 0x22, 0xFF, 0x70, 0x27, 0xFF,
+0x70, 0x2A, 0xFF, 0x70, 0x56, 0xFF, 0x70, 0x5C, 0xFF, 0x72, 0x2C, 0xFF, 0x72, 0x2E, 0xFF, 0x76,
+0x26, 0xFF, 0x76, 0x2C, 0xFF, 0x76, 0x2E, 0xFF, 0x76, 0x2F, 0xFF, 0x76, 0x41, 0xFF, 0x79, 0x26,
+0xFF, 0x79, 0x2C, 0xFF, 0x79, 0x2E, 0xFF, 0x79, 0x2F, 0xFF, 0x79, 0x41, 0xFF, 0x6F, 0x40, 0x6F,
+0x40, 0x6F, 0x40, 0x6F, 0x40, 0x6F, 0x40, 0x6F, 0x40, 0x5F, 0x40, 0x5F, 0x30, 0x3F, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x60, 0x7F, 0x12, 0xF6, 0x7F, 0x12, 0xF6, 0x7F,
+0x12, 0xF6, 0x6F, 0x01, 0xF5, 0x3C, 0x00, 0xD2, 0x00, 0x00, 0x9B, 0x00, 0xC8, 0x00, 0x00, 0x00,
+0xE8, 0x01, 0xF7, 0x00, 0x00, 0x03, 0xF4, 0x04, 0xF4, 0x00, 0x00, 0x06, 0xF1, 0x07, 0xF1, 0x00,
+0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0B, 0xB0, 0x0C, 0xA0, 0x00, 0x00, 0x0E, 0x80, 0x0F,
+0x70, 0x00, 0x00, 0x1F, 0x60, 0x2F, 0x50, 0x00, 0x00, 0x4F, 0x40, 0x4F, 0x30, 0x00, 0x6F, 0xFF,
+0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x9D, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xDA, 0x00, 0xD9, 0x00, 0x00,
+0x01, 0xF6, 0x02, 0xF6, 0x00, 0x00, 0x04, 0xE2, 0x03, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x30,
+0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, 0x4B, 0xEF, 0xD9, 0x20, 0x07, 0xFC, 0x9F, 0x9E, 0xE1,
+0x1F, 0xB0, 0x3E, 0x01, 0x40, 0x4F, 0x60, 0x4D, 0x00, 0x00, 0x3F, 0xA0, 0x5C, 0x00, 0x00, 0x0C,
+0xFA, 0x9B, 0x00, 0x00, 0x01, 0xAF, 0xFE, 0x93, 0x00, 0x00, 0x02, 0xBE, 0xFF, 0x80, 0x00, 0x00,
+0x97, 0x2C, 0xF5, 0x00, 0x00, 0xB6, 0x03, 0xF8, 0x00, 0x00, 0xC5, 0x03, 0xF8, 0x69, 0x10, 0xD4,
+0x0A, 0xF3, 0x9F, 0xE9, 0xEA, 0xCF, 0x80, 0x04, 0xAE, 0xFF, 0xC5, 0x00, 0x00, 0x01, 0xF1, 0x00,
+0x00, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xAE, 0xD8, 0x00, 0x00, 0x02, 0xDA, 0x00, 0x0B, 0xB1,
+0x3D, 0x70, 0x00, 0x0C, 0xC1, 0x00, 0x2F, 0x40, 0x07, 0xD0, 0x00, 0x8E, 0x20, 0x00, 0x4F, 0x20,
+0x05, 0xF0, 0x05, 0xF5, 0x00, 0x00, 0x2F, 0x40, 0x07, 0xE0, 0x2E, 0x90, 0x00, 0x00, 0x0B, 0xB1,
+0x2D, 0x71, 0xCC, 0x00, 0x00, 0x00, 0x01, 0xAE, 0xD7, 0x09, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0x42, 0xAE, 0xD7, 0x00, 0x00, 0x00, 0x03, 0xE8, 0x0C, 0xA1, 0x3E, 0x60, 0x00, 0x00,
+0x1D, 0xB0, 0x3F, 0x30, 0x08, 0xC0, 0x00, 0x00, 0xAE, 0x10, 0x5F, 0x10, 0x06, 0xE0, 0x00, 0x07,
+0xF4, 0x00, 0x3F, 0x30, 0x08, 0xD0, 0x00, 0x3F, 0x70, 0x00, 0x0C, 0xA1, 0x3E, 0x60, 0x01, 0xDA,
+0x00, 0x00, 0x02, 0xAE, 0xD7, 0x00, 0x00, 0x00, 0x7D, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x09, 0xE5,
+0x14, 0xEA, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x6E, 0x10, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x9E, 0xF5, 0x00, 0x2F, 0x50, 0x09, 0xF6,
+0x03, 0xEF, 0x40, 0x5F, 0x30, 0x1F, 0xC0, 0x00, 0x3E, 0xF4, 0xBD, 0x00, 0x2F, 0xA0, 0x00, 0x02,
+0xEE, 0xF7, 0x00, 0x0E, 0xD1, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x04, 0xFB, 0x30, 0x27, 0xEC, 0xDF,
+0x50, 0x00, 0x3A, 0xEF, 0xDA, 0x50, 0x1B, 0xF7, 0x7F, 0x10, 0x7F, 0x10, 0x7F, 0x10, 0x6F, 0x00,
+0x3C, 0x00, 0x00, 0x04, 0x00, 0x00, 0x7F, 0x10, 0x01, 0xEA, 0x00, 0x07, 0xF2, 0x00, 0x0C, 0xC0,
+0x00, 0x2F, 0x70, 0x00, 0x5F, 0x40, 0x00, 0x8F, 0x10, 0x00, 0x9F, 0x00, 0x00, 0xAE, 0x00, 0x00,
+0x9E, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x6F, 0x20, 0x00, 0x3F, 0x50, 0x00, 0x0E, 0xA0, 0x00, 0x09,
+0xE1, 0x00, 0x04, 0xF7, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x2A, 0x00, 0x04, 0x00, 0x00, 0x2F, 0x50,
+0x00, 0x0B, 0xD0, 0x00, 0x04, 0xF5, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x6F, 0x30,
+0x00, 0x3F, 0x60, 0x00, 0x1F, 0x70, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x70, 0x00, 0x2F, 0x60, 0x00,
+0x4F, 0x40, 0x00, 0x8F, 0x10, 0x00, 0xCD, 0x00, 0x02, 0xF7, 0x00, 0x09, 0xF2, 0x00, 0x1F, 0x90,
+0x00, 0x1B, 0x10, 0x00, 0x00, 0x76, 0x00, 0x94, 0x76, 0x49, 0x2A, 0xDD, 0xA2, 0x2A, 0xDD, 0xA2,
+0x94, 0x76, 0x59, 0x00, 0x76, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00,
+0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xFF,
+0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, 0x00,
+0xE8, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, 0xCE, 0x30, 0x0E, 0x40, 0x8B, 0x00, 0x61, 0x00,
+0xFF, 0xFF, 0xE0, 0xCE, 0x30, 0x00, 0x00, 0x01, 0xD6, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0D,
+0x80, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 0x09, 0xD0,
+0x00, 0x00, 0x1E, 0x70, 0x00, 0x00, 0x6F, 0x10, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x04, 0xF3, 0x00,
+0x00, 0x0A, 0xC0, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xCF, 0xEA, 0x30, 0x00, 0x00, 0xAE, 0x51, 0x2A, 0xF4, 0x00, 0x06, 0xF5, 0x00,
+0x00, 0xCE, 0x10, 0x0D, 0xE0, 0x00, 0x00, 0x5F, 0x60, 0x2F, 0xA0, 0x00, 0x00, 0x1F, 0xB0, 0x5F,
+0x80, 0x00, 0x00, 0x0E, 0xE0, 0x6F, 0x70, 0x00, 0x00, 0x0D, 0xF0, 0x6F, 0x70, 0x00, 0x00, 0x0D,
+0xF0, 0x5F, 0x80, 0x00, 0x00, 0x0E, 0xE0, 0x2F, 0xA0, 0x00, 0x00, 0x1F, 0xB0, 0x0D, 0xE0, 0x00,
+0x00, 0x5F, 0x70, 0x06, 0xF5, 0x00, 0x00, 0xCE, 0x10, 0x00, 0xAE, 0x51, 0x2A, 0xF4, 0x00, 0x00,
+0x06, 0xCF, 0xEA, 0x30, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x00, 0x00, 0x09,
+0xFC, 0xFB, 0x00, 0x00, 0xAF, 0x91, 0xFB, 0x00, 0x00, 0x56, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01,
+0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB,
+0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00,
+0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x5B, 0xEE, 0xB4, 0x00,
+0x09, 0xF6, 0x11, 0x8F, 0x60, 0x4F, 0x70, 0x00, 0x0B, 0xE1, 0x6C, 0x10, 0x00, 0x08, 0xF4, 0x00,
+0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00,
+0x09, 0xFD, 0x10, 0x00, 0x00, 0x8F, 0xE2, 0x00, 0x00, 0x08, 0xFE, 0x30, 0x00, 0x00, 0x8F, 0xE3,
+0x00, 0x00, 0x08, 0xFE, 0x30, 0x00, 0x00, 0x7F, 0xE4, 0x00, 0x00, 0x00, 0xEF, 0xEE, 0xFF, 0xFF,
+0xF8, 0x00, 0x4B, 0xEE, 0xC7, 0x00, 0x07, 0xF8, 0x21, 0x6F, 0xB0, 0x2F, 0x90, 0x00, 0x09, 0xF3,
+0x3A, 0x20, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x02, 0x8F, 0x70, 0x00,
+0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x02, 0x6E, 0xC1, 0x00, 0x00, 0x00, 0x06, 0xF7, 0x00, 0x00,
+0x00, 0x02, 0xFA, 0x9C, 0x00, 0x00, 0x03, 0xF9, 0x7F, 0x60, 0x00, 0x08, 0xF5, 0x1C, 0xE6, 0x11,
+0x7F, 0x90, 0x01, 0x7D, 0xFE, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0xCF, 0xF0, 0x00, 0x00, 0x00, 0x09, 0xFB, 0xF0, 0x00, 0x00, 0x00, 0x6F, 0x78, 0xF0, 0x00, 0x00,
+0x03, 0xFB, 0x08, 0xF0, 0x00, 0x00, 0x1E, 0xD1, 0x08, 0xF0, 0x00, 0x00, 0xCF, 0x30, 0x08, 0xF0,
+0x00, 0x09, 0xF7, 0x00, 0x08, 0xF0, 0x00, 0x5F, 0xB0, 0x00, 0x08, 0xF0, 0x00, 0x6F, 0xFF, 0xFF,
+0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xA0,
+0x05, 0xF2, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x0D,
+0xA0, 0x00, 0x00, 0x00, 0x1F, 0xEE, 0xFE, 0xA3, 0x00, 0x04, 0x41, 0x14, 0xCF, 0x40, 0x00, 0x00,
+0x00, 0x1E, 0xD0, 0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00,
+0x0C, 0xF1, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x9D, 0x61, 0x15, 0xEC, 0x10, 0x39, 0xDF, 0xFC, 0x71,
+0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x03, 0xEB, 0x00, 0x00,
+0x00, 0x1D, 0xC1, 0x00, 0x00, 0x00, 0xAD, 0x10, 0x00, 0x00, 0x06, 0xFC, 0xDF, 0xD8, 0x10, 0x2E,
+0xF6, 0x12, 0x8F, 0xB0, 0x8F, 0x60, 0x00, 0x09, 0xF5, 0xCE, 0x00, 0x00, 0x03, 0xFA, 0xDD, 0x00,
+0x00, 0x01, 0xFB, 0xCE, 0x00, 0x00, 0x03, 0xF8, 0x7F, 0x50, 0x00, 0x0A, 0xF3, 0x0C, 0xE5, 0x11,
+0x9F, 0x70, 0x00, 0x7D, 0xFE, 0xB4, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x05,
+0xFA, 0x00, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00, 0x00, 0xDF, 0x30,
+0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x5F, 0xA0, 0x00, 0x00,
+0x00, 0xCF, 0x30, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x00, 0x5F,
+0xA0, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFE,
+0xB3, 0x00, 0x0B, 0xE5, 0x12, 0x9F, 0x60, 0x5F, 0x60, 0x00, 0x0D, 0xE0, 0x8F, 0x40, 0x00, 0x0A,
+0xF1, 0x5F, 0x60, 0x00, 0x0D, 0xE0, 0x0B, 0xE5, 0x12, 0x9F, 0x50, 0x01, 0xBF, 0xFF, 0xF6, 0x00,
+0x2D, 0xD4, 0x12, 0x8F, 0x90, 0xBF, 0x30, 0x00, 0x09, 0xF5, 0xFD, 0x00, 0x00, 0x05, 0xF8, 0xFD,
+0x00, 0x00, 0x04, 0xF9, 0xBF, 0x30, 0x00, 0x09, 0xF4, 0x2E, 0xD4, 0x12, 0x8F, 0xA0, 0x01, 0x8D,
+0xFE, 0xC6, 0x00, 0x00, 0x3B, 0xEF, 0xC7, 0x00, 0x06, 0xF8, 0x21, 0x5E, 0xB0, 0x2F, 0xA0, 0x00,
+0x05, 0xF5, 0x7F, 0x50, 0x00, 0x01, 0xFA, 0x7F, 0x50, 0x00, 0x00, 0xFB, 0x4F, 0x90, 0x00, 0x05,
+0xFA, 0x0B, 0xF7, 0x11, 0x6E, 0xF5, 0x01, 0x7D, 0xFD, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0xAF, 0x40,
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0x01, 0xEE, 0x20, 0x00, 0x00,
+0x0B, 0xF6, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x7E, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x70, 0x7E, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E,
+0x80, 0x08, 0xA0, 0x3E, 0x30, 0x43, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x00, 0x00, 0x3A, 0xFD,
+0x10, 0x00, 0x2A, 0xFD, 0x60, 0x00, 0x29, 0xFD, 0x60, 0x00, 0x00, 0x6F, 0xE5, 0x00, 0x00, 0x00,
+0x03, 0xAF, 0xC5, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xC5, 0x00, 0x00, 0x00, 0x04, 0xBF, 0x30, 0x00,
+0x00, 0x00, 0x04, 0x20, 0x8F, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF1, 0x98, 0x10, 0x00, 0x00, 0x00, 0x6F, 0xE7, 0x10,
+0x00, 0x00, 0x02, 0x9F, 0xE7, 0x00, 0x00, 0x00, 0x02, 0x9F, 0xD6, 0x00, 0x00, 0x00, 0x19, 0xFE,
+0x10, 0x00, 0x18, 0xEE, 0x71, 0x00, 0x18, 0xEE, 0x81, 0x00, 0x00, 0x9F, 0x81, 0x00, 0x00, 0x00,
+0x52, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xEA, 0x20, 0x6D, 0x51, 0x3C, 0xD1, 0x00, 0x00, 0x03,
+0xF7, 0x00, 0x00, 0x02, 0xF8, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x4E, 0xE1, 0x00, 0x04, 0xFE,
+0x30, 0x00, 0x0E, 0xD2, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x80, 0x00, 0x00, 0x00, 0x05,
+0xBE, 0xFE, 0xB7, 0x10, 0x00, 0x00, 0x02, 0xCC, 0x52, 0x01, 0x49, 0xD5, 0x00, 0x00, 0x3E, 0x70,
+0x00, 0x00, 0x00, 0x3E, 0x40, 0x01, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x06, 0xD0, 0x07, 0xD0, 0x00,
+0x18, 0xDF, 0xEA, 0x00, 0xE5, 0x0D, 0x70, 0x02, 0xDB, 0x30, 0xC9, 0x00, 0xB9, 0x1F, 0x40, 0x0C,
+0xC0, 0x01, 0xF5, 0x00, 0xA9, 0x2F, 0x30, 0x2F, 0x40, 0x04, 0xF1, 0x00, 0xC7, 0x1F, 0x40, 0x4F,
+0x20, 0x0A, 0xD0, 0x02, 0xF2, 0x0D, 0x70, 0x2F, 0x71, 0x6D, 0xE2, 0x2C, 0x80, 0x08, 0xC0, 0x06,
+0xEE, 0xA1, 0xAF, 0xD7, 0x00, 0x01, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x60,
+0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xDC, 0x62, 0x10, 0x14, 0x9E, 0x50, 0x00, 0x00, 0x05,
+0xAD, 0xEF, 0xEB, 0x82, 0x00, 0x00, 0x00, 0x06, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF,
+0x60, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAE, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x4A, 0xF3, 0x00,
+0x00, 0x00, 0x01, 0xED, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x06, 0xF8, 0x00, 0xDF, 0x10, 0x00, 0x00,
+0x0D, 0xF2, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0xAF, 0x50,
+0x00, 0x0B, 0xF4, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00,
+0xCF, 0x20, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x1E, 0xD0,
+0xBF, 0x40, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x4F, 0xFF, 0xFF, 0xEB, 0x60, 0x00, 0x4F, 0xA0, 0x00,
+0x29, 0xFB, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0xCF, 0x30, 0x4F, 0xA0, 0x00, 0x00, 0x9F, 0x50, 0x4F,
+0xA0, 0x00, 0x00, 0xCF, 0x20, 0x4F, 0xA0, 0x01, 0x3A, 0xE5, 0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x60,
+0x00, 0x4F, 0xA0, 0x00, 0x26, 0xEC, 0x10, 0x4F, 0xA0, 0x00, 0x00, 0x6F, 0x80, 0x4F, 0xA0, 0x00,
+0x00, 0x2F, 0xC0, 0x4F, 0xA0, 0x00, 0x00, 0x2F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x7F, 0x70, 0x4F,
+0xA0, 0x00, 0x26, 0xEC, 0x10, 0x4F, 0xFF, 0xFF, 0xEC, 0x70, 0x00, 0x00, 0x00, 0x29, 0xDE, 0xFE,
+0xB6, 0x10, 0x00, 0x08, 0xFB, 0x41, 0x13, 0x9F, 0x90, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x03, 0x10,
+0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x04, 0x20, 0x00,
+0x1A, 0xFA, 0x31, 0x13, 0x9F, 0x90, 0x00, 0x00, 0x4A, 0xDF, 0xED, 0xA4, 0x00, 0x4F, 0xFF, 0xFF,
+0xED, 0x94, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x13, 0x9F, 0x90, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x05,
+0xFA, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xB0,
+0x4F, 0xA0, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x0D, 0xF2, 0x4F, 0xA0,
+0x00, 0x00, 0x00, 0x0D, 0xF2, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x4F, 0xA0, 0x00, 0x00,
+0x00, 0x3F, 0xB0, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x05, 0xFA,
+0x00, 0x4F, 0xA0, 0x00, 0x13, 0x9F, 0xA0, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x94, 0x00, 0x00, 0x4F,
+0xFF, 0xFF, 0xFF, 0xF8, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0,
+0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF,
+0xFF, 0x40, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00,
+0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00,
+0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x4F, 0xFF, 0xFF, 0xFF, 0xF8, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F,
+0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0,
+0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x80, 0x4F, 0xA0, 0x00,
+0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00,
+0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xCE, 0xFE,
+0xC9, 0x30, 0x00, 0x08, 0xFA, 0x41, 0x12, 0x6D, 0xE2, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x01, 0x30,
+0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,
+0x0E, 0xFF, 0xF7, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x05,
+0xF7, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x05, 0xF7, 0x00,
+0x08, 0xFA, 0x41, 0x02, 0x7E, 0xF7, 0x00, 0x00, 0x39, 0xDE, 0xFE, 0xDA, 0x61, 0x4F, 0xA0, 0x00,
+0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00,
+0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50,
+0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x4F, 0xA0,
+0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00,
+0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F,
+0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x50, 0xEF,
+0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF,
+0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0xEF, 0x10, 0x00, 0x00, 0x0C, 0xF2, 0x00,
+0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00,
+0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00,
+0x00, 0x0C, 0xF1, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x03, 0xCE, 0x20, 0x4E,
+0xFE, 0xA2, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x9F, 0x90,
+0x00, 0x1F, 0xD0, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x1F,
+0xD0, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x5F, 0xB1, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE,
+0x30, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x3E, 0xE2, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x05, 0xFC, 0x10,
+0x00, 0x00, 0x1F, 0xD0, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x0A, 0xF7, 0x00, 0x00,
+0x1F, 0xD0, 0x00, 0x01, 0xCF, 0x50, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x2E, 0xE3, 0x00, 0x1F, 0xD0,
+0x00, 0x00, 0x04, 0xED, 0x10, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F,
+0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0,
+0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00,
+0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00,
+0x00, 0x4F, 0xA0, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xD0, 0x4F, 0xD1, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFA, 0x4F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFA, 0x4F, 0xEF, 0x20, 0x00, 0x00,
+0x00, 0xAE, 0xFA, 0x4F, 0x8F, 0xA0, 0x00, 0x00, 0x04, 0xF8, 0xFA, 0x4F, 0x78, 0xF4, 0x00, 0x00,
+0x0C, 0xD1, 0xFA, 0x4F, 0x71, 0xEC, 0x00, 0x00, 0x5F, 0x61, 0xFA, 0x4F, 0x70, 0x6F, 0x60, 0x01,
+0xDC, 0x01, 0xFA, 0x4F, 0x70, 0x0D, 0xE1, 0x07, 0xF4, 0x01, 0xFA, 0x4F, 0x70, 0x04, 0xF8, 0x1E,
+0xB0, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0xBE, 0xAF, 0x30, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x3F, 0xFA,
+0x00, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x08, 0xE2, 0x00, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x01, 0xFA, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFA, 0x4F, 0x80, 0x00, 0x00, 0x00,
+0x5F, 0x50, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x4F, 0xFE, 0x20, 0x00, 0x00, 0x5F, 0x50,
+0x4F, 0x9E, 0xC0, 0x00, 0x00, 0x5F, 0x50, 0x4F, 0x75, 0xF9, 0x00, 0x00, 0x5F, 0x50, 0x4F, 0x70,
+0x9F, 0x60, 0x00, 0x5F, 0x50, 0x4F, 0x70, 0x0C, 0xE3, 0x00, 0x5F, 0x50, 0x4F, 0x70, 0x02, 0xED,
+0x10, 0x5F, 0x50, 0x4F, 0x70, 0x00, 0x4F, 0xA0, 0x5F, 0x50, 0x4F, 0x70, 0x00, 0x08, 0xF7, 0x5F,
+0x50, 0x4F, 0x70, 0x00, 0x00, 0xBF, 0x9F, 0x50, 0x4F, 0x70, 0x00, 0x00, 0x1D, 0xFF, 0x50, 0x4F,
+0x70, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x4F, 0x70, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x39,
+0xDE, 0xED, 0x92, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x31, 0x14, 0xAF, 0x80, 0x00, 0x00, 0x9F, 0x60,
+0x00, 0x00, 0x07, 0xF8, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x30, 0x0A, 0xF4, 0x00,
+0x00, 0x00, 0x00, 0x5F, 0x90, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x1F, 0xE0, 0x00,
+0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0xF1, 0x00,
+0x00, 0x00, 0x00, 0x1F, 0xD0, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x04, 0xFA, 0x00,
+0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x09, 0xF9,
+0x31, 0x13, 0xAF, 0x80, 0x00, 0x00, 0x00, 0x39, 0xDE, 0xED, 0x93, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+0xDA, 0x40, 0x00, 0x1F, 0xD0, 0x01, 0x4C, 0xF7, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xDF, 0x20, 0x1F,
+0xD0, 0x00, 0x00, 0x9F, 0x60, 0x1F, 0xD0, 0x00, 0x00, 0x7F, 0x70, 0x1F, 0xD0, 0x00, 0x00, 0x9F,
+0x60, 0x1F, 0xD0, 0x00, 0x01, 0xEE, 0x10, 0x1F, 0xD0, 0x01, 0x4C, 0xF5, 0x00, 0x1F, 0xFF, 0xFF,
+0xD9, 0x30, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F,
+0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x39, 0xDE, 0xED, 0x92, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x31, 0x14, 0xAF, 0x70,
+0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xBF,
+0x20, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F,
+0xD0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0F,
+0xF0, 0x0E, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x5F,
+0xB0, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x07, 0xFC,
+0x00, 0x00, 0x09, 0xF9, 0x31, 0x13, 0xAF, 0xD2, 0x00, 0x00, 0x00, 0x39, 0xDE, 0xFE, 0xDF, 0x50,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDE,
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xE4, 0x1F, 0xFF, 0xFF, 0xDA, 0x40, 0x00, 0x1F,
+0xD0, 0x01, 0x4C, 0xF6, 0x00, 0x1F, 0xD0, 0x00, 0x01, 0xEE, 0x10, 0x1F, 0xD0, 0x00, 0x00, 0xBF,
+0x30, 0x1F, 0xD0, 0x00, 0x00, 0xCF, 0x20, 0x1F, 0xD0, 0x00, 0x02, 0xFC, 0x00, 0x1F, 0xD0, 0x01,
+0x5D, 0xE3, 0x00, 0x1F, 0xFF, 0xFF, 0xE7, 0x10, 0x00, 0x1F, 0xD0, 0x1A, 0xF6, 0x00, 0x00, 0x1F,
+0xD0, 0x01, 0xDF, 0x30, 0x00, 0x1F, 0xD0, 0x00, 0x3F, 0xD1, 0x00, 0x1F, 0xD0, 0x00, 0x07, 0xFA,
+0x00, 0x1F, 0xD0, 0x00, 0x00, 0xBF, 0x60, 0x1F, 0xD0, 0x00, 0x00, 0x2D, 0xF3, 0x00, 0x18, 0xDF,
+0xEC, 0x82, 0x00, 0xCC, 0x31, 0x28, 0xF4, 0x07, 0xF3, 0x00, 0x00, 0x10, 0x0B, 0xF1, 0x00, 0x00,
+0x00, 0x0B, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD8, 0x30, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x30,
+0x00, 0x05, 0xBF, 0xFF, 0xF3, 0x00, 0x00, 0x01, 0x7E, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0xFB, 0x05, 0x10, 0x00, 0x04, 0xF6, 0x3F, 0xD5, 0x21, 0x4D, 0xB0, 0x04, 0x9D,
+0xFF, 0xC7, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F,
+0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x6F, 0x80, 0x00,
+0x00, 0x00, 0xEF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x6F,
+0x80, 0x00, 0x00, 0x00, 0xEF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x6F, 0x80, 0x00, 0x00, 0x00,
+0xEF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x6F, 0x80, 0x00, 0x00, 0x00, 0xEF, 0x4F, 0x90, 0x00,
+0x00, 0x00, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x03, 0xFA, 0x08, 0xF5, 0x00, 0x00, 0x0B, 0xF3, 0x00,
+0xAF, 0x71, 0x03, 0xBF, 0x50, 0x00, 0x05, 0xBE, 0xFD, 0x92, 0x00, 0xBF, 0x40, 0x00, 0x00, 0x00,
+0x0A, 0xF5, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0x8F, 0x70,
+0x07, 0xF8, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x01, 0xFE, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x9F,
+0x50, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x0C, 0xF3, 0x00,
+0x9F, 0x60, 0x00, 0x00, 0x06, 0xF9, 0x01, 0xEE, 0x10, 0x00, 0x00, 0x00, 0xEE, 0x16, 0xF8, 0x00,
+0x00, 0x00, 0x00, 0x8F, 0x6C, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xCF, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00,
+0x00, 0x0A, 0xF3, 0x00, 0x00, 0x00, 0xDF, 0x10, 0x6F, 0xB0, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,
+0x04, 0xFB, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x0B, 0xF5,
+0x00, 0x00, 0xBE, 0x9F, 0x40, 0x00, 0x0D, 0xF2, 0x00, 0x06, 0xFA, 0x00, 0x02, 0xF9, 0x3F, 0x90,
+0x00, 0x3F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x07, 0xF4, 0x0D, 0xE0, 0x00, 0x7F, 0x70, 0x00, 0x00,
+0xCF, 0x40, 0x0C, 0xE0, 0x08, 0xF4, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x7F, 0x80, 0x2F, 0x90, 0x03,
+0xF9, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x7F, 0x30, 0x00, 0xDE, 0x06, 0xF8, 0x00, 0x00,
+0x00, 0x0C, 0xF3, 0xCD, 0x00, 0x00, 0x8F, 0x5B, 0xF3, 0x00, 0x00, 0x00, 0x08, 0xF9, 0xF8, 0x00,
+0x00, 0x3F, 0xAE, 0xD0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF3, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00,
+0x00, 0x00, 0x00, 0xDF, 0xD0, 0x00, 0x00, 0x07, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80,
+0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x5F, 0xD1, 0x00, 0x00, 0x01, 0xDF, 0x30, 0x09, 0xF9,
+0x00, 0x00, 0x09, 0xF7, 0x00, 0x01, 0xDF, 0x30, 0x00, 0x4F, 0xC0, 0x00, 0x00, 0x4F, 0xD0, 0x01,
+0xDE, 0x20, 0x00, 0x00, 0x08, 0xF8, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x6F, 0xA0, 0x00,
+0x00, 0x00, 0x00, 0x3F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xEF, 0x50, 0x00, 0x00, 0x00,
+0x02, 0xED, 0x2E, 0xE1, 0x00, 0x00, 0x00, 0x0B, 0xF3, 0x06, 0xFA, 0x00, 0x00, 0x00, 0x7F, 0x80,
+0x00, 0xBF, 0x50, 0x00, 0x03, 0xFD, 0x10, 0x00, 0x2F, 0xE1, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x07,
+0xFA, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x9F, 0x70, 0x00, 0x00, 0x00, 0xCF, 0x30,
+0x1E, 0xE2, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x06, 0xFA, 0x00, 0x00, 0x2E, 0xE1, 0x00, 0x00, 0xBF,
+0x40, 0x00, 0xAF, 0x50, 0x00, 0x00, 0x2F, 0xD0, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x08, 0xF7, 0x0D,
+0xE2, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A,
+0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFB, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xB0, 0x00, 0x00, 0x00,
+0x09, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00,
+0x00, 0x0A, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x80, 0x00,
+0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x70,
+0x00, 0x00, 0x00, 0x0C, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x9F,
+0xFF, 0x10, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00,
+0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00,
+0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x9E,
+0x00, 0x00, 0x9F, 0xFF, 0x10, 0x1E, 0x50, 0x00, 0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, 0x02,
+0xF4, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, 0x0D,
+0x80, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xAC,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 0x06, 0xF1,
+0x00, 0x00, 0x00, 0x01, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x50,
+0x1F, 0xFF, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00,
+0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E,
+0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90, 0x00, 0x0E, 0x90,
+0x00, 0x0E, 0x90, 0x1F, 0xFF, 0x90, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x20, 0x00,
+0x00, 0x3F, 0x7D, 0xA0, 0x00, 0x00, 0xCD, 0x16, 0xF4, 0x00, 0x05, 0xF6, 0x00, 0xCC, 0x00, 0x0D,
+0xC0, 0x00, 0x4F, 0x50, 0x27, 0x30, 0x00, 0x06, 0x60, 0xFF, 0xFF, 0xFF, 0xFD, 0x3F, 0xC0, 0x00,
+0x05, 0xF7, 0x00, 0x00, 0x7E, 0x10, 0x06, 0xBE, 0xFC, 0x40, 0x6F, 0x82, 0x1A, 0xF4, 0x13, 0x00,
+0x01, 0xFB, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, 0xDE, 0x03, 0x9C, 0xEF, 0xFE, 0x8F, 0x94,
+0x10, 0xDE, 0xFB, 0x00, 0x00, 0xDE, 0xDD, 0x20, 0x3A, 0xEE, 0x3C, 0xEE, 0xB4, 0x8E, 0x7F, 0x50,
+0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00,
+0x00, 0x00, 0x7F, 0x57, 0xDF, 0xD8, 0x00, 0x7F, 0xE7, 0x11, 0x8F, 0x80, 0x7F, 0x70, 0x00, 0x0C,
+0xF1, 0x7F, 0x50, 0x00, 0x08, 0xF5, 0x7F, 0x50, 0x00, 0x06, 0xF6, 0x7F, 0x50, 0x00, 0x07, 0xF6,
+0x7F, 0x50, 0x00, 0x09, 0xF4, 0x7F, 0x50, 0x00, 0x0E, 0xE0, 0x7F, 0xD4, 0x02, 0xAF, 0x50, 0x7F,
+0x4B, 0xEE, 0xB4, 0x00, 0x00, 0x29, 0xDF, 0xDA, 0x30, 0x02, 0xEC, 0x30, 0x29, 0x60, 0x0B, 0xF2,
+0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00,
+0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x02, 0xED, 0x30, 0x3A,
+0xA0, 0x00, 0x2A, 0xEF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA,
+0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x2A, 0xEF, 0xC7, 0xFA, 0x03,
+0xEC, 0x30, 0x3C, 0xFA, 0x0B, 0xF2, 0x00, 0x03, 0xFA, 0x1F, 0xB0, 0x00, 0x02, 0xFA, 0x4F, 0x90,
+0x00, 0x02, 0xFA, 0x4F, 0x90, 0x00, 0x02, 0xFA, 0x2F, 0xA0, 0x00, 0x02, 0xFA, 0x0D, 0xE1, 0x00,
+0x04, 0xFA, 0x06, 0xFA, 0x21, 0x5D, 0xFA, 0x00, 0x6D, 0xFD, 0x91, 0xDA, 0x00, 0x29, 0xDF, 0xD8,
+0x10, 0x02, 0xEC, 0x31, 0x4D, 0xB0, 0x0B, 0xE1, 0x00, 0x04, 0xF5, 0x1F, 0xA0, 0x00, 0x00, 0xF9,
+0x4F, 0xFF, 0xFF, 0xFF, 0xF9, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0x00, 0x00, 0x0A,
+0xF2, 0x00, 0x00, 0x00, 0x02, 0xDD, 0x41, 0x26, 0xD4, 0x00, 0x19, 0xDF, 0xEC, 0x70, 0x00, 0x18,
+0xDE, 0x70, 0x00, 0xAF, 0x40, 0x00, 0x01, 0xFA, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0xAF, 0xFF,
+0xFF, 0x80, 0x03, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA,
+0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x02, 0xFA,
+0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x5C, 0xEF, 0xFF, 0xFE, 0x07, 0xF6, 0x11, 0x9F, 0xB4,
+0x0D, 0xB0, 0x00, 0x0F, 0x90, 0x0E, 0xB0, 0x00, 0x0F, 0x90, 0x08, 0xF6, 0x11, 0x9E, 0x30, 0x00,
+0xBE, 0xEE, 0xA3, 0x00, 0x06, 0xE1, 0x00, 0x00, 0x00, 0x09, 0xF4, 0x10, 0x00, 0x00, 0x03, 0xEE,
+0xFF, 0xFD, 0x91, 0x2D, 0x80, 0x00, 0x17, 0xF8, 0x7F, 0x20, 0x00, 0x01, 0xF9, 0x3F, 0xA3, 0x11,
+0x3B, 0xE2, 0x03, 0xAD, 0xFE, 0xC8, 0x10, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00,
+0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x48, 0xDF, 0xD5, 0x00,
+0x8F, 0xE7, 0x11, 0xAF, 0x40, 0x8F, 0x50, 0x00, 0x1F, 0xB0, 0x8F, 0x40, 0x00, 0x0E, 0xD0, 0x8F,
+0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40,
+0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x6E, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F,
+0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x00, 0x6E, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F,
+0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70, 0x00, 0x5F, 0x70,
+0x00, 0x5F, 0x70, 0x00, 0x5F, 0x60, 0x01, 0xAF, 0x30, 0x7F, 0xD6, 0x00, 0x7F, 0x50, 0x00, 0x00,
+0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00,
+0x7F, 0x50, 0x00, 0x8F, 0x60, 0x7F, 0x50, 0x07, 0xF7, 0x00, 0x7F, 0x50, 0x7F, 0x70, 0x00, 0x7F,
+0x56, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xD0, 0x00, 0x00, 0x7F, 0x55, 0xF9, 0x00, 0x00, 0x7F, 0x50,
+0x8F, 0x60, 0x00, 0x7F, 0x50, 0x0B, 0xF3, 0x00, 0x7F, 0x50, 0x01, 0xED, 0x10, 0x7F, 0x50, 0x00,
+0x4E, 0xB0, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70,
+0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x5F, 0x70, 0x8E, 0x2A,
+0xEE, 0x80, 0x4C, 0xED, 0x80, 0x00, 0x8F, 0xD4, 0x15, 0xFA, 0xD4, 0x15, 0xF9, 0x00, 0x8F, 0x50,
+0x00, 0xBF, 0x60, 0x00, 0xBF, 0x00, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x20, 0x8F, 0x40,
+0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40,
+0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40,
+0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8F, 0x40, 0x00, 0x9F, 0x30, 0x00, 0x9F, 0x30, 0x8E, 0x18,
+0xDF, 0xD5, 0x00, 0x8F, 0xD7, 0x11, 0xAF, 0x40, 0x8F, 0x50, 0x00, 0x1F, 0xB0, 0x8F, 0x40, 0x00,
+0x0E, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D,
+0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0, 0x8F, 0x40, 0x00, 0x0D, 0xD0,
+0x00, 0x29, 0xDF, 0xEA, 0x20, 0x00, 0x02, 0xED, 0x30, 0x2B, 0xE3, 0x00, 0x0B, 0xF2, 0x00, 0x01,
+0xEC, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0xAF, 0x30, 0x4F, 0x90, 0x00, 0x00, 0x8F, 0x50, 0x4F, 0x90,
+0x00, 0x00, 0x8F, 0x50, 0x1F, 0xB0, 0x00, 0x00, 0xAF, 0x30, 0x0B, 0xF2, 0x00, 0x01, 0xEC, 0x00,
+0x02, 0xEC, 0x30, 0x2B, 0xE3, 0x00, 0x00, 0x29, 0xDF, 0xEA, 0x20, 0x00, 0x8E, 0x18, 0xDF, 0xD7,
+0x00, 0x8F, 0xD7, 0x12, 0x8F, 0x70, 0x8F, 0x60, 0x00, 0x0D, 0xE1, 0x8F, 0x40, 0x00, 0x09, 0xF4,
+0x8F, 0x40, 0x00, 0x07, 0xF5, 0x8F, 0x40, 0x00, 0x08, 0xF5, 0x8F, 0x40, 0x00, 0x0A, 0xF3, 0x8F,
+0x40, 0x00, 0x1E, 0xD0, 0x8F, 0xD4, 0x02, 0xBF, 0x40, 0x8F, 0x8C, 0xFE, 0xB3, 0x00, 0x8F, 0x40,
+0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF,
+0xC5, 0xDA, 0x03, 0xEC, 0x30, 0x3C, 0xFA, 0x0B, 0xF2, 0x00, 0x03, 0xFA, 0x1F, 0xB0, 0x00, 0x02,
+0xFA, 0x4F, 0x90, 0x00, 0x02, 0xFA, 0x4F, 0x90, 0x00, 0x02, 0xFA, 0x2F, 0xA0, 0x00, 0x02, 0xFA,
+0x0D, 0xE1, 0x00, 0x04, 0xFA, 0x06, 0xFA, 0x21, 0x5E, 0xFA, 0x00, 0x6D, 0xFE, 0x93, 0xFA, 0x00,
+0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFA, 0x8E, 0x29,
+0xEF, 0x70, 0x8F, 0xD7, 0x10, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x8F, 0x40,
+0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x01, 0x8D, 0xED, 0xA3, 0x0A, 0xE4, 0x13, 0x94, 0x1F, 0xA0,
+0x00, 0x00, 0x0F, 0xE7, 0x10, 0x00, 0x07, 0xFF, 0xFB, 0x40, 0x00, 0x39, 0xDF, 0xF5, 0x00, 0x00,
+0x06, 0xFB, 0x00, 0x00, 0x00, 0xEA, 0x1C, 0x61, 0x17, 0xF4, 0x18, 0xCF, 0xEB, 0x40, 0x00, 0x7C,
+0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xB0, 0x00, 0xEC,
+0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC,
+0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0xBE, 0x22, 0x40, 0x00, 0x2C,
+0xED, 0x80, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F,
+0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0, 0xCF, 0x00, 0x00, 0x2F, 0xA0,
+0xBF, 0x00, 0x00, 0x2F, 0xA0, 0x9F, 0x20, 0x00, 0x3F, 0xA0, 0x3F, 0xB2, 0x15, 0xDF, 0xA0, 0x04,
+0xCF, 0xE9, 0x2D, 0xA0, 0x9F, 0x30, 0x00, 0x00, 0xDD, 0x3F, 0xA0, 0x00, 0x05, 0xF6, 0x0C, 0xF1,
+0x00, 0x0B, 0xE1, 0x06, 0xF7, 0x00, 0x2F, 0x90, 0x00, 0xED, 0x00, 0x8F, 0x30, 0x00, 0x8F, 0x40,
+0xEC, 0x00, 0x00, 0x2F, 0xA5, 0xF5, 0x00, 0x00, 0x0B, 0xEB, 0xE0, 0x00, 0x00, 0x05, 0xFF, 0x80,
+0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0xBE, 0x20, 0x00, 0x3F, 0x90, 0x00, 0x0A, 0xF1, 0x6F, 0x70,
+0x00, 0x8F, 0xE0, 0x00, 0x1F, 0xA0, 0x1F, 0xB0, 0x00, 0xDC, 0xF4, 0x00, 0x5F, 0x50, 0x0B, 0xF1,
+0x03, 0xF4, 0xE9, 0x00, 0xAF, 0x10, 0x06, 0xF5, 0x08, 0xE0, 0x9E, 0x00, 0xEB, 0x00, 0x01, 0xFA,
+0x0D, 0x90, 0x4F, 0x44, 0xF6, 0x00, 0x00, 0xBE, 0x3F, 0x40, 0x0E, 0x98, 0xF1, 0x00, 0x00, 0x6F,
+0xAE, 0x00, 0x09, 0xDC, 0xB0, 0x00, 0x00, 0x1F, 0xF9, 0x00, 0x04, 0xFF, 0x60, 0x00, 0x00, 0x0B,
+0xF3, 0x00, 0x00, 0xDF, 0x10, 0x00, 0x4F, 0xB0, 0x00, 0x08, 0xF4, 0x08, 0xF6, 0x00, 0x4F, 0x90,
+0x00, 0xCE, 0x21, 0xDD, 0x10, 0x00, 0x3F, 0xB9, 0xF3, 0x00, 0x00, 0x07, 0xFF, 0x70, 0x00, 0x00,
+0x08, 0xFF, 0xA0, 0x00, 0x00, 0x4F, 0x98, 0xF6, 0x00, 0x01, 0xDD, 0x11, 0xDE, 0x20, 0x0A, 0xF3,
+0x00, 0x4F, 0xB0, 0x6F, 0x70, 0x00, 0x08, 0xF7, 0xAF, 0x40, 0x00, 0x00, 0xDD, 0x3F, 0xB0, 0x00,
+0x05, 0xF6, 0x0B, 0xF3, 0x00, 0x0C, 0xE1, 0x04, 0xF9, 0x00, 0x3F, 0x80, 0x00, 0xCF, 0x10, 0xAF,
+0x10, 0x00, 0x5F, 0x81, 0xF9, 0x00, 0x00, 0x0D, 0xE8, 0xF2, 0x00, 0x00, 0x07, 0xFF, 0xB0, 0x00,
+0x00, 0x01, 0xEF, 0x40, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00,
+0x0C, 0xD0, 0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x01, 0xDF, 0x40, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x02, 0xEE,
+0x20, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x04, 0xFD, 0x10, 0x00,
+0x00, 0x1E, 0xF3, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x5C, 0xE1, 0x03, 0xF7,
+0x00, 0x09, 0xE0, 0x00, 0x0A, 0xD0, 0x00, 0x09, 0xF0, 0x00, 0x07, 0xF2, 0x00, 0x04, 0xF4, 0x00,
+0x03, 0xF4, 0x00, 0x09, 0xE1, 0x00, 0x8F, 0x50, 0x00, 0x08, 0xE1, 0x00, 0x03, 0xF4, 0x00, 0x05,
+0xF3, 0x00, 0x08, 0xF1, 0x00, 0x0A, 0xE0, 0x00, 0x09, 0xE0, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x6C,
+0xE1, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA, 0xBA,
+0xBA, 0xBA, 0xBA, 0x1E, 0xC5, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x0E, 0x90, 0x00, 0x0D, 0xA0, 0x00,
+0x0F, 0x90, 0x00, 0x2F, 0x60, 0x00, 0x4F, 0x40, 0x00, 0x4F, 0x30, 0x00, 0x1E, 0x80, 0x00, 0x05,
+0xF8, 0x00, 0x1E, 0x80, 0x00, 0x4F, 0x30, 0x00, 0x3F, 0x50, 0x00, 0x1F, 0x80, 0x00, 0x0E, 0xA0,
+0x00, 0x0E, 0x90, 0x00, 0x6F, 0x40, 0x1E, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF5, 0x1A, 0xEE,
+0xA4, 0x18, 0xE2, 0x9D, 0x22, 0x6C, 0xED, 0x50, 0x65, 0x00, 0x00, 0x00, 0x00
+};
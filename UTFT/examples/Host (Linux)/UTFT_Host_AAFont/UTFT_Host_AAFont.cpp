@@ -0,0 +1,202 @@
+// UTFT_Host_AAFont
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks the anti-aliased proportional fonts against a
+// simple reference renderer.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -DUTFT_AA_FONTS -Wno-write-strings -I../../.. UTFT_Host_AAFont.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o aafont
+//   ./aafont
+//
+// Lato20 (4 bits per pixel) and Lato14 (2 bits per pixel) were made from
+// Lato-Regular.ttf with the FontConverter tool, and are included directly
+// as the font files are not C++:
+//   FontConverter -b 4 -s 20 Lato-Regular.ttf Lato20
+//   FontConverter -b 2 -s 14 Lato-Regular.ttf Lato14
+//
+// The text is drawn in portrait and landscape mode, on a solid and on a
+// transparent background, and compared pixel by pixel. The bytes sent to
+// the display are compared with the same text in BigFont. The screen is
+// saved as aafont.ppm.
+//
+
+#include <UTFT.h>
+
+#if !defined(UTFT_AA_FONTS)
+  #error "This example must be built with -DUTFT_AA_FONTS"
+#endif
+
+#include "Lato20.c"
+#include "Lato14.c"
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+int   errors = 0;
+
+// Reference renderer: decodes the font format directly and blends every
+// pixel with floating point math
+word blend(word fg, word bg, int a, int levels)
+{
+  float f = float(a)/levels;
+  int   r = int((((bg>>11) & 0x1F)*(1-f))+(((fg>>11) & 0x1F)*f)+0.5f);
+  int   g = int((((bg>>5) & 0x3F)*(1-f))+(((fg>>5) & 0x3F)*f)+0.5f);
+  int   b = int(((bg & 0x1F)*(1-f))+((fg & 0x1F)*f)+0.5f);
+
+  return (r<<11) | (g<<5) | b;
+}
+
+int kerning(const uint8_t *font, byte l, byte r)
+{
+  const uint8_t *k = font+8+(font[3]*8);
+
+  for (int i=0; i<font[7]; i++)
+    if ((k[i*3]==l) and (k[(i*3)+1]==r))
+      return int8_t(k[(i*3)+2]);
+  return 0;
+}
+
+// Draws the alpha values of st into alpha[] and returns the width
+int reference(const uint8_t *font, const char *st, int w, int *alpha)
+{
+  int bpp = font[4], h = font[1], pen = 0;
+
+  memset(alpha, 0, w*h*sizeof(int));
+  for (const char *c=st; *c!=0; c++)
+  {
+    const uint8_t *e = font+8+((*c-font[2])*8);
+    long    offset = e[0] | (e[1]<<8) | (long(e[2])<<16);
+    int     bpr = ((e[3]*bpp)+7)/8;
+
+    for (int y=0; y<e[4]; y++)
+      for (int x=0; x<e[3]; x++)
+      {
+        int a = (font[offset+(y*bpr)+((x*bpp)/8)]>>(8-bpp-((x*bpp)%8))) & ((1<<bpp)-1);
+        int px = pen+int8_t(e[5])+x, py = e[6]+y;
+
+        if ((px>=0) and (px<w) and (a>alpha[(py*w)+px]))
+          alpha[(py*w)+px] = a;
+      }
+    pen += e[7];
+    if (c[1]!=0)
+      pen += kerning(font, c[0], c[1]);
+  }
+  return pen;
+}
+
+void check(const char *name, const uint8_t *font, const char *st, byte orient, boolean transparent)
+{
+  static int alpha[320*32];
+  int   x = 10, y = 40, w, h = font[1], levels = (1<<font[4])-1, diff = 0;
+  word  fg = VGA_YELLOW, bg = VGA_NAVY, expect;
+
+  myGLCD.InitLCD(orient);
+  myGLCD.setFont((uint8_t*)font);
+  myGLCD.fillScr(VGA_MAROON);
+  myGLCD.setColor(fg);
+  if (transparent)
+  {
+    myGLCD.setColor(bg);
+    myGLCD.fillRect(0, y, myGLCD.getDisplayXSize()-1, y+h-1);
+    myGLCD.setColor(fg);
+  }
+  myGLCD.setBackColor(transparent ? VGA_TRANSPARENT : bg);
+  utft_host.resetStats();
+  myGLCD.print((char*)st, x, y);
+  unsigned long bytes = utft_host.stats.bytes, windows = utft_host.stats.windows;
+
+  w = reference(font, st, myGLCD.getDisplayXSize()-x, alpha);
+  if (w!=myGLCD.getTextWidth((char*)st))
+  {
+    printf("  getTextWidth() returned %d, expected %d\n", myGLCD.getTextWidth((char*)st), w);
+    diff++;
+  }
+  // The last character may reach past the pen position
+  int right = w;
+  for (int i=0; i<(myGLCD.getDisplayXSize()-x)*h; i++)
+    if ((alpha[i]!=0) and ((i % (myGLCD.getDisplayXSize()-x))>=right))
+      right = (i % (myGLCD.getDisplayXSize()-x))+1;
+
+  for (int py=0; py<h; py++)
+    for (int px=0; px<myGLCD.getDisplayXSize()-x; px++)
+    {
+      int a = alpha[(py*(myGLCD.getDisplayXSize()-x))+px];
+
+      if (transparent)
+        expect = ((a*2)>levels) ? fg : bg;
+      else if (px<right)
+        expect = blend(fg, bg, a, levels);
+      else
+        expect = VGA_MAROON;
+      if (utft_host.getPixel(x+px, y+py)!=expect)
+        diff++;
+    }
+
+  myGLCD.setFont(BigFont);
+  myGLCD.setBackColor(bg);
+  utft_host.resetStats();
+  myGLCD.print((char*)st, x, y+h);
+
+  printf("%-8s %s %-12s %5lu bytes in %3lu windows  (BigFont %5lu bytes)\n", name,
+    orient==PORTRAIT ? "P" : "L", transparent ? "transparent" : "solid",
+    bytes, windows, utft_host.stats.bytes);
+  if (diff!=0)
+  {
+    printf("  FAILED: %d pixels differ\n", diff);
+    errors++;
+  }
+}
+
+int main()
+{
+  const char *text = "AVAWAY To Vary";
+
+  for (int o=0; o<2; o++)
+  {
+    byte orient = (o==0) ? PORTRAIT : LANDSCAPE;
+
+    check("Lato20", Lato20, text, orient, false);
+    check("Lato20", Lato20, text, orient, true);
+    check("Lato14", Lato14, text, orient, false);
+    check("Lato14", Lato14, text, orient, true);
+  }
+
+  // Blend table: alpha 0 and full must give the exact back and front colors
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.setFont((uint8_t*)Lato20);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+  myGLCD.fillScr(VGA_BLACK);
+  myGLCD.print("I", 0, 0);
+  boolean full = false;
+  for (int y=0; y<Lato20[1]; y++)
+    for (int x=0; x<Lato20[5]; x++)
+      if (utft_host.getPixel(x, y)==VGA_WHITE)
+        full = true;
+  if (!full)
+  {
+    printf("FAILED: no pixel in the front color\n");
+    errors++;
+  }
+
+  // Sample screen
+  myGLCD.fillScr(VGA_WHITE);
+  myGLCD.setColor(VGA_BLACK);
+  myGLCD.setBackColor(VGA_WHITE);
+  myGLCD.print("Anti-aliased text", CENTER, 10);
+  myGLCD.setColor(VGA_BLUE);
+  myGLCD.print("with kerning: AVAWAY", CENTER, 40);
+  myGLCD.setFont((uint8_t*)Lato14);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_NAVY);
+  myGLCD.print("2 bits per pixel, on a navy back", 0, 80);
+  myGLCD.setColor(VGA_RED);
+  myGLCD.setBackColor(VGA_TRANSPARENT);
+  myGLCD.print("Transparent text", RIGHT, 110);
+  utft_host.savePPM("aafont.ppm");
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
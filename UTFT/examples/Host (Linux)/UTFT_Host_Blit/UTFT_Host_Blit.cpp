@@ -0,0 +1,173 @@
+// UTFT_Host_Blit
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks blit() with sprites cut from one sprite sheet.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_Blit.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o blit
+//   ./blit
+//
+// Sprites are drawn inside the screen, across every edge and completely
+// outside it, with and without a clip rectangle and a color key, in
+// portrait and landscape mode. Every pixel around the sprite is compared
+// with the expected result, and the number of windows must be one per
+// visible run of pixels, or one for the whole sprite without a color key.
+// The bytes sent are compared with drawBitmap() of the same sprite. The
+// screen is saved as blit.ppm.
+//
+
+#include <UTFT.h>
+
+#define SHEET_W		64
+#define SHEET_H		16
+#define KEY			VGA_FUCHSIA
+#define BACK		VGA_NAVY
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+// Four 16x16 sprites on a background in the key color
+unsigned short sheet[SHEET_W*SHEET_H] PROGMEM;
+int     errors = 0, checks = 0;
+
+void makeSheet()
+{
+  word colors[4] = {VGA_RED, VGA_LIME, VGA_YELLOW, VGA_AQUA};
+
+  for (int y=0; y<SHEET_H; y++)
+    for (int x=0; x<SHEET_W; x++)
+    {
+      int s = x/16, dx = (x%16)-8, dy = y-8;
+      word c = KEY;
+
+      if ((s==0) and ((dx*dx)+(dy*dy)<56))              // Ball
+        c = colors[0] | ((((dx*dx)+(dy*dy))/2)<<5);
+      else if ((s==1) and (abs(dx)+abs(dy)<8))          // Diamond
+        c = colors[1] | (y<<1);
+      else if ((s==2) and ((abs(dx)<2) or (abs(dy)<2))) // Cross
+        c = colors[2];
+      else if ((s==3) and ((x+y) & 2))                  // Stripes
+        c = colors[3] ^ (x<<3);
+      sheet[(y*SHEET_W)+x] = c;
+    }
+}
+
+void check(byte orient, int sprite, int dx, int dy, boolean key, boolean clip)
+{
+  int cx1 = 20, cy1 = 30, cx2 = 60, cy2 = 70;
+  int sx = myGLCD.getDisplayXSize(), sy = myGLCD.getDisplayYSize();
+  int diff = 0, runs = 0;
+
+  myGLCD.InitLCD(orient);
+  myGLCD.fillScr(BACK);
+  if (key)
+    myGLCD.setColorKey(KEY);
+  else
+    myGLCD.clrColorKey();
+  if (clip)
+    myGLCD.setBlitClip(cx2, cy2, cx1, cy1);
+  else
+    myGLCD.clrBlitClip();
+  utft_host.resetStats();
+  myGLCD.blit(sheet, SHEET_W, sprite*16, 0, 16, 16, dx, dy);
+
+  for (int y=dy-2; y<dy+18; y++)
+  {
+    boolean in_run = false;
+
+    for (int x=dx-2; x<dx+18; x++)
+    {
+      boolean visible = (x>=0) and (y>=0) and (x<sx) and (y<sy);
+      boolean inside = (x>=dx) and (y>=dy) and (x<dx+16) and (y<dy+16);
+      word    src = inside ? sheet[((y-dy)*SHEET_W)+(sprite*16)+x-dx] : KEY;
+      word    expect = BACK;
+
+      if (clip and ((x<cx1) or (y<cy1) or (x>cx2) or (y>cy2)))
+        inside = false;
+      if (inside and visible and (!key or (src!=KEY)))
+      {
+        expect = src;
+        if (!in_run)
+          runs++;
+        in_run = true;
+      }
+      else
+        in_run = false;
+      if (visible and (utft_host.getPixel(x, y)!=expect))
+        diff++;
+    }
+  }
+  if (!key)
+    runs = runs ? 1 : 0;
+  checks++;
+  if ((diff!=0) or (utft_host.stats.windows!=(unsigned long)runs))
+  {
+    printf("FAILED: %s sprite %d at %d,%d%s%s: %d pixels differ, %lu windows, expected %d\n",
+      orient==PORTRAIT ? "portrait" : "landscape", sprite, dx, dy, key ? " key" : "", clip ? " clip" : "",
+      diff, utft_host.stats.windows, runs);
+    errors++;
+  }
+}
+
+int main()
+{
+  int positions[][2] = {{100, 100}, {-7, 50}, {50, -9}, {-15, -15}, {-16, 40}, {40, -16},
+                        {230, 100}, {100, 310}, {233, 313}, {239, 319}, {240, 100}, {100, 320},
+                        {310, 200}, {470, 200}, {15, 25}, {55, 65}, {-100, -100}};
+
+  makeSheet();
+  for (int o=0; o<2; o++)
+    for (unsigned p=0; p<sizeof(positions)/sizeof(positions[0]); p++)
+      for (int mode=0; mode<4; mode++)
+        check(o==0 ? PORTRAIT : LANDSCAPE, p % 4, positions[p][0], positions[p][1], mode & 1, mode & 2);
+  printf("%d cases checked\n", checks);
+
+  // Compared with drawBitmap() of the same sprite, cut out of the sheet
+  static unsigned short sprite[16*16];
+  for (int y=0; y<16; y++)
+    for (int x=0; x<16; x++)
+      sprite[(y*16)+x] = sheet[(y*SHEET_W)+x+16];
+  for (int o=0; o<2; o++)
+  {
+    unsigned long bytes[3], windows[3];
+
+    myGLCD.InitLCD(o==0 ? PORTRAIT : LANDSCAPE);
+    myGLCD.clrBlitClip();
+    myGLCD.clrColorKey();
+    utft_host.resetStats();
+    myGLCD.drawBitmap(100, 100, 16, 16, sprite);
+    bytes[0] = utft_host.stats.bytes;
+    windows[0] = utft_host.stats.windows;
+    utft_host.resetStats();
+    myGLCD.blit(sheet, SHEET_W, 16, 0, 16, 16, 100, 100);
+    bytes[1] = utft_host.stats.bytes;
+    windows[1] = utft_host.stats.windows;
+    myGLCD.setColorKey(KEY);
+    utft_host.resetStats();
+    myGLCD.blit(sheet, SHEET_W, 16, 0, 16, 16, 100, 100);
+    bytes[2] = utft_host.stats.bytes;
+    windows[2] = utft_host.stats.windows;
+    printf("%-9s drawBitmap() %4lu bytes in %2lu windows, blit() %4lu bytes in %2lu windows, with color key %4lu bytes in %2lu windows\n",
+      o==0 ? "Portrait" : "Landscape", bytes[0], windows[0], bytes[1], windows[1], bytes[2], windows[2]);
+  }
+
+  // Sample screen: sprites along the edges, and inside a clip rectangle
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.fillScr(BACK);
+  myGLCD.setColorKey(KEY);
+  myGLCD.clrBlitClip();
+  for (int i=0; i<20; i++)
+  {
+    myGLCD.blit(sheet, SHEET_W, (i%4)*16, 0, 16, 16, (i*13)-8, -6);
+    myGLCD.blit(sheet, SHEET_W, (i%4)*16, 0, 16, 16, 232-(i*13), 310);
+  }
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.drawRect(59, 99, 181, 221);
+  myGLCD.setBlitClip(60, 100, 180, 220);
+  for (int i=0; i<64; i++)
+    myGLCD.blit(sheet, SHEET_W, (i%4)*16, 0, 16, 16, 50+((i%8)*18), 90+((i/8)*18));
+  myGLCD.clrBlitClip();
+  utft_host.savePPM("blit.ppm");
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,353 @@
+// UTFT_Host_BusTrace
+//
+// This program runs the library on a PC against the emulated display
+// controller, records everything sent to the display with setBusTrace()
+// and replays the trace into a second, freshly attached emulator.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -DUTFT_BUS_TRACE -Wno-write-strings -I../../.. UTFT_Host_BusTrace.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o bustrace
+//   ./bustrace
+//
+// A small dashboard is animated for 30 frames on a serial and on a 16bit
+// display. The replayed screen and bus counters must match the recorded
+// session exactly. The replay is then used to print the bytes sent by
+// each primitive, the number of windows set up per frame and the number
+// of pixels that were written with the value they already had.
+//
+// The trace of the serial display is saved as bustrace.bin. A trace
+// recorded on a real board (see the UTFT_BusTrace example) can be
+// analysed by giving the file name as an argument:
+//   ./bustrace capture.bin
+// The screen at the end of the trace is then saved as replay.ppm.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+#define FRAMES	30
+
+const char *prim_names[PRIM_COUNT] = {"(other)", "clrScr", "fillScr", "drawPixel", "drawLine",
+  "drawRect", "drawRoundRect", "fillRect", "fillRoundRect", "drawCircle", "fillCircle",
+  "fillEllipse", "drawArc", "fillArc", "print", "printNumI", "printNumF", "drawBitmap",
+  "drawPackedBitmap", "pushPixels", "blit", "drawBitmapStream", "fillTriangle", "fillPolygon",
+  "drawPolyline"};
+
+uint8_t *trace = 0;
+long    trace_len = 0, trace_size = 0;
+int     errors = 0;
+
+UTFT serialLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+UTFT parallelLCD(ILI9481, 38, 39, 40, 41);
+
+void traceSink(const uint8_t *data, int len)
+{
+  if (trace_len+len>trace_size)
+  {
+    trace_size = (trace_len+len)*2;
+    trace = (uint8_t*)realloc(trace, trace_size);
+  }
+  memcpy(trace+trace_len, data, len);
+  trace_len += len;
+}
+
+// *** Recording ***
+unsigned short icon[16*16];
+
+void makeIcon()
+{
+  for (int y=0; y<16; y++)
+    for (int x=0; x<16; x++)
+      icon[(y*16)+x] = ((x-8)*(x-8))+((y-8)*(y-8))<49 ? VGA_LIME : VGA_BLACK;
+}
+
+void drawFrame(UTFT &lcd, int frame)
+{
+  int w = lcd.getDisplayXSize(), h = lcd.getDisplayYSize();
+  int cx = w/2, cy = h/2, r = min(w, h)/4;
+  int angle = (frame*12) % 360;
+
+  if (frame==0)
+    lcd.clrScr();
+
+  // Static parts are drawn again every frame, as simple sketches do
+  lcd.setColor(VGA_NAVY);
+  lcd.fillRect(0, 0, w-1, 17);
+  lcd.setFont(SmallFont);
+  lcd.setColor(VGA_WHITE);
+  lcd.setBackColor(VGA_NAVY);
+  lcd.print("Bus trace", CENTER, 3);
+  lcd.setColor(VGA_GRAY);
+  lcd.drawRect(0, 18, w-1, h-1);
+  lcd.drawCircle(cx, cy, r+2);
+  lcd.drawBitmap(4, 22, 16, 16, icon);
+
+  // Gauge
+  lcd.setColor(VGA_BLACK);
+  lcd.fillCircle(cx, cy, r);
+  lcd.setColor(VGA_YELLOW);
+  lcd.drawArc(cx, cy, r, 0, angle);
+  lcd.setColor(VGA_RED);
+  lcd.drawLine(cx, cy, cx+int(r*sin(angle*M_PI/180)), cy-int(r*cos(angle*M_PI/180)));
+  lcd.drawPixel(cx, cy);
+
+  // Readouts
+  lcd.setFont(BigFont);
+  lcd.setColor(VGA_WHITE);
+  lcd.setBackColor(VGA_BLACK);
+  lcd.printNumF(20.0+(frame*0.25), 2, CENTER, h-40, '.', 6);
+  lcd.setFont(SmallFont);
+  lcd.printNumI(frame, 24, 26, 4, '0');
+  lcd.setColor(frame & 1 ? VGA_GREEN : VGA_MAROON);
+  lcd.fillRoundRect(w-44, 24, w-6, 40);
+}
+
+// *** Replay ***
+struct Report
+{
+  unsigned long calls[PRIM_COUNT], bytes[PRIM_COUNT], windows[PRIM_COUNT];
+  unsigned long pixels[PRIM_COUNT], redundant[PRIM_COUNT];
+  unsigned long frames, frame_windows, max_windows, frame_bytes;
+};
+
+UTFT           *replay_lcd = 0;
+UTFT_HostStats last, frame_start;
+
+void account(Report *r, int prim)
+{
+  r->bytes[prim] += utft_host.stats.bytes-last.bytes;
+  r->windows[prim] += utft_host.stats.windows-last.windows;
+  r->pixels[prim] += utft_host.stats.pixels-last.pixels;
+  r->redundant[prim] += utft_host.stats.redundant_pixels-last.redundant_pixels;
+  last = utft_host.stats;
+}
+
+long readCount(const uint8_t *t, long *pos)
+{
+  long count = 0;
+  int  shift = 0;
+
+  do
+  {
+    count |= long(t[*pos] & 0x7F)<<shift;
+    shift += 7;
+  } while (t[(*pos)++] & 0x80);
+  return count;
+}
+
+// Sends the trace to the display through the same low level functions,
+// so the emulator sees exactly the same bus writes
+boolean replay(const uint8_t *t, long len, Report *r)
+{
+  long pos = 0;
+  int  prim = 0;
+
+  memset(r, 0, sizeof(Report));
+  while (pos<len)
+  {
+    byte tag = t[pos++];
+
+    if ((replay_lcd==0) and (tag!=TRACE_INIT))
+    {
+      printf("FAILED: the trace does not start with the display model\n");
+      return false;
+    }
+    switch (tag)
+    {
+    case TRACE_INIT:
+      {
+        byte model = t[pos] & 0x7F;
+
+        if ((replay_lcd==0) or (replay_lcd->display_model!=model))
+        {
+          delete replay_lcd;
+          replay_lcd = new UTFT(model, 4, 5, 6, 7, 8);
+        }
+        replay_lcd->orient = (t[pos++] & 0x80) ? LANDSCAPE : PORTRAIT;
+        replay_lcd->_hw_special_init();
+        frame_start = last = utft_host.stats;
+      }
+      break;
+    case TRACE_COM:
+      replay_lcd->LCD_Write_COM(t[pos++]);
+      break;
+    case TRACE_DATA8:
+      for (int n=t[pos++]; n>0; n--)
+        replay_lcd->LCD_Write_DATA(t[pos++]);
+      break;
+    case TRACE_DATA16:
+      for (int n=t[pos++]; n>0; n--, pos+=2)
+        replay_lcd->LCD_Write_DATA(t[pos], t[pos+1]);
+      break;
+    case TRACE_PIXELS:
+    case TRACE_FILL16:
+    case TRACE_FILL8:
+      {
+        byte ch = t[pos++];
+        byte cl = (tag==TRACE_FILL8) ? ch : t[pos++];
+        long pix = readCount(t, &pos);
+
+        if (tag==TRACE_PIXELS)
+          replay_lcd->_write_pixels(ch, cl, pix);
+        else
+        {
+          sbi(replay_lcd->P_RS, replay_lcd->B_RS);
+          if (tag==TRACE_FILL16)
+            replay_lcd->_fast_fill_16(ch, cl, pix);
+          else
+            replay_lcd->_fast_fill_8(ch, pix);
+        }
+      }
+      break;
+    case TRACE_BEGIN:
+      account(r, 0);
+      prim = t[pos++];
+      if (prim>=PRIM_COUNT)
+        prim = 0;
+      r->calls[prim]++;
+      cbi(replay_lcd->P_CS, replay_lcd->B_CS);
+      break;
+    case TRACE_END:
+      account(r, prim);
+      prim = 0;
+      sbi(replay_lcd->P_CS, replay_lcd->B_CS);
+      break;
+    case TRACE_FRAME:
+      r->frames++;
+      r->frame_windows += utft_host.stats.windows-frame_start.windows;
+      r->max_windows = max(r->max_windows, utft_host.stats.windows-frame_start.windows);
+      r->frame_bytes += utft_host.stats.bytes-frame_start.bytes;
+      frame_start = utft_host.stats;
+      break;
+    default:
+      printf("FAILED: unknown event 0x%02X at offset %ld\n", tag, pos-1);
+      return false;
+    }
+  }
+  account(r, prim);
+  if (pos!=len)
+  {
+    printf("FAILED: the last event is incomplete\n");
+    return false;
+  }
+  return true;
+}
+
+void printReport(Report *r)
+{
+  unsigned long pixels = 0, redundant = 0, bytes = 0;
+
+  printf("  %-17s %6s %9s %8s %8s %9s %9s\n", "Primitive", "Calls", "Bytes", "B/call", "Windows", "Pixels", "Redundant");
+  for (int i=0; i<PRIM_COUNT; i++)
+  {
+    if (r->bytes[i]==0)
+      continue;
+    printf("  %-17s %6lu %9lu %8lu %8lu %9lu %9lu\n", prim_names[i], r->calls[i], r->bytes[i],
+      r->calls[i] ? r->bytes[i]/r->calls[i] : 0, r->windows[i], r->pixels[i], r->redundant[i]);
+    pixels += r->pixels[i];
+    redundant += r->redundant[i];
+    bytes += r->bytes[i];
+  }
+  if (r->frames>0)
+    printf("  %lu frames: %.1f windows per frame (at most %lu), %lu bytes per frame\n", r->frames,
+      float(r->frame_windows)/r->frames, r->max_windows, r->frame_bytes/r->frames);
+  printf("  Redundant pixel writes: %lu of %lu (%.1f%%)\n", redundant, pixels, pixels ? (100.0*redundant)/pixels : 0.0);
+  printf("  Trace: %ld bytes for %lu bytes sent to the display\n", trace_len, bytes);
+}
+
+void session(const char *name, UTFT &lcd, const char *filename)
+{
+  static word screen[480*320];
+  UTFT_HostStats recorded;
+  Report r;
+
+  trace_len = 0;
+  utft_host.resetStats();
+  lcd.setBusTrace(traceSink);
+  lcd.InitLCD(PORTRAIT);
+  for (int i=0; i<FRAMES; i++)
+  {
+    drawFrame(lcd, i);
+    lcd.markBusFrame();
+  }
+  lcd.flushBusTrace();
+  lcd.setBusTrace(0);
+  recorded = utft_host.stats;
+  for (int y=0; y<lcd.getDisplayYSize(); y++)
+    for (int x=0; x<lcd.getDisplayXSize(); x++)
+      screen[(y*lcd.getDisplayXSize())+x] = utft_host.getPixel(x, y);
+
+  if (filename!=0)
+  {
+    FILE *f = fopen(filename, "wb");
+
+    if (f!=0)
+    {
+      fwrite(trace, 1, trace_len, f);
+      fclose(f);
+    }
+  }
+
+  printf("%s\n", name);
+  utft_host.resetStats();
+  if (!replay(trace, trace_len, &r))
+  {
+    errors++;
+    return;
+  }
+  if ((utft_host.stats.bytes!=recorded.bytes) or (utft_host.stats.com!=recorded.com) or
+      (utft_host.stats.windows!=recorded.windows) or (utft_host.stats.pixels!=recorded.pixels))
+  {
+    printf("  FAILED: replayed %lu bytes, %lu commands, %lu pixels, recorded %lu bytes, %lu commands, %lu pixels\n",
+      utft_host.stats.bytes, utft_host.stats.com, utft_host.stats.pixels, recorded.bytes, recorded.com, recorded.pixels);
+    errors++;
+  }
+  for (int y=0; y<lcd.getDisplayYSize(); y++)
+    for (int x=0; x<lcd.getDisplayXSize(); x++)
+      if (screen[(y*lcd.getDisplayXSize())+x]!=utft_host.getPixel(x, y))
+      {
+        printf("  FAILED: the replayed screen differs at %d,%d\n", x, y);
+        errors++;
+        y = lcd.getDisplayYSize();
+        break;
+      }
+  printReport(&r);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc>1)
+  {
+    FILE   *f = fopen(argv[1], "rb");
+    Report r;
+
+    if (f==0)
+    {
+      printf("Can not open %s\n", argv[1]);
+      return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    trace_len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    trace = (uint8_t*)malloc(trace_len);
+    if (fread(trace, 1, trace_len, f)!=size_t(trace_len))
+      trace_len = 0;
+    fclose(f);
+    utft_host.resetStats();
+    if (!replay(trace, trace_len, &r))
+      return 1;
+    printf("%s\n", argv[1]);
+    printReport(&r);
+    utft_host.savePPM("replay.ppm");
+    return 0;
+  }
+
+  makeIcon();
+  session("ILI9341_S5P (serial 5pin)", serialLCD, "bustrace.bin");
+  session("ILI9481 (16bit)", parallelLCD, 0);
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+// UTFT_Host_DoubleBuffer
+//
+// This program runs the library on a PC against an emulated CPLD module
+// and checks double buffering with swapBuffers().
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -DUTFT_DIRTY_RECTS=4 -Wno-write-strings -I../../.. UTFT_Host_DoubleBuffer.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o doublebuffer
+//   ./doublebuffer
+//
+// An animation is drawn once without double buffering, keeping a copy of
+// the screen after each frame, and once with double buffering. The drawing
+// code is the same for both; with double buffering the background is also
+// used to repair the areas that swapBuffers() reports. After every swap
+// the page that is shown must match the copy, no pixel may have been
+// written to the page that is shown, and every page change must happen
+// while the emulated TE output is high. Last, waitForVSync() must time
+// out when the TE pin never changes.
+//
+// Without UTFT_DIRTY_RECTS the whole page is repaired after every swap,
+// which also passes but sends far more bytes.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+#define FRAMES	40
+#define WIDTH	800
+#define HEIGHT	480
+#define RADIUS	30
+
+UTFT myGLCD(CPLD, 38, 39, 40, 41);
+
+word  *frames[FRAMES];
+int   errors = 0;
+
+// Horizontal bands, so any part of the background can be drawn again
+void drawBackground(int x1, int y1, int x2, int y2)
+{
+  word color = myGLCD.getColor();
+
+  for (int y=y1; y<=y2; y=((y/40)+1)*40)
+  {
+    int band = y/40;
+
+    myGLCD.setColor(((band*2)<<11) | ((band*4)<<5) | (31-(band*2)));
+    myGLCD.fillRect(x1, y, x2, min(y2, ((band+1)*40)-1));
+  }
+  myGLCD.setColor(color);
+}
+
+int ballX(int frame)
+{
+  return 60+(frame*17);
+}
+
+int ballY(int frame)
+{
+  return 240+int(150*sin(frame*0.3));
+}
+
+void drawFrame(int frame)
+{
+  if (frame==0)
+    drawBackground(0, 0, WIDTH-1, HEIGHT-1);
+  else
+    drawBackground(ballX(frame-1)-RADIUS, ballY(frame-1)-RADIUS, ballX(frame-1)+RADIUS, ballY(frame-1)+RADIUS);
+  myGLCD.setColor(VGA_YELLOW);
+  myGLCD.fillCircle(ballX(frame), ballY(frame), RADIUS);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+  myGLCD.printNumI(frame, 10, 10, 5, '0');
+}
+
+void copyScreen(word *screen)
+{
+  for (int y=0; y<HEIGHT; y++)
+    for (int x=0; x<WIDTH; x++)
+      screen[(y*WIDTH)+x] = utft_host.getPixel(x, y);
+}
+
+int main()
+{
+  static word screen[WIDTH*HEIGHT];
+  unsigned long bytes_single, bytes_double;
+
+  myGLCD.InitLCD();
+  myGLCD.setFont(BigFont);
+  printf("Pages: %d\n", myGLCD.getPageCount());
+
+  utft_host.resetStats();
+  for (int i=0; i<FRAMES; i++)
+  {
+    drawFrame(i);
+    frames[i] = (word*)malloc(WIDTH*HEIGHT*sizeof(word));
+    copyScreen(frames[i]);
+  }
+  bytes_single = utft_host.stats.bytes;
+
+  myGLCD.InitLCD();
+  myGLCD.setFont(BigFont);
+  myGLCD.setTearPin(TE_PIN);
+  if (!myGLCD.beginDoubleBuffer())
+  {
+    printf("FAILED: double buffering is not supported\n");
+    return 1;
+  }
+  utft_host.resetStats();
+  for (int i=0; i<FRAMES; i++)
+  {
+    drawFrame(i);
+    myGLCD.swapBuffers(drawBackground);
+    copyScreen(screen);
+    if (memcmp(screen, frames[i], sizeof(screen))!=0)
+    {
+      printf("FAILED: frame %d differs\n", i);
+      errors++;
+    }
+  }
+  bytes_double = utft_host.stats.bytes;
+  myGLCD.endDoubleBuffer();
+
+  printf("%d frames: %lu bytes single buffered, %lu bytes double buffered\n", FRAMES, bytes_single, bytes_double);
+  printf("Page flips %lu (%lu torn), pixels written to the page shown: %lu, TE reads: %lu\n",
+    utft_host.stats.flips, utft_host.stats.torn_flips, utft_host.stats.shown_pixels, utft_host.stats.te_reads);
+  if ((utft_host.stats.flips!=FRAMES) or (utft_host.stats.torn_flips!=0) or (utft_host.stats.shown_pixels!=0))
+    errors++;
+
+  // A TE pin that never changes (here a pin that is not connected) must
+  // not hang waitForVSync()
+  myGLCD.setTearPin(TE_PIN+1);
+  unsigned long t = micros();
+  myGLCD.waitForVSync();
+  t = micros()-t;
+  printf("waitForVSync() with a stuck TE pin: %lu us\n", t);
+  if ((t<UTFT_VSYNC_TIMEOUT) or (t>1000000))
+  {
+    printf("FAILED: waitForVSync() did not time out\n");
+    errors++;
+  }
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
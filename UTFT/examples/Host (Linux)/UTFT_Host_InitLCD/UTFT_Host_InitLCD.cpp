@@ -0,0 +1,73 @@
+// UTFT_Host_InitLCD
+//
+// This program runs the library on a PC against the emulated display
+// controller and prints, for every supported controller, the time
+// InitLCD() spends in delay() and the number of bytes it sends. The
+// time in delay() is most of the time from power on to the first frame.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_InitLCD.cpp ../../../UTFT.cpp -o initlcd
+//   ./initlcd
+//
+// For the controllers the emulator keeps a picture of, the screen is
+// filled after InitLCD() and checked pixel by pixel.
+//
+
+#include <UTFT.h>
+
+struct model
+{
+  byte  id;
+  char  *name;
+};
+
+model models[] =
+{
+  {HX8347A, "HX8347A"}, {ILI9327, "ILI9327"}, {SSD1289, "SSD1289"}, {ILI9325C, "ILI9325C"},
+  {ILI9325D_8, "ILI9325D_8"}, {ILI9325D_16ALT, "ILI9325D_16ALT"}, {HX8340B_8, "HX8340B_8"},
+  {HX8340B_S, "HX8340B_S"}, {HX8352A, "HX8352A"}, {ST7735, "ST7735"}, {ST7735_ALT, "ST7735_ALT"},
+  {PCF8833, "PCF8833"}, {S1D19122, "S1D19122"}, {SSD1963_480, "SSD1963_480"},
+  {SSD1963_800, "SSD1963_800"}, {SSD1963_800ALT, "SSD1963_800ALT"}, {S6D1121_8, "S6D1121_8"},
+  {ILI9481, "ILI9481"}, {S6D0164, "S6D0164"}, {ST7735S, "ST7735S"}, {ILI9341_S5P, "ILI9341_S5P"},
+  {ILI9341_S4P, "ILI9341_S4P"}, {R61581, "R61581"}, {ILI9486, "ILI9486"}, {CPLD, "CPLD"},
+  {HX8353C, "HX8353C"}
+};
+
+int main()
+{
+  unsigned long total = 0;
+  int           errors = 0;
+
+  printf("%-16s %10s %10s %8s\n", "Controller", "Delay ms", "Bytes", "Screen");
+  for (unsigned int i=0; i<sizeof(models)/sizeof(models[0]); i++)
+  {
+    UTFT  myGLCD(models[i].id, 1, 2, 3, 4, 5);
+    char  *screen = (char *)"-";
+
+    utft_host.resetStats();
+    myGLCD.InitLCD();
+    printf("%-16s %10lu %10lu", models[i].name, utft_host.stats.delay_ms, utft_host.stats.bytes);
+    total += utft_host.stats.delay_ms;
+
+    if (utft_host.emulated)
+    {
+      long diff = 0;
+
+      myGLCD.fillScr(VGA_TEAL);
+      myGLCD.setColor(VGA_YELLOW);
+      myGLCD.fillRect(10, 20, 29, 49);
+      for (int y=0; y<myGLCD.getDisplayYSize(); y++)
+        for (int x=0; x<myGLCD.getDisplayXSize(); x++)
+          if (utft_host.getPixel(x, y)!=((x>=10) and (x<=29) and (y>=20) and (y<=49) ? VGA_YELLOW : VGA_TEAL))
+            diff++;
+      screen = (char *)(diff ? "FAILED" : "OK");
+      if (diff)
+        errors++;
+    }
+    printf(" %8s\n", screen);
+  }
+  printf("%-16s %10lu\n", "Total", total);
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,198 @@
+// UTFT_Host_Numbers
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks printNumI() and printNumF() against the strings
+// made by the original implementation, which formatted the number into
+// a buffer (printNumF() through sprintf()/dtostrf()). Like those, the
+// decimals are rounded from the binary value of the number, so 0.125
+// gives 0.12 and 2.675, stored as 2.67499..., gives 2.67.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -DUTFT_NUM_DIFF=4 -Wno-write-strings -I../../.. UTFT_Host_Numbers.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o numbers
+//   ./numbers
+//
+// The second part draws a live readout 200 times, as a sketch updating a
+// sensor value at 20 Hz would, with and without the digit diff mode and
+// prints the number of bytes sent to the display.
+//
+
+#include <UTFT.h>
+
+#if UTFT_NUM_DIFF==0
+  #error "This example must be built with -DUTFT_NUM_DIFF=4"
+#endif
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+extern uint8_t SevenSegNumFont[];
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+int   errors = 0;
+word  expected[240*32];
+
+// The original string formatting
+void refNumI(char *st, long num, int length, char filler)
+{
+  char buf[25];
+  int  c = 0;
+
+  sprintf(buf, "%lu", num<0 ? 0-(unsigned long)num : (unsigned long)num);
+  c = strlen(buf);
+  st[0] = 0;
+  if (num<0)
+    strcat(st, "-");
+  for (int i=c+(num<0); i<length; i++)
+    strncat(st, &filler, 1);
+  strcat(st, buf);
+}
+
+void refNumF(char *st, double num, byte dec, char divider, int length, char filler)
+{
+  if (dec<1)
+    dec = 1;
+  else if (dec>5)
+    dec = 5;
+  sprintf(st, "%*.*f", length, dec, num);
+  for (int i=0; st[i]!=0; i++)
+    if (st[i]=='.')
+      st[i] = divider;
+  if (filler!=' ')
+  {
+    if (num<0)
+    {
+      st[0] = '-';
+      for (int i=1; st[i]!=0; i++)
+        if ((st[i]==' ') || (st[i]=='-'))
+          st[i] = filler;
+    }
+    else
+      for (int i=0; st[i]!=0; i++)
+        if (st[i]==' ')
+          st[i] = filler;
+  }
+}
+
+// Draws the reference string and keeps the first text line
+void reference(const char *ref, int x)
+{
+  int h = myGLCD.getFontYsize();
+
+  myGLCD.fillScr(VGA_BLACK);
+  myGLCD.print((char*)ref, x, 0);
+  for (int y=0; y<h; y++)
+    for (int i=0; i<240; i++)
+      expected[(y*240)+i] = utft_host.getPixel(i, y);
+  myGLCD.fillScr(VGA_BLACK);
+}
+
+boolean same(const char *what, const char *ref)
+{
+  int h = myGLCD.getFontYsize();
+
+  for (int y=0; y<h; y++)
+    for (int i=0; i<240; i++)
+      if (expected[(y*240)+i]!=utft_host.getPixel(i, y))
+      {
+        printf("FAILED: %s, expected \"%s\"\n", what, ref);
+        errors++;
+        return false;
+      }
+  return true;
+}
+
+void checkI(long num, int x, int length, char filler)
+{
+  char ref[40], what[80];
+
+  refNumI(ref, num, length, filler);
+  reference(ref, x);
+  myGLCD.printNumI(num, x, 0, length, filler);
+  sprintf(what, "printNumI(%ld, %d, '%c')", num, length, filler);
+  same(what, ref);
+}
+
+void checkF(double num, byte dec, int x, char divider, int length, char filler)
+{
+  char ref[40], what[80];
+
+  refNumF(ref, num, dec, divider, length, filler);
+  reference(ref, x);
+  myGLCD.printNumF(num, dec, x, 0, divider, length, filler);
+  sprintf(what, "printNumF(%g, %d, '%c', %d, '%c')", num, dec, divider, length, filler);
+  same(what, ref);
+}
+
+unsigned long readout(boolean diff, word *screen)
+{
+  myGLCD.fillScr(VGA_BLACK);
+  myGLCD.setNumDiff(diff);
+  utft_host.resetStats();
+  for (int i=0; i<200; i++)
+  {
+    float temp = 21.5+(i*0.05);
+
+    myGLCD.setFont(BigFont);
+    myGLCD.printNumF(temp, 2, 10, 10, '.', 6);
+    myGLCD.printNumI(1000+(i*7), RIGHT, 40);
+    myGLCD.setFont(SevenSegNumFont);
+    myGLCD.printNumI(i*3, 10, 80, 4, '0');
+  }
+  unsigned long bytes = utft_host.stats.bytes;
+  for (int y=0; y<320; y++)
+    for (int x=0; x<240; x++)
+      screen[(y*240)+x] = utft_host.getPixel(x, y);
+  myGLCD.setNumDiff(false);
+  return bytes;
+}
+
+int main()
+{
+  static word full[240*320], diff[240*320];
+  long   ints[] = {0, 7, -7, 42, -1234, 99999, 2147483647L, -2147483647L-1};
+  double floats[] = {0, 0.5, -0.5, 3.14159, -2.71828, 99.995, 1234.5678, -0.004, 1e-7, 21474.8};
+  // Exact halves and decimal halves that are stored a little above or below
+  double halves[] = {0.125, -0.125, 0.375, 0.0625, 1.25, -2.5, 0.03125, 2.675, 1.005, 0.45, 1.35, -800723.955, 21474.83645};
+
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.setFont(SmallFont);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+
+  for (unsigned i=0; i<sizeof(ints)/sizeof(ints[0]); i++)
+  {
+    checkI(ints[i], 0, 0, ' ');
+    checkI(ints[i], 8, 6, ' ');
+    checkI(ints[i], 0, 8, '0');
+    checkI(ints[i], RIGHT, 12, '*');
+    checkI(ints[i], CENTER, 0, ' ');
+  }
+  for (unsigned i=0; i<sizeof(floats)/sizeof(floats[0]); i++)
+    for (byte dec=0; dec<=6; dec+=2)
+    {
+      checkF(floats[i], dec, 0, '.', 0, ' ');
+      checkF(floats[i], dec, 0, ',', 10, ' ');
+      checkF(floats[i], dec, RIGHT, '.', 12, '0');
+      checkF(floats[i], dec, CENTER, '.', 0, ' ');
+    }
+  for (unsigned i=0; i<sizeof(halves)/sizeof(halves[0]); i++)
+    for (byte dec=1; dec<=5; dec++)
+      checkF(halves[i], dec, 0, '.', 0, ' ');
+  // Too large for the fixed point conversion
+  checkF(123456789.5, 2, 0, '.', 0, ' ');
+  checkF(-1e12, 1, 0, '.', 16, '0');
+
+  unsigned long bytes_full = readout(false, full);
+  unsigned long bytes_diff = readout(true, diff);
+  printf("Readout, 200 updates: %lu bytes, with digit diff %lu bytes (%.1f%%)\n",
+    bytes_full, bytes_diff, (100.0*bytes_diff)/bytes_full);
+  if (memcmp(full, diff, sizeof(full))!=0)
+  {
+    printf("FAILED: the digit diff mode changed the screen\n");
+    errors++;
+  }
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
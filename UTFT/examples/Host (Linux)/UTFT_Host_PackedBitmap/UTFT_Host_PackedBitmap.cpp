@@ -0,0 +1,96 @@
+// UTFT_Host_PackedBitmap
+//
+// This program runs the library on a PC against the emulated display 
+// controller and compares drawPackedBitmap() with drawBitmap(). For each
+// format it prints the size of the image data, the bus traffic and the
+// number of pixels that differ from the first format of the same image.
+//
+// The packed arrays were made with the PackedBitmapConverter tool. They
+// are included directly as the image files are not C++.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_PackedBitmap.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o packedbitmap
+//   ./packedbitmap
+//
+
+#include <UTFT.h>
+
+#include "tux.c"
+#include "tux_rle565.c"
+#include "tux_pal8.c"
+#include "tux_palrle.c"
+#include "battery_rle565.c"
+#include "battery_pal2.c"
+#include "battery_palrle.c"
+
+struct image
+{
+  const char *name;
+  uint8_t    *data;
+  long        size;
+};
+
+image images[] = {{"tux raw", NULL, sizeof(tux)}, {"tux rle565", (uint8_t*)tux_rle565, sizeof(tux_rle565)},
+                  {"tux pal8", (uint8_t*)tux_pal8, sizeof(tux_pal8)}, {"tux palrle", (uint8_t*)tux_palrle, sizeof(tux_palrle)},
+                  {"battery rle565", (uint8_t*)battery_rle565, sizeof(battery_rle565)}, {"battery pal2", (uint8_t*)battery_pal2, sizeof(battery_pal2)},
+                  {"battery palrle", (uint8_t*)battery_palrle, sizeof(battery_palrle)}};
+
+struct model
+{
+  byte        id;
+  const char *name;
+};
+
+model models[] = {{ILI9341_S5P, "ILI9341_S5P"}, {ILI9481, "ILI9481"}};
+
+word reference[48*32];
+
+int main()
+{
+  for (unsigned m=0; m<sizeof(models)/sizeof(model); m++)
+    for (int o=PORTRAIT; o<=LANDSCAPE; o++)
+    {
+      UTFT myGLCD(models[m].id, 1, 2, 3, 4, 5);
+
+      myGLCD.InitLCD(o);
+      printf("\n%s, %s\n", models[m].name, o==PORTRAIT ? "PORTRAIT" : "LANDSCAPE");
+      printf("%-16s %6s %8s %8s %6s %6s\n", "Image", "Flash", "Bytes", "Windows", "us", "Diff");
+      for (unsigned i=0; i<sizeof(images)/sizeof(image); i++)
+      {
+        long          diff=0;
+        unsigned long start;
+
+        myGLCD.fillScr(VGA_BLUE);
+        utft_host.resetStats();
+        start=micros();
+        if (images[i].data==NULL)
+          myGLCD.drawBitmap(10, 20, 32, 32, (bitmapdatatype)tux);
+        else
+          myGLCD.drawPackedBitmap(10, 20, images[i].data);
+        start=micros()-start;
+        for (int y=0; y<32; y++)
+          for (int x=0; x<48; x++)
+          {
+            word c=utft_host.getPixel(10+x, 20+y);
+
+            if ((i==0) or (i==4))
+              reference[(y*48)+x]=c;
+            else if (reference[(y*48)+x]!=c)
+              diff++;
+          }
+        printf("%-16s %6ld %8lu %8lu %6lu %6ld\n", images[i].name, images[i].size, utft_host.stats.bytes,
+          utft_host.stats.windows, start, diff);
+      }
+    }
+
+  // A header with an unknown format draws nothing
+  uint8_t bad[] = {9, 4, 0, 4, 0, 0, 0xFF, 0xFF};
+  UTFT    myGLCD(ILI9341_S5P, 1, 2, 3, 4, 5);
+
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.fillScr(VGA_BLUE);
+  utft_host.resetStats();
+  myGLCD.drawPackedBitmap(10, 20, bad);
+  printf("\nUnknown format: %lu bytes sent\n", utft_host.stats.bytes);
+  return (utft_host.stats.bytes==0) ? 0 : 1;
+}
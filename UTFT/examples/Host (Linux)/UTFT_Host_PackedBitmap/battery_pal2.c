@@ -0,0 +1,32 @@
+// Generated by  : PackedBitmapConverter
+// Generated from: battery.ppm
+// Format        : BITMAP_PAL2 (48x24, 4 colors)
+// Size          : 302 Bytes (2304 Bytes as RGB565)
+
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+const unsigned char battery_pal2[302] PROGMEM={
+0x03, 0x30, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0xCE, 0x59, 0x06, 0x40, 0x7B, 0xCF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA0, 0x00, 0x00, 0x05, 0x00, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
+0x05, 0x00, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x05, 0x00, 0x50, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
+0x05, 0xFF, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
+0x05, 0xFF, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0x50, 0xAA,
+0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00, 0x05, 0x00, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+0xAA, 0xA0, 0x00, 0x00, 0x05, 0x00, 0x50, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x00, 0x00,
+0x05, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
@@ -0,0 +1,28 @@
+// Generated by  : PackedBitmapConverter
+// Generated from: battery.ppm
+// Format        : BITMAP_PALRLE (48x24, 4 colors)
+// Size          : 230 Bytes (2304 Bytes as RGB565)
+
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+const unsigned char battery_palrle[230] PROGMEM={
+0x06, 0x30, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0xCE, 0x59, 0x06, 0x40, 0x7B, 0xCF, 0xAF, 0x00,
+0xAF, 0x00, 0xAB, 0x01, 0x83, 0x00, 0x81, 0x01, 0xA7, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01,
+0xA7, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01,
+0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01,
+0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02,
+0x8B, 0x00, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01,
+0x83, 0x03, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01,
+0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02,
+0x8B, 0x00, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01,
+0x83, 0x03, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01,
+0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02,
+0x8B, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01,
+0x83, 0x00, 0x81, 0x01, 0x81, 0x00, 0x99, 0x02, 0x8B, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01,
+0xA7, 0x00, 0x81, 0x01, 0x83, 0x00, 0x81, 0x01, 0xA7, 0x00, 0x81, 0x01, 0x83, 0x00, 0xAB, 0x01,
+0x83, 0x00, 0xAF, 0x00, 0xAF, 0x00
+};
@@ -0,0 +1,34 @@
+// Generated by  : PackedBitmapConverter
+// Generated from: battery.ppm
+// Format        : BITMAP_RLE565 (48x24, 0 colors)
+// Size          : 330 Bytes (2304 Bytes as RGB565)
+
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+const unsigned char battery_rle565[330] PROGMEM={
+0x01, 0x30, 0x00, 0x18, 0x00, 0x00, 0xAF, 0x00, 0x00, 0xAF, 0x00, 0x00, 0xAB, 0xCE, 0x59, 0x83,
+0x00, 0x00, 0x81, 0xCE, 0x59, 0xA7, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x81, 0xCE,
+0x59, 0xA7, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00,
+0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x81,
+0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x81, 0xCE,
+0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x00, 0x00,
+0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83,
+0x7B, 0xCF, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE,
+0x59, 0x83, 0x7B, 0xCF, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00,
+0x81, 0xCE, 0x59, 0x83, 0x7B, 0xCF, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B,
+0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x7B, 0xCF, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06,
+0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x7B, 0xCF, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00,
+0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x7B, 0xCF, 0x81, 0xCE, 0x59, 0x81,
+0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x7B, 0xCF, 0x81, 0xCE,
+0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x7B, 0xCF,
+0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83,
+0x00, 0x00, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00, 0x81, 0xCE,
+0x59, 0x83, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x81, 0x00, 0x00, 0x99, 0x06, 0x40, 0x8B, 0x00, 0x00,
+0x81, 0xCE, 0x59, 0x83, 0x00, 0x00, 0x81, 0xCE, 0x59, 0xA7, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83,
+0x00, 0x00, 0x81, 0xCE, 0x59, 0xA7, 0x00, 0x00, 0x81, 0xCE, 0x59, 0x83, 0x00, 0x00, 0xAB, 0xCE,
+0x59, 0x83, 0x00, 0x00, 0xAF, 0x00, 0x00, 0xAF, 0x00, 0x00
+};
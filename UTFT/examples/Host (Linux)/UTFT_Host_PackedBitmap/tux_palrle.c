@@ -0,0 +1,95 @@
+// Generated by  : PackedBitmapConverter
+// Generated from: tux.ppm
+// Format        : BITMAP_PALRLE (32x32, 255 colors)
+// Size          : 1307 Bytes (2048 Bytes as RGB565)
+
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+const unsigned char tux_palrle[1307] PROGMEM={
+0x06, 0x20, 0x00, 0x20, 0x00, 0xFE, 0xFF, 0xFF, 0xE7, 0x3C, 0x9C, 0xD3, 0x9C, 0xF3, 0xA5, 0x14,
+0x8C, 0x51, 0xAD, 0x75, 0xEF, 0x7D, 0x5A, 0xEB, 0x7B, 0xEF, 0x94, 0xB2, 0x42, 0x28, 0xFF, 0xDF,
+0x18, 0xE3, 0x63, 0x0C, 0x4A, 0x49, 0x4A, 0x69, 0x52, 0x8A, 0x00, 0x00, 0xC6, 0x38, 0x6B, 0x6D,
+0x00, 0x20, 0x10, 0xA2, 0x10, 0x82, 0x08, 0x41, 0x84, 0x10, 0x08, 0x61, 0xAD, 0x55, 0xBD, 0xD7,
+0x29, 0x45, 0xF7, 0xBE, 0x5A, 0xCB, 0x8C, 0x71, 0xE7, 0x5D, 0x21, 0x26, 0x52, 0x8B, 0xDE, 0xDB,
+0x7B, 0xCF, 0x4A, 0x4A, 0x6B, 0x2A, 0x8B, 0xE7, 0xA4, 0x8A, 0x6B, 0x09, 0x4A, 0x8A, 0x84, 0x31,
+0x21, 0x04, 0x6B, 0x6E, 0x52, 0x04, 0xDE, 0x6A, 0xFF, 0xF7, 0xFF, 0xF8, 0xD5, 0xAC, 0xBC, 0xAA,
+0x5A, 0x66, 0xDE, 0xFB, 0x8C, 0x10, 0xC5, 0x40, 0xFF, 0xED, 0xFF, 0x2C, 0xFE, 0xEC, 0xFE, 0xCC,
+0xFE, 0x66, 0x82, 0x60, 0xB5, 0x96, 0x94, 0xB3, 0x9C, 0x25, 0xFF, 0x20, 0xFE, 0x40, 0xFD, 0xA0,
+0xFC, 0xC0, 0xF5, 0x24, 0x83, 0x6A, 0x94, 0xB4, 0xFF, 0x13, 0xFD, 0x83, 0xF5, 0x23, 0xE5, 0xCF,
+0xF7, 0x9E, 0xE7, 0x1D, 0xCE, 0x59, 0xD6, 0x9A, 0xFF, 0x7D, 0xF7, 0x7D, 0x73, 0xAE, 0x94, 0x92,
+0x52, 0xAA, 0x31, 0x86, 0xCE, 0x79, 0x39, 0xE7, 0xBD, 0xF7, 0xEF, 0x5D, 0x31, 0x85, 0xE7, 0x1C,
+0x18, 0xC3, 0xC6, 0x18, 0x6B, 0x4D, 0x38, 0xE0, 0x4A, 0x27, 0xDF, 0x1D, 0xBD, 0xF8, 0x39, 0xC7,
+0x10, 0xA3, 0x73, 0x8F, 0xDD, 0x6C, 0xFE, 0x2B, 0xBC, 0x45, 0xA5, 0x13, 0xD6, 0xDC, 0xDD, 0x8E,
+0xB3, 0xE4, 0x21, 0x24, 0x29, 0x65, 0x20, 0xC1, 0xB5, 0x11, 0xF7, 0x7C, 0xF6, 0x0B, 0xFF, 0x9B,
+0xFF, 0x54, 0x8B, 0x02, 0x7B, 0xF0, 0xCE, 0x7A, 0xED, 0x89, 0xDD, 0xAD, 0x08, 0x42, 0xAC, 0x69,
+0xDD, 0x6B, 0xEF, 0xBF, 0xFF, 0xBE, 0xE5, 0xCB, 0xED, 0xC9, 0xFE, 0x4B, 0xFF, 0x14, 0xFE, 0xF3,
+0xFF, 0x35, 0xFE, 0x8D, 0x51, 0xC1, 0x63, 0x4E, 0xD6, 0xDB, 0xE5, 0x8B, 0xFF, 0x98, 0xBD, 0x4F,
+0x8B, 0x88, 0xCD, 0x90, 0xFF, 0xB7, 0xCC, 0xE8, 0xE7, 0x3D, 0xEF, 0x3B, 0xF5, 0x83, 0xFF, 0x30,
+0xFF, 0x11, 0xFE, 0xCF, 0xFE, 0xEF, 0xDD, 0x46, 0x29, 0x03, 0x6B, 0x8E, 0xD6, 0xBA, 0xE5, 0xAA,
+0xFF, 0x53, 0xFF, 0x73, 0xFF, 0x33, 0xFF, 0x12, 0xFE, 0x6C, 0xED, 0xC5, 0xFE, 0xCB, 0xFE, 0xEA,
+0x9B, 0xE5, 0x84, 0x32, 0xA4, 0xF3, 0xD5, 0x47, 0xFF, 0x2E, 0xFE, 0xCD, 0xFE, 0xCE, 0xFE, 0xEE,
+0xFF, 0x10, 0xFE, 0xAB, 0xE5, 0xA8, 0xF6, 0x03, 0xFE, 0xA2, 0xFE, 0xC7, 0xFE, 0xA4, 0xFE, 0x81,
+0xFE, 0x61, 0xFE, 0x43, 0xDE, 0x33, 0xE7, 0x5E, 0xCE, 0x58, 0x8C, 0x72, 0x52, 0x47, 0xED, 0xE4,
+0xFF, 0x0A, 0xFE, 0xCA, 0xFE, 0xC9, 0xFE, 0x84, 0xFE, 0x83, 0xFE, 0xE7, 0xFE, 0xA3, 0xB4, 0x43,
+0xD6, 0x9B, 0xF7, 0x5B, 0xFE, 0x60, 0xFF, 0x00, 0xFE, 0xC0, 0xFE, 0xA0, 0xFE, 0xE0, 0xE5, 0xC1,
+0x63, 0x0B, 0x42, 0x29, 0x6A, 0xE8, 0xFE, 0x80, 0xFE, 0xC1, 0xDD, 0x80, 0x9B, 0xE8, 0xB5, 0x97,
+0xD5, 0x89, 0xE6, 0x00, 0xFF, 0x40, 0x52, 0x67, 0x4A, 0x48, 0x52, 0x89, 0x42, 0x4A, 0x7B, 0x46,
+0xB4, 0xA5, 0x9C, 0x92, 0xDE, 0xFD, 0xBD, 0xB6, 0xB5, 0x30, 0xBD, 0x0B, 0xCD, 0x65, 0xEE, 0x60,
+0xFF, 0xA0, 0xFF, 0x80, 0xBD, 0x03, 0xA5, 0x34, 0xA5, 0x55, 0x9C, 0x8F, 0xF6, 0xC0, 0xF6, 0xE0,
+0xA4, 0x49, 0xB5, 0xB8, 0xEF, 0x7F, 0xD6, 0x9C, 0xBD, 0x95, 0xBD, 0x4C, 0xCD, 0xC6, 0xB4, 0xE8,
+0xAD, 0x35, 0xF7, 0xBF, 0xCD, 0xD0, 0xCD, 0xA7, 0xA4, 0x8D, 0xCE, 0x7B, 0xDF, 0x1F, 0xB5, 0x9A,
+0xBD, 0xDA, 0xAD, 0x59, 0x8B, 0x00, 0x06, 0x01, 0x02, 0x03, 0x04, 0x03, 0x05, 0x06, 0x8C, 0x00,
+0x8A, 0x00, 0x03, 0x07, 0x08, 0x09, 0x02, 0x82, 0x0A, 0x01, 0x0B, 0x09, 0x8B, 0x00, 0x88, 0x00,
+0x05, 0x0C, 0x00, 0x03, 0x0D, 0x0E, 0x0F, 0x81, 0x10, 0x05, 0x11, 0x0F, 0x12, 0x13, 0x00, 0x0C,
+0x88, 0x00, 0x88, 0x00, 0x06, 0x0C, 0x00, 0x14, 0x12, 0x15, 0x16, 0x17, 0x82, 0x18, 0x01, 0x12,
+0x0E, 0x8A, 0x00, 0x88, 0x00, 0x0C, 0x0C, 0x00, 0x11, 0x0B, 0x19, 0x12, 0x1A, 0x1B, 0x1C, 0x16,
+0x12, 0x1D, 0x1E, 0x89, 0x00, 0x88, 0x00, 0x0C, 0x0C, 0x00, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x21,
+0x24, 0x25, 0x12, 0x0D, 0x01, 0x89, 0x00, 0x88, 0x00, 0x0C, 0x0C, 0x00, 0x14, 0x26, 0x27, 0x28,
+0x29, 0x2A, 0x2B, 0x2C, 0x12, 0x2D, 0x01, 0x89, 0x00, 0x88, 0x00, 0x0C, 0x0C, 0x00, 0x2E, 0x2F,
+0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x12, 0x17, 0x36, 0x89, 0x00, 0x88, 0x00, 0x09, 0x0C, 0x00,
+0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x81, 0x12, 0x02, 0x3F, 0x00, 0x0C, 0x87, 0x00,
+0x88, 0x00, 0x09, 0x0C, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x81, 0x12, 0x02,
+0x0E, 0x00, 0x0C, 0x87, 0x00, 0x88, 0x00, 0x0D, 0x0C, 0x00, 0x0E, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+0x4D, 0x4E, 0x1A, 0x12, 0x1A, 0x24, 0x88, 0x00, 0x87, 0x00, 0x07, 0x0C, 0x00, 0x4F, 0x18, 0x50,
+0x00, 0x51, 0x52, 0x82, 0x00, 0x00, 0x53, 0x81, 0x12, 0x02, 0x10, 0x00, 0x0C, 0x86, 0x00, 0x88,
+0x00, 0x04, 0x4D, 0x16, 0x19, 0x00, 0x0C, 0x82, 0x00, 0x02, 0x0C, 0x00, 0x4F, 0x82, 0x12, 0x02,
+0x54, 0x00, 0x0C, 0x85, 0x00, 0x88, 0x00, 0x02, 0x55, 0x15, 0x1E, 0x83, 0x00, 0x81, 0x0C, 0x08,
+0x1E, 0x0C, 0x56, 0x12, 0x15, 0x18, 0x57, 0x00, 0x0C, 0x84, 0x00, 0x85, 0x00, 0x06, 0x0C, 0x00,
+0x13, 0x12, 0x55, 0x00, 0x0C, 0x81, 0x00, 0x81, 0x0C, 0x08, 0x1E, 0x4D, 0x00, 0x03, 0x12, 0x18,
+0x12, 0x58, 0x0C, 0x85, 0x00, 0x87, 0x00, 0x05, 0x1F, 0x12, 0x59, 0x00, 0x0C, 0x00, 0x81, 0x0C,
+0x81, 0x1E, 0x81, 0x4D, 0x07, 0x07, 0x56, 0x12, 0x1A, 0x12, 0x1B, 0x00, 0x0C, 0x83, 0x00, 0x86,
+0x00, 0x02, 0x01, 0x1A, 0x0F, 0x82, 0x00, 0x82, 0x0C, 0x0A, 0x1E, 0x4D, 0x07, 0x5A, 0x0C, 0x19,
+0x12, 0x17, 0x12, 0x58, 0x0C, 0x84, 0x00, 0x84, 0x00, 0x05, 0x0C, 0x00, 0x0A, 0x12, 0x3F, 0x00,
+0x83, 0x0C, 0x01, 0x1E, 0x4D, 0x81, 0x07, 0x07, 0x01, 0x4D, 0x1B, 0x1A, 0x16, 0x1A, 0x18, 0x4F,
+0x84, 0x00, 0x85, 0x00, 0x04, 0x4D, 0x5B, 0x16, 0x5C, 0x00, 0x82, 0x0C, 0x01, 0x1E, 0x4D, 0x81,
+0x07, 0x03, 0x5A, 0x01, 0x5A, 0x59, 0x82, 0x5D, 0x03, 0x12, 0x20, 0x00, 0x0C, 0x82, 0x00, 0x83,
+0x00, 0x06, 0x0C, 0x00, 0x0A, 0x12, 0x58, 0x1E, 0x00, 0x81, 0x0C, 0x01, 0x1E, 0x4D, 0x81, 0x07,
+0x01, 0x5A, 0x01, 0x81, 0x5C, 0x01, 0x5E, 0x0D, 0x81, 0x16, 0x01, 0x15, 0x5F, 0x84, 0x00, 0x83,
+0x00, 0x06, 0x0C, 0x00, 0x05, 0x60, 0x61, 0x00, 0x0C, 0x81, 0x1E, 0x00, 0x4D, 0x81, 0x07, 0x0A,
+0x5A, 0x01, 0x5C, 0x36, 0x62, 0x63, 0x64, 0x1F, 0x11, 0x65, 0x66, 0x84, 0x00, 0x85, 0x00, 0x05,
+0x67, 0x68, 0x69, 0x6A, 0x00, 0x1E, 0x81, 0x4D, 0x0C, 0x07, 0x5A, 0x01, 0x5C, 0x36, 0x6B, 0x6C,
+0x6D, 0x6E, 0x6F, 0x1D, 0x70, 0x71, 0x84, 0x00, 0x83, 0x00, 0x08, 0x72, 0x4C, 0x73, 0x74, 0x75,
+0x76, 0x77, 0x0C, 0x4D, 0x81, 0x5A, 0x07, 0x01, 0x5C, 0x36, 0x24, 0x78, 0x79, 0x7A, 0x7B, 0x81,
+0x12, 0x02, 0x7C, 0x7D, 0x7E, 0x83, 0x00, 0x81, 0x00, 0x19, 0x7F, 0x80, 0x81, 0x82, 0x83, 0x84,
+0x85, 0x86, 0x87, 0x88, 0x01, 0x5A, 0x01, 0x5C, 0x36, 0x24, 0x89, 0x4F, 0x8A, 0x8B, 0x8C, 0x8D,
+0x8E, 0x8F, 0x90, 0x91, 0x83, 0x00, 0x81, 0x00, 0x1A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x96,
+0x94, 0x98, 0x99, 0x9A, 0x07, 0x5C, 0x36, 0x24, 0x9B, 0x50, 0x4F, 0x9C, 0x95, 0x9D, 0x9E, 0x9F,
+0xA0, 0xA1, 0x7A, 0x4D, 0x82, 0x00, 0x81, 0x00, 0x02, 0x4D, 0xA2, 0xA3, 0x81, 0x3C, 0x06, 0x3B,
+0xA3, 0x3C, 0xA4, 0xA5, 0xA6, 0x01, 0x81, 0x24, 0x07, 0x9B, 0x50, 0x24, 0xA7, 0xA8, 0xA9, 0xAA,
+0xAB, 0x81, 0xAC, 0x03, 0xAD, 0xAE, 0xAF, 0x07, 0x81, 0x00, 0x81, 0x00, 0x02, 0x4D, 0xB0, 0xB1,
+0x81, 0xB2, 0x16, 0xB3, 0xB4, 0xB5, 0xB3, 0xB6, 0xB7, 0xB8, 0x5C, 0x36, 0x24, 0xB9, 0xBA, 0xBB,
+0xBC, 0xBD, 0xBE, 0xBF, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0x81, 0x00, 0x81, 0x00, 0x02, 0xC6,
+0xC7, 0xC8, 0x81, 0xC9, 0x81, 0xCA, 0x0B, 0xC9, 0xCA, 0xCB, 0xCC, 0x54, 0x04, 0x02, 0x19, 0xCD,
+0xCE, 0xCF, 0xD0, 0x81, 0xD1, 0x81, 0xCA, 0x04, 0xCB, 0xD2, 0xD3, 0xD4, 0x0C, 0x81, 0x00, 0x81,
+0x00, 0x04, 0x4D, 0xD5, 0xD6, 0xCA, 0xC8, 0x81, 0xD7, 0x81, 0xC8, 0x09, 0x42, 0xC9, 0xD8, 0xCE,
+0xD9, 0x0F, 0xDA, 0xDB, 0xDC, 0x42, 0x81, 0xCB, 0x04, 0x42, 0xCB, 0xDD, 0xDE, 0xDF, 0x83, 0x00,
+0x82, 0x00, 0x11, 0x4E, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xD7, 0xE5, 0xE6, 0xE7, 0x19, 0x04, 0xE8,
+0x06, 0x3F, 0xE9, 0xEA, 0xEB, 0x81, 0xE5, 0x02, 0xEC, 0xED, 0xEE, 0x85, 0x00, 0x85, 0x00, 0x07,
+0xEF, 0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0x84, 0x00, 0x05, 0xF6, 0xF7, 0xF3, 0xF8, 0xF9,
+0xFA, 0x86, 0x00, 0x88, 0x00, 0x02, 0xFB, 0xFC, 0xFD, 0x81, 0x00, 0x00, 0x0C, 0x81, 0x00, 0x81,
+0x0C, 0x06, 0x00, 0xEF, 0xFC, 0xFE, 0x62, 0x00, 0x0C, 0x85, 0x00
+};
@@ -0,0 +1,101 @@
+// Generated by  : PackedBitmapConverter
+// Generated from: tux.ppm
+// Format        : BITMAP_RLE565 (32x32, 0 colors)
+// Size          : 1405 Bytes (2048 Bytes as RGB565)
+
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+const unsigned char tux_rle565[1405] PROGMEM={
+0x01, 0x20, 0x00, 0x20, 0x00, 0x00, 0x8B, 0xFF, 0xFF, 0x06, 0xE7, 0x3C, 0x9C, 0xD3, 0x9C, 0xF3,
+0xA5, 0x14, 0x9C, 0xF3, 0x8C, 0x51, 0xAD, 0x75, 0x8C, 0xFF, 0xFF, 0x8A, 0xFF, 0xFF, 0x03, 0xEF,
+0x7D, 0x5A, 0xEB, 0x7B, 0xEF, 0x9C, 0xD3, 0x82, 0x94, 0xB2, 0x01, 0x42, 0x28, 0x7B, 0xEF, 0x8B,
+0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x05, 0xFF, 0xDF, 0xFF, 0xFF, 0x9C, 0xF3, 0x18, 0xE3, 0x63, 0x0C,
+0x4A, 0x49, 0x81, 0x4A, 0x69, 0x05, 0x52, 0x8A, 0x4A, 0x49, 0x00, 0x00, 0xC6, 0x38, 0xFF, 0xFF,
+0xFF, 0xDF, 0x88, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x06, 0xFF, 0xDF, 0xFF, 0xFF, 0x6B, 0x6D, 0x00,
+0x00, 0x00, 0x20, 0x10, 0xA2, 0x10, 0x82, 0x82, 0x08, 0x41, 0x01, 0x00, 0x00, 0x63, 0x0C, 0x8A,
+0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0x52, 0x8A, 0x42, 0x28, 0x84, 0x10,
+0x00, 0x00, 0x08, 0x61, 0xAD, 0x55, 0xBD, 0xD7, 0x10, 0xA2, 0x00, 0x00, 0x29, 0x45, 0xF7, 0xBE,
+0x89, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0x5A, 0xCB, 0x8C, 0x71, 0xE7,
+0x5D, 0x21, 0x26, 0x52, 0x8B, 0xE7, 0x5D, 0xDE, 0xDB, 0x7B, 0xCF, 0x00, 0x00, 0x18, 0xE3, 0xE7,
+0x3C, 0x89, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0x6B, 0x6D, 0x4A, 0x4A,
+0x6B, 0x2A, 0x8B, 0xE7, 0xA4, 0x8A, 0x6B, 0x09, 0x4A, 0x8A, 0x84, 0x31, 0x00, 0x00, 0x21, 0x04,
+0xE7, 0x3C, 0x89, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x0C, 0xFF, 0xDF, 0xFF, 0xFF, 0x6B, 0x6E, 0x52,
+0x04, 0xDE, 0x6A, 0xFF, 0xF7, 0xFF, 0xF8, 0xD5, 0xAC, 0xBC, 0xAA, 0x5A, 0x66, 0x00, 0x00, 0x10,
+0x82, 0xDE, 0xFB, 0x89, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x09, 0xFF, 0xDF, 0xFF, 0xFF, 0x8C, 0x10,
+0xC5, 0x40, 0xFF, 0xED, 0xFF, 0x2C, 0xFE, 0xEC, 0xFE, 0xCC, 0xFE, 0x66, 0x82, 0x60, 0x81, 0x00,
+0x00, 0x02, 0xB5, 0x96, 0xFF, 0xFF, 0xFF, 0xDF, 0x87, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x09, 0xFF,
+0xDF, 0xFF, 0xFF, 0x94, 0xB3, 0x9C, 0x25, 0xFF, 0x20, 0xFE, 0x40, 0xFD, 0xA0, 0xFC, 0xC0, 0xF5,
+0x24, 0x83, 0x6A, 0x81, 0x00, 0x00, 0x02, 0x63, 0x0C, 0xFF, 0xFF, 0xFF, 0xDF, 0x87, 0xFF, 0xFF,
+0x88, 0xFF, 0xFF, 0x0D, 0xFF, 0xDF, 0xFF, 0xFF, 0x63, 0x0C, 0x94, 0xB4, 0xFF, 0x13, 0xFD, 0x83,
+0xF5, 0x23, 0xE5, 0xCF, 0xF7, 0x9E, 0xE7, 0x1D, 0x08, 0x61, 0x00, 0x00, 0x08, 0x61, 0xDE, 0xDB,
+0x88, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x07, 0xFF, 0xDF, 0xFF, 0xFF, 0xCE, 0x59, 0x08, 0x41, 0xD6,
+0x9A, 0xFF, 0xFF, 0xFF, 0x7D, 0xF7, 0x7D, 0x82, 0xFF, 0xFF, 0x00, 0x73, 0xAE, 0x81, 0x00, 0x00,
+0x02, 0x4A, 0x69, 0xFF, 0xFF, 0xFF, 0xDF, 0x86, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x04, 0xF7, 0x9E,
+0x10, 0xA2, 0x84, 0x10, 0xFF, 0xFF, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x02, 0xFF, 0xDF, 0xFF, 0xFF,
+0xCE, 0x59, 0x82, 0x00, 0x00, 0x02, 0x94, 0x92, 0xFF, 0xFF, 0xFF, 0xDF, 0x85, 0xFF, 0xFF, 0x88,
+0xFF, 0xFF, 0x02, 0x52, 0xAA, 0x00, 0x20, 0xF7, 0xBE, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x08,
+0xF7, 0xBE, 0xFF, 0xDF, 0x31, 0x86, 0x00, 0x00, 0x00, 0x20, 0x08, 0x41, 0xCE, 0x79, 0xFF, 0xFF,
+0xFF, 0xDF, 0x84, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0x06, 0xFF, 0xDF, 0xFF, 0xFF, 0xC6, 0x38, 0x00,
+0x00, 0x52, 0xAA, 0xFF, 0xFF, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x08, 0xF7, 0xBE,
+0xF7, 0x9E, 0xFF, 0xFF, 0x9C, 0xF3, 0x00, 0x00, 0x08, 0x41, 0x00, 0x00, 0x39, 0xE7, 0xFF, 0xDF,
+0x85, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x05, 0x5A, 0xCB, 0x00, 0x00, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF,
+0xDF, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x81, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x07, 0xEF, 0x7D, 0x31,
+0x86, 0x00, 0x00, 0x08, 0x61, 0x00, 0x00, 0xAD, 0x55, 0xFF, 0xFF, 0xFF, 0xDF, 0x83, 0xFF, 0xFF,
+0x86, 0xFF, 0xFF, 0x02, 0xE7, 0x3C, 0x08, 0x61, 0x4A, 0x49, 0x82, 0xFF, 0xFF, 0x82, 0xFF, 0xDF,
+0x0A, 0xF7, 0xBE, 0xF7, 0x9E, 0xEF, 0x7D, 0xEF, 0x5D, 0xFF, 0xDF, 0x84, 0x10, 0x00, 0x00, 0x10,
+0x82, 0x00, 0x00, 0x39, 0xE7, 0xFF, 0xDF, 0x84, 0xFF, 0xFF, 0x84, 0xFF, 0xFF, 0x05, 0xFF, 0xDF,
+0xFF, 0xFF, 0x94, 0xB2, 0x00, 0x00, 0xB5, 0x96, 0xFF, 0xFF, 0x83, 0xFF, 0xDF, 0x01, 0xF7, 0xBE,
+0xF7, 0x9E, 0x81, 0xEF, 0x7D, 0x07, 0xE7, 0x3C, 0xF7, 0x9E, 0xAD, 0x55, 0x08, 0x61, 0x10, 0xA2,
+0x08, 0x61, 0x08, 0x41, 0xCE, 0x59, 0x84, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0x31,
+0x85, 0x10, 0xA2, 0xE7, 0x1C, 0xFF, 0xFF, 0x82, 0xFF, 0xDF, 0x01, 0xF7, 0xBE, 0xF7, 0x9E, 0x81,
+0xEF, 0x7D, 0x03, 0xEF, 0x5D, 0xE7, 0x3C, 0xEF, 0x5D, 0xBD, 0xF7, 0x82, 0x18, 0xC3, 0x03, 0x00,
+0x00, 0x8C, 0x71, 0xFF, 0xFF, 0xFF, 0xDF, 0x82, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x06, 0xFF, 0xDF,
+0xFF, 0xFF, 0x94, 0xB2, 0x00, 0x00, 0x39, 0xE7, 0xF7, 0xBE, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x01,
+0xF7, 0xBE, 0xF7, 0x9E, 0x81, 0xEF, 0x7D, 0x01, 0xEF, 0x5D, 0xE7, 0x3C, 0x81, 0xE7, 0x1C, 0x01,
+0xC6, 0x18, 0x18, 0xE3, 0x81, 0x10, 0xA2, 0x01, 0x00, 0x20, 0x6B, 0x4D, 0x84, 0xFF, 0xFF, 0x83,
+0xFF, 0xFF, 0x06, 0xFF, 0xDF, 0xFF, 0xFF, 0x8C, 0x51, 0x38, 0xE0, 0x4A, 0x27, 0xFF, 0xFF, 0xFF,
+0xDF, 0x81, 0xF7, 0xBE, 0x00, 0xF7, 0x9E, 0x81, 0xEF, 0x7D, 0x0A, 0xEF, 0x5D, 0xE7, 0x3C, 0xE7,
+0x1C, 0xDE, 0xFB, 0xDF, 0x1D, 0xBD, 0xF8, 0x39, 0xC7, 0x5A, 0xCB, 0x52, 0x8A, 0x10, 0xA3, 0x73,
+0x8F, 0x84, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0x05, 0xDD, 0x6C, 0xFE, 0x2B, 0xBC, 0x45, 0xA5, 0x13,
+0xFF, 0xFF, 0xF7, 0xBE, 0x81, 0xF7, 0x9E, 0x0C, 0xEF, 0x7D, 0xEF, 0x5D, 0xE7, 0x3C, 0xE7, 0x1C,
+0xDE, 0xFB, 0xD6, 0xDC, 0xDD, 0x8E, 0xB3, 0xE4, 0x21, 0x24, 0x29, 0x65, 0x29, 0x45, 0x20, 0xC1,
+0xB5, 0x11, 0x84, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x08, 0xF7, 0x7C, 0xE5, 0xCF, 0xF6, 0x0B, 0xFF,
+0x9B, 0xFF, 0x54, 0x8B, 0x02, 0x7B, 0xF0, 0xFF, 0xDF, 0xF7, 0x9E, 0x81, 0xEF, 0x5D, 0x07, 0xE7,
+0x3C, 0xE7, 0x1C, 0xDE, 0xFB, 0xDE, 0xDB, 0xCE, 0x7A, 0xED, 0x89, 0xDD, 0xAD, 0x08, 0x42, 0x81,
+0x00, 0x00, 0x02, 0xAC, 0x69, 0xDD, 0x6B, 0xEF, 0xBF, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x19,
+0xFF, 0xBE, 0xE5, 0xCB, 0xED, 0xC9, 0xFE, 0x4B, 0xFF, 0x14, 0xFE, 0xF3, 0xFF, 0x35, 0xFE, 0x8D,
+0x51, 0xC1, 0x63, 0x4E, 0xE7, 0x3C, 0xEF, 0x5D, 0xE7, 0x3C, 0xE7, 0x1C, 0xDE, 0xFB, 0xDE, 0xDB,
+0xD6, 0xDB, 0xCE, 0x59, 0xE5, 0x8B, 0xFF, 0x98, 0xBD, 0x4F, 0x8B, 0x88, 0xCD, 0x90, 0xFF, 0xB7,
+0xCC, 0xE8, 0xE7, 0x3D, 0x83, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x1A, 0xEF, 0x3B, 0xF5, 0x83, 0xFF,
+0x30, 0xFF, 0x11, 0xFE, 0xCF, 0xFE, 0xEF, 0xFE, 0xCF, 0xFF, 0x30, 0xDD, 0x46, 0x29, 0x03, 0x6B,
+0x8E, 0xEF, 0x7D, 0xE7, 0x1C, 0xDE, 0xFB, 0xDE, 0xDB, 0xD6, 0xBA, 0xD6, 0x9A, 0xCE, 0x59, 0xE5,
+0xAA, 0xFF, 0x11, 0xFF, 0x53, 0xFF, 0x73, 0xFF, 0x33, 0xFF, 0x12, 0xFE, 0x6C, 0xDD, 0xAD, 0xF7,
+0x9E, 0x82, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0xED, 0xC5, 0xFE, 0xCB, 0x81, 0xFE,
+0xCC, 0x06, 0xFE, 0xEC, 0xFE, 0xCB, 0xFE, 0xCC, 0xFE, 0xEA, 0x9B, 0xE5, 0x84, 0x32, 0xE7, 0x3C,
+0x81, 0xDE, 0xDB, 0x07, 0xD6, 0xBA, 0xD6, 0x9A, 0xDE, 0xDB, 0xA4, 0xF3, 0xD5, 0x47, 0xFF, 0x2E,
+0xFE, 0xCD, 0xFE, 0xCE, 0x81, 0xFE, 0xEE, 0x03, 0xFF, 0x10, 0xFE, 0xAB, 0xE5, 0xA8, 0xEF, 0x7D,
+0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x02, 0xF7, 0x9E, 0xF6, 0x03, 0xFE, 0xA2, 0x81, 0xFE, 0xC7,
+0x16, 0xFE, 0xA4, 0xFE, 0x81, 0xFE, 0x61, 0xFE, 0xA4, 0xFE, 0x43, 0xDE, 0x33, 0xE7, 0x5E, 0xE7,
+0x1C, 0xDE, 0xFB, 0xDE, 0xDB, 0xCE, 0x58, 0x8C, 0x72, 0x52, 0x47, 0xED, 0xE4, 0xFF, 0x0A, 0xFE,
+0xCA, 0xFE, 0xC9, 0xFE, 0x84, 0xFE, 0x83, 0xFE, 0xE7, 0xFE, 0xA3, 0xB4, 0x43, 0xD6, 0x9B, 0x81,
+0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x02, 0xF7, 0x5B, 0xFE, 0x60, 0xFF, 0x00, 0x81, 0xFE, 0xC0, 0x81,
+0xFE, 0xA0, 0x0B, 0xFE, 0xC0, 0xFE, 0xA0, 0xFE, 0xE0, 0xE5, 0xC1, 0x94, 0x92, 0xA5, 0x14, 0x9C,
+0xD3, 0x84, 0x10, 0x63, 0x0B, 0x42, 0x29, 0x6A, 0xE8, 0xFE, 0x80, 0x81, 0xFE, 0xC1, 0x81, 0xFE,
+0xA0, 0x04, 0xFE, 0xE0, 0xDD, 0x80, 0x9B, 0xE8, 0xB5, 0x97, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x81,
+0xFF, 0xFF, 0x04, 0xF7, 0x9E, 0xD5, 0x89, 0xE6, 0x00, 0xFE, 0xA0, 0xFF, 0x00, 0x81, 0xFF, 0x40,
+0x81, 0xFF, 0x00, 0x09, 0xFF, 0x20, 0xFE, 0xC0, 0x52, 0x67, 0x42, 0x29, 0x4A, 0x48, 0x4A, 0x49,
+0x52, 0x89, 0x42, 0x4A, 0x7B, 0x46, 0xFF, 0x20, 0x81, 0xFE, 0xE0, 0x04, 0xFF, 0x20, 0xFE, 0xE0,
+0xB4, 0xA5, 0x9C, 0x92, 0xDE, 0xFD, 0x83, 0xFF, 0xFF, 0x82, 0xFF, 0xFF, 0x11, 0xE7, 0x1D, 0xBD,
+0xB6, 0xB5, 0x30, 0xBD, 0x0B, 0xCD, 0x65, 0xEE, 0x60, 0xFF, 0x40, 0xFF, 0xA0, 0xFF, 0x80, 0xBD,
+0x03, 0x84, 0x10, 0xA5, 0x14, 0xA5, 0x34, 0xAD, 0x75, 0xB5, 0x96, 0xA5, 0x55, 0x9C, 0x8F, 0xF6,
+0xC0, 0x81, 0xFF, 0xA0, 0x02, 0xF6, 0xE0, 0xA4, 0x49, 0xB5, 0xB8, 0x85, 0xFF, 0xFF, 0x85, 0xFF,
+0xFF, 0x07, 0xEF, 0x7F, 0xD6, 0x9C, 0xBD, 0x95, 0xBD, 0x4C, 0xCD, 0xC6, 0xB4, 0xE8, 0xAD, 0x35,
+0xF7, 0xBF, 0x84, 0xFF, 0xFF, 0x05, 0xF7, 0xBF, 0xCD, 0xD0, 0xCD, 0xC6, 0xCD, 0xA7, 0xA4, 0x8D,
+0xCE, 0x7B, 0x86, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x02, 0xDF, 0x1F, 0xB5, 0x9A, 0xBD, 0xDA, 0x81,
+0xFF, 0xFF, 0x00, 0xFF, 0xDF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xDF, 0x06, 0xFF, 0xFF, 0xEF, 0x7F,
+0xB5, 0x9A, 0xAD, 0x59, 0xDF, 0x1D, 0xFF, 0xFF, 0xFF, 0xDF, 0x85, 0xFF, 0xFF
+};
@@ -0,0 +1,264 @@
+// UTFT_Host_Polygon
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks fillTriangle(), fillPolygon() and drawPolyline(),
+// then compares them with drawing the same shapes from lines.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_Polygon.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o polygon
+//   ./polygon
+//
+// Random triangles, concave and self-crossing polygons, with whole and
+// 1/16 pixel coordinates, are filled and compared pixel by pixel with a
+// point in polygon test of every pixel center. fillPolygon() must return
+// false for polygons with too many points. The gauge needles and
+// arrows of the benchmark are drawn both ways on an ILI9341_S5P: filled
+// with fillTriangle() and fillPolygon(), and with a drawLine() from the
+// tip to every pixel of the base. Their cost is given in bus bytes,
+// windows and the time on a 16 MHz AVR from the cycle model of the
+// emulator. The screen is saved as polygon.ppm.
+//
+
+#include <UTFT.h>
+
+#define W		240
+#define H		320
+#define TESTS	400
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+word frame[W*H];
+int  errors = 0;
+
+// Even-odd test of the pixel center (px,py), with the edges inside
+boolean inside(const int *x, const int *y, int n, int frac, int px, int py)
+{
+  long    sx = long(px)*(1<<frac), sy = long(py)*(1<<frac);
+  boolean in = false;
+
+  for (int i=0, j=n-1; i<n; j=i++)
+  {
+    long xi = x[i], yi = y[i], xj = x[j], yj = y[j];
+
+    // On the edge
+    if (((sx-xi)*(yj-yi)==(sy-yi)*(xj-xi)) and (sx>=min(xi, xj)) and (sx<=max(xi, xj)) and (sy>=min(yi, yj)) and (sy<=max(yi, yj)))
+      return true;
+    if ((yi>sy)!=(yj>sy))
+    {
+      // The edge crosses the row to the right of the center
+      long d = yj-yi, t = (sx-xi)*d-(xj-xi)*(sy-yi);
+
+      if ((d>0) ? (t<0) : (t>0))
+        in = !in;
+    }
+  }
+  return in;
+}
+
+void check(const char *name, const int *x, const int *y, int n, int frac)
+{
+  long diff = 0;
+
+  myGLCD.setColor(VGA_BLACK);
+  myGLCD.fillRect(0, 0, W-1, H-1);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.fillPolygon(x, y, n, frac);
+  for (int py=0; py<H; py++)
+    for (int px=0; px<W; px++)
+      if ((utft_host.getPixel(px, py)==VGA_WHITE)!=inside(x, y, n, frac, px, py))
+        diff++;
+  if (diff)
+  {
+    printf("FAILED: %s, %d points, frac %d: %ld pixels differ\n", name, n, frac, diff);
+    errors++;
+  }
+}
+
+void checkAll()
+{
+  int x[12], y[12];
+
+  srand(1);
+  for (int t=0; t<TESTS; t++)
+  {
+    int n = (t<TESTS/2) ? 3 : 4+(rand() % 9);
+    int frac = (t % 2) ? 4 : 0;
+
+    for (int i=0; i<n; i++)
+    {
+      x[i] = (rand() % (W+40))-20;
+      y[i] = (rand() % (H+40))-20;
+      if (frac)
+        x[i] = (x[i]*16)+(rand() % 16), y[i] = (y[i]*16)+(rand() % 16);
+    }
+    check((n==3) ? "triangle" : "polygon", x, y, n, frac);
+  }
+
+  // Shapes with edges on pixel centers
+  int rx[] = {10, 60, 60, 10}, ry[] = {20, 20, 50, 50};
+  int ux[] = {10, 30, 30, 50, 50, 70, 70, 10}, uy[] = {10, 10, 40, 40, 10, 10, 60, 60};
+  int sx[] = {20, 120, 20, 120}, sy[] = {20, 100, 100, 20};
+  int px[] = {100}, py[] = {100};
+
+  check("rectangle", rx, ry, 4, 0);
+  check("U shape", ux, uy, 8, 0);
+  check("bow tie", sx, sy, 4, 0);
+  check("point", px, py, 1, 0);
+  check("line", sx, sy, 2, 0);
+
+  // Polygons without points or with more than UTFT_POLY_POINTS points
+  // are refused and nothing is sent
+  int zx[UTFT_POLY_POINTS+1], zy[UTFT_POLY_POINTS+1];
+
+  for (int i=0; i<=UTFT_POLY_POINTS; i++)
+  {
+    zx[i] = 20+(i*2);
+    zy[i] = (i % 2) ? 250 : 270;
+  }
+  utft_host.resetStats();
+  if (myGLCD.fillPolygon(zx, zy, 0) or myGLCD.fillPolygon(zx, zy, UTFT_POLY_POINTS+1) or (utft_host.stats.bytes!=0))
+  {
+    printf("FAILED: a polygon with too many points was not refused\n");
+    errors++;
+  }
+  if (!myGLCD.fillPolygon(zx, zy, UTFT_POLY_POINTS))
+  {
+    printf("FAILED: a polygon with UTFT_POLY_POINTS points was refused\n");
+    errors++;
+  }
+
+  // A rectangle gives the same pixels as fillRect()
+  myGLCD.setColor(VGA_BLACK);
+  myGLCD.fillRect(0, 0, W-1, H-1);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.fillRect(10, 20, 60, 50);
+  for (int i=0; i<W*H; i++)
+    frame[i] = utft_host.getPixel(i % W, i / W);
+  myGLCD.fillPolygon(rx, ry, 4);
+  myGLCD.setColor(VGA_BLACK);
+  for (int i=0; i<W*H; i++)
+    if (frame[i]!=utft_host.getPixel(i % W, i / W))
+    {
+      printf("FAILED: rectangle differs from fillRect()\n");
+      errors++;
+      break;
+    }
+
+  // A closed polyline is the outline of drawLine() calls
+  myGLCD.fillRect(0, 0, W-1, H-1);
+  myGLCD.setColor(VGA_LIME);
+  for (int i=0; i<8; i++)
+    myGLCD.drawLine(ux[i], uy[i]+100, ux[(i+1) % 8], uy[(i+1) % 8]+100);
+  for (int i=0; i<W*H; i++)
+    frame[i] = utft_host.getPixel(i % W, i / W);
+  myGLCD.setColor(VGA_BLACK);
+  myGLCD.fillRect(0, 0, W-1, H-1);
+  myGLCD.setColor(VGA_LIME);
+  for (int i=0; i<8; i++)
+    uy[i] += 100;
+  myGLCD.drawPolyline(ux, uy, 8, true);
+  for (int i=0; i<W*H; i++)
+    if (frame[i]!=utft_host.getPixel(i % W, i / W))
+    {
+      printf("FAILED: closed polyline differs from drawLine()\n");
+      errors++;
+      break;
+    }
+  printf("%d random shapes and 7 others checked\n", TESTS);
+}
+
+// The shapes of the benchmark
+struct shape
+{
+  const char *name;
+  int        n;
+  int        x[7], y[7];
+};
+
+shape shapes[] = {
+  {"Needle",    3, {120, 116, 124},           {40, 200, 200}},
+  {"Needle 30", 3, {200, 113, 121},           {62, 198, 203}},
+  {"Wide 45",   3, {200, 100, 120},           {60, 140, 160}},
+  {"Arrow",     7, {120, 170, 140, 140, 100, 100, 70}, {220, 260, 260, 310, 310, 260, 260}}
+};
+
+// The tip is joined by a line to every pixel of the base, the way needles
+// were drawn before fillTriangle(). Arrows are a triangle and a
+// rectangle.
+void lineFill(int x1, int y1, int x2, int y2, int x3, int y3)
+{
+  int steps = max(abs(x3-x2), abs(y3-y2));
+
+  for (int i=0; i<=steps; i++)
+    myGLCD.drawLine(x1, y1, x2+((x3-x2)*i)/max(steps, 1), y2+((y3-y2)*i)/max(steps, 1));
+}
+
+void lineShape(shape *s)
+{
+  if (s->n==3)
+    lineFill(s->x[0], s->y[0], s->x[1], s->y[1], s->x[2], s->y[2]);
+  else
+  {
+    lineFill(s->x[0], s->y[0], s->x[1], s->y[1], s->x[6], s->y[6]);
+    for (int y=s->y[2]; y<=s->y[3]; y++)
+      myGLCD.drawLine(s->x[4], y, s->x[3], y);
+  }
+}
+
+void benchmark()
+{
+  printf("\n%-10s %-10s %10s %10s %10s %10s %8s\n", "Shape", "Method", "Bytes", "Windows", "Pixels", "AVR us", "Missed");
+  for (int i=0; i<int(sizeof(shapes)/sizeof(shape)); i++)
+  {
+    shape *s = &shapes[i];
+
+    for (int m=0; m<2; m++)
+    {
+      long missed = 0;
+
+      myGLCD.setColor(VGA_BLACK);
+      myGLCD.fillRect(0, 0, W-1, H-1);
+      myGLCD.setColor(m ? VGA_YELLOW : VGA_RED);
+      myGLCD.clrXY();
+      utft_host.resetStats();
+      if (m==0)
+        lineShape(s);
+      else if (s->n==3)
+        myGLCD.fillTriangle(s->x[0], s->y[0], s->x[1], s->y[1], s->x[2], s->y[2]);
+      else
+        myGLCD.fillPolygon(s->x, s->y, s->n);
+      for (int py=0; py<H; py++)
+        for (int px=0; px<W; px++)
+          if (inside(s->x, s->y, s->n, 0, px, py) and (utft_host.getPixel(px, py)==VGA_BLACK))
+            missed++;
+      printf("%-10s %-10s %10lu %10lu %10lu %10lu %8ld\n", s->name, m ? "Polygon" : "Lines", utft_host.stats.bytes,
+        utft_host.stats.windows, utft_host.stats.pixels, utft_host.stats.cycles/16, missed);
+      if (m and missed)
+        errors++;
+    }
+  }
+}
+
+int main()
+{
+  myGLCD.InitLCD(PORTRAIT);
+  checkAll();
+  myGLCD.InitLCD(LANDSCAPE);
+  int lx[] = {10, 300, 150}, ly[] = {5, 100, 230};
+  check("landscape", lx, ly, 3, 0);
+
+  myGLCD.InitLCD(PORTRAIT);
+  benchmark();
+
+  myGLCD.setColor(VGA_BLACK);
+  myGLCD.fillRect(0, 0, W-1, H-1);
+  for (int i=0; i<int(sizeof(shapes)/sizeof(shape)); i++)
+  {
+    myGLCD.setColor((i % 2) ? VGA_YELLOW : VGA_AQUA);
+    myGLCD.fillPolygon(shapes[i].x, shapes[i].y, shapes[i].n);
+  }
+  utft_host.savePPM("polygon.ppm");
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,84 @@
+// UTFT_Host_Primitives
+//
+// This program runs the library on a PC against the emulated display 
+// controller and prints the bus cost of each drawing primitive for 
+// three different controllers. 
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_Primitives.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o primitives
+//   ./primitives
+//
+// The final screen of each controller is saved as a .ppm image.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+
+struct model
+{
+  byte        id;
+  const char *name;
+};
+
+model models[] = {{ILI9341_S5P, "ILI9341_S5P"}, {SSD1963_800, "SSD1963_800"}, {ST7735, "ST7735"}};
+
+void report(const char *primitive)
+{
+  printf("%-14s %8lu %8lu %8lu %5lu %8lu %8lu\n", primitive, utft_host.stats.com, utft_host.stats.data,
+    utft_host.stats.bytes, utft_host.stats.cs_toggles, utft_host.stats.windows, utft_host.stats.pixels);
+  utft_host.resetStats();
+}
+
+int main()
+{
+  for (unsigned m=0; m<sizeof(models)/sizeof(model); m++)
+  {
+    UTFT myGLCD(models[m].id, 1, 2, 3, 4, 5);
+    char filename[32];
+
+    myGLCD.InitLCD();
+    myGLCD.setFont(SmallFont);
+    printf("\n%s (%dx%d)\n", models[m].name, myGLCD.getDisplayXSize(), myGLCD.getDisplayYSize());
+    printf("%-14s %8s %8s %8s %5s %8s %8s\n", "Primitive", "COM", "DATA", "Bytes", "CS", "Windows", "Pixels");
+    report("InitLCD");
+
+    myGLCD.clrScr();
+    report("clrScr");
+    myGLCD.setColor(VGA_RED);
+    myGLCD.drawPixel(10, 10);
+    report("drawPixel");
+    myGLCD.drawLine(0, 0, 100, 37);
+    report("drawLine");
+    myGLCD.drawHLine(0, 50, 100);
+    report("drawHLine");
+    myGLCD.drawRect(10, 60, 60, 100);
+    report("drawRect");
+    myGLCD.fillRect(70, 60, 120, 100);
+    report("fillRect");
+    myGLCD.drawRoundRect(10, 110, 60, 150);
+    report("drawRoundRect");
+    myGLCD.fillRoundRect(70, 110, 120, 150);
+    report("fillRoundRect");
+    myGLCD.drawCircle(40, 40, 20);
+    report("drawCircle");
+    myGLCD.fillCircle(90, 40, 20);
+    report("fillCircle");
+    myGLCD.setColor(VGA_WHITE);
+    myGLCD.setBackColor(VGA_BLUE);
+    myGLCD.print("UTFT", 0, 0);
+    report("print");
+    myGLCD.setBackColor(VGA_TRANSPARENT);
+    myGLCD.print("UTFT", 0, 14);
+    report("print (trans)");
+    myGLCD.printNumI(1234, 0, 28);
+    report("printNumI");
+    myGLCD.printNumF(12.34, 2, 0, 42);
+    report("printNumF");
+
+    sprintf(filename, "%s.ppm", models[m].name);
+    utft_host.savePPM(filename);
+  }
+  return 0;
+}
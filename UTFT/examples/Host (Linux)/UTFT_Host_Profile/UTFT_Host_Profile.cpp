@@ -0,0 +1,130 @@
+// UTFT_Host_Profile
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks the table kept by the profiler. A frame using
+// most of the drawing functions is drawn, and the pixels and setXY()
+// calls counted for every primitive must add up to what the emulated
+// controller received.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -DUTFT_PROFILE -Wno-write-strings -I../../.. UTFT_Host_Profile.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o profile
+//   ./profile
+//
+// The table is printed with printProfile(), as a sketch would print it
+// to the serial port. The time is measured with micros() on the PC, so
+// only the calls, pixels and setXY columns are the same on every run.
+//
+// The profile counts the pixels asked for. The fast fills of the parallel
+// drivers send one more pixel when the count is not a multiple of 16,
+// which the emulator does count, so the check is made on a serial module.
+//
+
+#include <UTFT.h>
+
+#if !defined(UTFT_PROFILE)
+  #error "This example must be built with -DUTFT_PROFILE"
+#endif
+
+extern uint8_t SmallFont[];
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+word icon[16*16];
+int  errors = 0;
+
+// printProfile() writes to any Print, here the standard output
+class StdoutPrint : public Print
+{
+  public:
+    size_t write(uint8_t c) { return fputc(c, stdout)==EOF ? 0 : 1; }
+};
+
+StdoutPrint out;
+
+void drawFrame()
+{
+  int px[] = {150, 230, 200, 100}, py[] = {200, 220, 300, 280};
+
+  myGLCD.clrScr();
+  myGLCD.setColor(VGA_BLUE);
+  myGLCD.fillRect(0, 0, 239, 13);
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLUE);
+  myGLCD.print("UTFT profiler", CENTER, 1);
+  myGLCD.setColor(VGA_GRAY);
+  myGLCD.drawRect(0, 14, 239, 319);
+  myGLCD.setColor(VGA_RED);
+  myGLCD.fillRoundRect(10, 30, 110, 80);
+  myGLCD.setColor(VGA_GREEN);
+  myGLCD.fillCircle(170, 55, 25);
+  myGLCD.drawCircle(170, 55, 30);
+  for (int i=0; i<10; i++)
+  {
+    myGLCD.setColor(VGA_YELLOW);
+    myGLCD.drawLine(10, 100+(i*8), 230, 180-(i*8));
+    myGLCD.drawPixel(5, 100+(i*8));
+  }
+  myGLCD.setColor(VGA_WHITE);
+  myGLCD.setBackColor(VGA_BLACK);
+  myGLCD.printNumI(12345, 10, 190);
+  myGLCD.printNumF(3.14159, 3, 10, 205);
+  for (int i=0; i<4; i++)
+    myGLCD.drawBitmap(10+(i*20), 230, 16, 16, icon);
+  myGLCD.setColor(VGA_AQUA);
+  myGLCD.fillPolygon(px, py, 4);
+  myGLCD.fillTriangle(20, 300, 60, 260, 90, 310);
+}
+
+int main()
+{
+  for (int i=0; i<16*16; i++)
+    icon[i] = ((i % 16)<<11) | ((i / 16)<<6) | 0x1F;
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.setFont(SmallFont);
+
+  myGLCD.resetProfile();
+  utft_host.resetStats();
+  drawFrame();
+  myGLCD.printProfile(out);
+
+  // Every pixel and window is counted once, by the outermost primitive
+  unsigned long calls = 0, pixels = 0, windows = 0;
+
+  for (int i=0; i<PRIM_COUNT; i++)
+  {
+    calls += myGLCD.profile[i].calls;
+    pixels += myGLCD.profile[i].pixels;
+    windows += myGLCD.profile[i].windows;
+  }
+  printf("\nTotal: %lu calls, %lu pixels, %lu setXY calls\n", calls, pixels, windows);
+  printf("Emulator: %lu pixels, %lu windows\n", utft_host.stats.pixels, utft_host.stats.windows);
+  if (pixels!=utft_host.stats.pixels)
+  {
+    printf("FAILED: the profile counted %lu pixels\n", pixels);
+    errors++;
+  }
+  if (windows!=utft_host.stats.windows)
+  {
+    printf("FAILED: the profile counted %lu windows\n", windows);
+    errors++;
+  }
+  if ((myGLCD.profile[PRIM_FILLROUNDRECT].calls!=1) or (myGLCD.profile[PRIM_DRAWLINE].calls!=10) or
+      (myGLCD.profile[PRIM_DRAWBITMAP].pixels!=4*16*16) or (myGLCD.profile[PRIM_CLRSCR].pixels!=240*320))
+  {
+    printf("FAILED: wrong calls or pixels for a primitive\n");
+    errors++;
+  }
+
+  // The same frame again adds up, and resetProfile() clears the table
+  drawFrame();
+  if (myGLCD.profile[PRIM_DRAWLINE].calls!=20)
+    errors++;
+  myGLCD.resetProfile();
+  for (int i=0; i<PRIM_COUNT; i++)
+    if (myGLCD.profile[i].calls or myGLCD.profile[i].pixels or myGLCD.profile[i].windows or myGLCD.profile[i].time)
+      errors++;
+  utft_host.savePPM("profile.ppm");
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,183 @@
+// UTFT_Host_PushPixels
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks pushPixels888() and pushPixelsGray8(), then
+// measures the speed of the color conversion.
+//
+// Build and run from this folder with:
+//   g++ -O2 -fno-tree-vectorize -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_PushPixels.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o pushpixels
+//   ./pushpixels
+//
+// -fno-tree-vectorize keeps the compiler from using the vector unit of 
+// the PC, which the supported MCUs do not have.
+//
+// An image with an odd size is drawn at an odd position in portrait and
+// landscape mode, with and without dithering, and compared pixel by pixel
+// with a per pixel reference conversion. The conversion speed is printed
+// in million pixels per second for the per pixel conversion used by
+// setColor() and for the word at a time conversion used by the library.
+// The screen is saved as pushpixels.ppm, with the same gradients drawn
+// with and without dithering.
+//
+
+#include <UTFT.h>
+
+#define W		237
+#define H		75
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+const uint8_t bayer[16] = {0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5};
+
+uint8_t rgb[W*H*3], gray[W*H];
+int     errors = 0;
+
+word reference(const uint8_t *p, int bpp, int x, int y, boolean dither)
+{
+  int d = dither ? bayer[((y & 3)*4)+(x & 3)] : 0;
+  int r = p[0], g = (bpp==3) ? p[1] : p[0], b = (bpp==3) ? p[2] : p[0];
+
+  r = min(r+(d>>1), 255);
+  g = min(g+(d>>2), 255);
+  b = min(b+(d>>1), 255);
+  return ((r>>3)<<11) | ((g>>2)<<5) | (b>>3);
+}
+
+void check(byte orient, int bpp, boolean dither)
+{
+  int x = 3, y = 5, diff = 0;
+
+  myGLCD.InitLCD(orient);
+  myGLCD.clrScr();
+  if (bpp==3)
+    myGLCD.pushPixels888(x, y, W, H, rgb, dither);
+  else
+    myGLCD.pushPixelsGray8(x, y, W, H, gray, dither);
+
+  for (int ty=0; ty<H; ty++)
+    for (int tx=0; tx<W; tx++)
+    {
+      const uint8_t *p = (bpp==3) ? &rgb[((ty*W)+tx)*3] : &gray[(ty*W)+tx];
+
+      if (utft_host.getPixel(x+tx, y+ty)!=reference(p, bpp, x+tx, y+ty, dither))
+        diff++;
+    }
+  if ((utft_host.getPixel(x-1, y)!=0) or (utft_host.getPixel(x+W, y+H-1)!=0))
+    diff++;
+  printf("%-15s %-9s %-9s %s\n", bpp==3 ? "pushPixels888" : "pushPixelsGray8",
+    orient==PORTRAIT ? "portrait" : "landscape", dither ? "dithered" : "", diff ? "FAILED" : "ok");
+  if (diff)
+    errors++;
+}
+
+// The conversion as done by setColor(r, g, b)
+void perPixel888(uint16_t *dst, const uint8_t *src, int n)
+{
+  for (int i=0; i<n; i++, src+=3)
+    dst[i] = ((src[0]&248)<<8) | ((src[1]&252)<<3) | ((src[2]&248)>>3);
+}
+
+void perPixelGray8(uint16_t *dst, const uint8_t *src, int n)
+{
+  for (int i=0; i<n; i++, src++)
+    dst[i] = ((src[0]&248)<<8) | ((src[0]&252)<<3) | ((src[0]&248)>>3);
+}
+
+volatile uint16_t sink;
+
+void benchmark(const char *name, int mode)
+{
+  static uint8_t  src[320*3];
+  static uint16_t dst[320];
+  const uint8_t   d[4] = {0, 8, 2, 10};
+  const long      frames = 2000;
+  unsigned long   t;
+
+  for (int i=0; i<320*3; i++)
+    src[i] = (i*37) & 0xFF;
+  t = micros();
+  for (long f=0; f<frames; f++)
+    for (int row=0; row<240; row++)
+    {
+      src[row % 320] = row;
+      switch (mode)
+      {
+      case 0: perPixel888(dst, src, 320); break;
+      case 1: myGLCD._convert_888(dst, src, 320, 0); break;
+      case 2: myGLCD._convert_888(dst, src, 320, d); break;
+      case 3: perPixelGray8(dst, src, 320); break;
+      case 4: myGLCD._convert_gray8(dst, src, 320, 0); break;
+      case 5: myGLCD._convert_gray8(dst, src, 320, d); break;
+      }
+      sink = dst[row];
+    }
+  t = micros()-t;
+  printf("  %-28s %8.1f Mpix/s\n", name, (frames*320.0*240.0)/t);
+}
+
+int main()
+{
+  for (int y=0; y<H; y++)
+    for (int x=0; x<W; x++)
+    {
+      uint8_t *p = &rgb[((y*W)+x)*3];
+
+      p[0] = (x*255)/(W-1);
+      p[1] = (y*255)/(H-1);
+      p[2] = ((x*y)+(x*13)) & 0xFF;
+      gray[(y*W)+x] = ((x+y)*255)/(W+H-2);
+    }
+
+  for (int o=0; o<2; o++)
+    for (int bpp=1; bpp<=3; bpp+=2)
+      for (int dither=0; dither<2; dither++)
+        check(o==0 ? PORTRAIT : LANDSCAPE, bpp, dither);
+
+  // Bytes sent, compared with drawBitmap() of the same image in RGB565
+  static unsigned short rgb565[W*H];
+  for (int i=0; i<W*H; i++)
+    rgb565[i] = reference(&rgb[i*3], 3, 0, 0, false);
+  // Both start from the whole screen window, as the library only sends
+  // the column and row addresses that change
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.clrXY();
+  utft_host.resetStats();
+  myGLCD.pushPixels888(0, 0, W, H, rgb);
+  unsigned long push_bytes = utft_host.stats.bytes;
+  myGLCD.clrXY();
+  utft_host.resetStats();
+  myGLCD.drawBitmap(0, 0, W, H, rgb565);
+  printf("%dx%d image: %lu bytes with pushPixels888(), %lu bytes with drawBitmap()\n", W, H, push_bytes, utft_host.stats.bytes);
+  if (push_bytes!=utft_host.stats.bytes)
+    errors++;
+
+  // Sample screen: smooth gradients without (top) and with dithering
+  static uint8_t grad[240*40*3], ggrad[240*40];
+  for (int y=0; y<40; y++)
+    for (int x=0; x<240; x++)
+    {
+      grad[((y*240)+x)*3] = x/4;
+      grad[(((y*240)+x)*3)+1] = 64+(x/8);
+      grad[(((y*240)+x)*3)+2] = 128+(x/3);
+      ggrad[(y*240)+x] = 40+(x/6);
+    }
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.clrScr();
+  myGLCD.pushPixels888(0, 20, 240, 40, grad);
+  myGLCD.pushPixels888(0, 70, 240, 40, grad, true);
+  myGLCD.pushPixelsGray8(0, 130, 240, 40, ggrad);
+  myGLCD.pushPixelsGray8(0, 180, 240, 40, ggrad, true);
+  myGLCD.pushPixels888(1, 240, W, H, rgb, true);
+  utft_host.savePPM("pushpixels.ppm");
+
+  printf("Conversion of a 320x240 frame:\n");
+  benchmark("RGB888, per pixel", 0);
+  benchmark("RGB888, word at a time", 1);
+  benchmark("RGB888, dithered", 2);
+  benchmark("Gray8, per pixel", 3);
+  benchmark("Gray8, word at a time", 4);
+  benchmark("Gray8, dithered", 5);
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,128 @@
+// UTFT_Host_Rotation
+//
+// This program runs the library on a PC against the emulated display 
+// controller and compares rotated bitmaps and text drawn by the library 
+// with the old per-pixel floating point method.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_Rotation.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o rotation
+//   ./rotation
+//
+// For each angle the program prints the bus traffic and the number of 
+// pixels the old method left unset inside the rotated image (holes).
+//
+
+#include <UTFT.h>
+#include <math.h>
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+#define SIZE 48
+
+unsigned short bitmap[SIZE*SIZE];
+
+// The rotated drawBitmap() from earlier versions of the library
+void legacyBitmap(UTFT &lcd, int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy)
+{
+  double radian=deg*0.0175;
+
+  cbi(lcd.P_CS, lcd.B_CS);
+  for (int ty=0; ty<sy; ty++)
+    for (int tx=0; tx<sx; tx++)
+    {
+      unsigned int col=pgm_read_word(&data[(ty*sx)+tx]);
+      int newx=x+rox+(((tx-rox)*cos(radian))-((ty-roy)*sin(radian)));
+      int newy=y+roy+(((ty-roy)*cos(radian))+((tx-rox)*sin(radian)));
+      lcd.setXY(newx, newy, newx, newy);
+      lcd.LCD_Write_DATA(col>>8,col & 0xff);
+    }
+  sbi(lcd.P_CS, lcd.B_CS);
+  lcd.clrXY();
+}
+
+long countSet(UTFT &lcd)
+{
+  long n=0;
+
+  for (int y=0; y<lcd.getDisplayYSize(); y++)
+    for (int x=0; x<lcd.getDisplayXSize(); x++)
+      if (utft_host.getPixel(x, y)!=0)
+        n++;
+  return n;
+}
+
+void run(UTFT &lcd, int deg, boolean text)
+{
+  unsigned long bytes[2], windows[2], us[2];
+  long          set[2];
+
+  for (int pass=0; pass<2; pass++)
+  {
+    lcd.fillScr(VGA_BLACK);
+    utft_host.resetStats();
+    unsigned long start=micros();
+    if (text)
+    {
+      if (pass==0)
+      {
+        // Old rotateChar() placed each glyph pixel on its own
+        double radian=deg*0.0175;
+        lcd.setColor(VGA_WHITE);
+        for (int c=0; c<4; c++)
+        {
+          uint8_t *font=BigFont;
+          word temp=((("UTFT"[c])-pgm_read_byte(&font[2]))*((16/8)*16))+4;
+          for (int j=0; j<16; j++)
+            for (int i=0; i<16; i++)
+              if (pgm_read_byte(&font[temp+(j*2)+(i/8)]) & (0x80>>(i&7)))
+              {
+                int newx=60+(((i+(c*16))*cos(radian))-(j*sin(radian)));
+                int newy=60+((j*cos(radian))+((i+(c*16))*sin(radian)));
+                lcd.drawPixel(newx, newy);
+              }
+        }
+      }
+      else
+      {
+        lcd.setColor(VGA_WHITE);
+        lcd.setBackColor(VGA_TRANSPARENT);
+        lcd.print("UTFT", 60, 60, deg);
+      }
+    }
+    else
+    {
+      if (pass==0)
+        legacyBitmap(lcd, 60, 60, SIZE, SIZE, bitmap, deg, SIZE/2, SIZE/2);
+      else
+        lcd.drawBitmap(60, 60, SIZE, SIZE, bitmap, deg, SIZE/2, SIZE/2);
+    }
+    us[pass]=micros()-start;
+    bytes[pass]=utft_host.stats.bytes;
+    windows[pass]=utft_host.stats.windows;
+    set[pass]=countSet(lcd);
+  }
+  printf("%-7s %4d %9lu %9lu %7lu %7lu %6lu %6lu %6ld\n", text ? "text" : "bitmap", deg, bytes[0], bytes[1],
+    windows[0], windows[1], us[0], us[1], set[1]-set[0]);
+}
+
+int main()
+{
+  UTFT myGLCD(ILI9341_S5P, 1, 2, 3, 4, 5);
+
+  for (int y=0; y<SIZE; y++)
+    for (int x=0; x<SIZE; x++)
+      bitmap[(y*SIZE)+x]=((x*31/SIZE)<<11) | ((y*63/SIZE)<<5) | 0x10;
+
+  myGLCD.InitLCD();
+  myGLCD.setFont(BigFont);
+  printf("%-7s %4s %9s %9s %7s %7s %6s %6s %6s\n", "Source", "Deg", "Bytes old", "Bytes new",
+    "Win old", "Win new", "us old", "us new", "Holes");
+  for (int deg=0; deg<360; deg+=30)
+    run(myGLCD, deg, false);
+  for (int deg=0; deg<360; deg+=45)
+    run(myGLCD, deg, true);
+  myGLCD.drawBitmap(60, 60, SIZE, SIZE, bitmap, 30, SIZE/2, SIZE/2);
+  utft_host.savePPM("rotation.ppm");
+  return 0;
+}
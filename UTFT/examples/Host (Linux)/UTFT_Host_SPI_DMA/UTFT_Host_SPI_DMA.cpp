@@ -0,0 +1,113 @@
+// UTFT_Host_SPI_DMA
+//
+// This program runs the library on a PC against the emulated display 
+// controller and checks the hardware SPI and DMA transport for serial
+// modules against the software (bit-banged) transport.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -DUTFT_SPI_DMA -Wno-write-strings -I../../.. UTFT_Host_SPI_DMA.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o spidma
+//   ./spidma
+//
+// The same scene is drawn once with the software transport and once 
+// through the emulated SPI port for a 5-pin module (DMA) and a 4-pin 
+// module (blocking 9-bit SPI). The GRAM contents must be identical, and 
+// the DMA channel must never see a write to a buffer that is in flight.
+// Build without -DUTFT_SPI_DMA to check the blocking SPI transport for 
+// 5-pin modules as well.
+//
+// Add -DUTFT_HOST_DMA_RATE=1 to emulate a slow SPI clock compared to the
+// CPU, which keeps the DMA channel busy for most of the time.
+//
+
+#include <UTFT.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+#define MAX_PIXELS (240*320)
+
+#if defined(UTFT_SPI_DMA)
+  #define MODE_5PIN "(DMA)"
+#else
+  #define MODE_5PIN "(SPI)"
+#endif
+
+word          reference[MAX_PIXELS];
+unsigned short bitmap[32*32];
+int           errors = 0;
+
+void drawScene(UTFT &lcd)
+{
+  lcd.fillScr(VGA_NAVY);
+  lcd.setColor(VGA_RED);
+  lcd.fillRect(10, 10, 120, 60);
+  lcd.setColor(VGA_YELLOW);
+  for (int i=0; i<lcd.getDisplayXSize(); i+=7)
+    lcd.drawLine(0, lcd.getDisplayYSize()-1, i, 70);
+  lcd.setColor(VGA_LIME);
+  lcd.fillCircle(170, 200, 40);
+  lcd.setColor(VGA_WHITE);
+  lcd.drawCircle(60, 200, 35);
+  lcd.setBackColor(VGA_NAVY);
+  lcd.setFont(BigFont);
+  lcd.print("UTFT", 20, 120);
+  lcd.setFont(SmallFont);
+  lcd.setBackColor(VGA_TRANSPARENT);
+  lcd.print("Hardware SPI", 20, 140);
+  lcd.drawBitmap(150, 20, 32, 32, bitmap);
+  lcd.drawBitmap(150, 60, 32, 32, bitmap, 2);
+  lcd.drawBitmap(100, 250, 32, 32, bitmap, 30, 16, 16);
+}
+
+void check(const char *name, byte model, int sda, int scl, byte orient)
+{
+  UTFT soft(model, 4, 5, 6, 7, 8);
+
+  soft.InitLCD(orient);
+  utft_host.resetStats();
+  drawScene(soft);
+  long pixels = long(utft_host.gram_w)*utft_host.gram_h;
+  memcpy(reference, utft_host.gram, pixels*sizeof(word));
+  unsigned long soft_bytes = utft_host.stats.bytes;
+
+  UTFT spi(model, sda, scl, 6, 7, 8);
+
+  spi.InitLCD(orient);
+  utft_host.resetStats();
+  drawScene(spi);
+  spi.waitForDMA();
+
+  long diff = 0;
+  for (long i=0; i<pixels; i++)
+    if (utft_host.gram[i]!=reference[i])
+      diff++;
+
+  printf("%-24s %s  bytes %7lu/%-7lu  DMA transfers %6lu  bytes %7lu  polls %7lu  conflicts %lu\n",
+    name, orient==PORTRAIT ? "P" : "L", soft_bytes, utft_host.stats.bytes, 
+    utft_host.stats.dma_transfers, utft_host.stats.dma_bytes, 
+    utft_host.stats.dma_polls, utft_host.stats.dma_conflicts);
+  if ((diff!=0) or (utft_host.stats.dma_conflicts!=0))
+  {
+    printf("  FAILED: %ld pixels differ\n", diff);
+    errors++;
+  }
+}
+
+int main()
+{
+  for (int y=0; y<32; y++)
+    for (int x=0; x<32; x++)
+      bitmap[(y*32)+x] = ((x*8)<<8) | (y*8) | 0x0401;
+
+  for (int o=0; o<2; o++)
+  {
+    byte orient = (o==0) ? PORTRAIT : LANDSCAPE;
+
+    check("ILI9341_S5P " MODE_5PIN, ILI9341_S5P, MOSI, SCK, orient);
+    check("ILI9341_S4P (9-bit SPI)", ILI9341_S4P, MOSI, SCK, orient);
+    check("ST7735 " MODE_5PIN, ST7735, MOSI, SCK, orient);
+  }
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,124 @@
+// UTFT_Host_SerialSpeed
+//
+// This program runs the library on a PC against the emulated display
+// controller and compares two ways of sending pixels to a display on the
+// software serial bus:
+//   - one LCD_Write_DATA() call for every pixel, as the library used to
+//   - fillRect() and drawBitmap(), which send the whole run of pixels in
+//     one call with RS held high
+// for the 5-pin and 4-pin serial ILI9341.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_SerialSpeed.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o serialspeed
+//   ./serialspeed
+//
+// The speed is printed in pixels per second of a 16 MHz AVR, from the
+// cycles per byte set by UTFT_HOST_SERIAL_CYCLES and
+// UTFT_HOST_FAST_SERIAL_CYCLES. Those are estimates; the UTFT_Serial_Benchmark
+// example measures the real speed on the hardware. The screens drawn both
+// ways are compared pixel by pixel and the last one is saved as
+// serialspeed.ppm.
+//
+
+#include <UTFT.h>
+
+#define W		240
+#define H		320
+#define BW		100
+#define BH		80
+
+UTFT myGLCD5(ILI9341_S5P, 4, 5, 6, 7, 8);
+UTFT myGLCD4(ILI9341_S4P, 4, 5, 6, 7);
+
+unsigned short picture[BW*BH];
+word           frame[W*H];
+int            errors = 0;
+
+// Every pixel on its own, through the public low level functions
+void legacyFill(UTFT *lcd, int x1, int y1, int x2, int y2, word color)
+{
+  cbi(lcd->P_CS, lcd->B_CS);
+  lcd->setXY(x1, y1, x2, y2);
+  for (long i=0; i<long(x2-x1+1)*(y2-y1+1); i++)
+    lcd->LCD_Write_DATA(color>>8, color & 0xFF);
+  sbi(lcd->P_CS, lcd->B_CS);
+}
+
+void legacyBitmap(UTFT *lcd, int x, int y, int sx, int sy, unsigned short *data)
+{
+  cbi(lcd->P_CS, lcd->B_CS);
+  lcd->setXY(x, y, x+sx-1, y+sy-1);
+  for (long i=0; i<long(sx)*sy; i++)
+    lcd->LCD_Write_DATA(data[i]>>8, data[i] & 0xFF);
+  sbi(lcd->P_CS, lcd->B_CS);
+}
+
+double pixelsPerSecond(long pixels)
+{
+  return (pixels*double(UTFT_HOST_CPU_HZ))/utft_host.stats.cycles;
+}
+
+void run(UTFT *lcd, const char *name)
+{
+  double  fill[2], bitmap[2];
+  long    diff = 0;
+
+  for (int fast=0; fast<2; fast++)
+  {
+    lcd->InitLCD(PORTRAIT);
+    lcd->clrXY();
+    utft_host.resetStats();
+    if (fast)
+    {
+      lcd->setColor(VGA_NAVY);
+      lcd->fillRect(0, 0, W-1, H-1);
+    }
+    else
+      legacyFill(lcd, 0, 0, W-1, H-1, VGA_NAVY);
+    fill[fast] = pixelsPerSecond(long(W)*H);
+
+    utft_host.resetStats();
+    for (int i=0; i<4; i++)
+      if (fast)
+        lcd->drawBitmap(20+(i*30), 20+(i*70), BW, BH, picture);
+      else
+        legacyBitmap(lcd, 20+(i*30), 20+(i*70), BW, BH, picture);
+    bitmap[fast] = pixelsPerSecond(4L*BW*BH);
+
+    for (int y=0; y<H; y++)
+      for (int x=0; x<W; x++)
+        if (fast==0)
+          frame[(y*W)+x] = utft_host.getPixel(x, y);
+        else if (frame[(y*W)+x]!=utft_host.getPixel(x, y))
+          diff++;
+  }
+
+  printf("%-12s %-10s %12.0f %12.0f %8.2fx\n", name, "fillRect", fill[0], fill[1], fill[1]/fill[0]);
+  printf("%-12s %-10s %12.0f %12.0f %8.2fx\n", name, "drawBitmap", bitmap[0], bitmap[1], bitmap[1]/bitmap[0]);
+  if (diff)
+  {
+    printf("FAILED: %ld pixels differ\n", diff);
+    errors++;
+  }
+  if ((utft_host.getPixel(0, 0)!=VGA_NAVY) or (utft_host.getPixel(20+BW/2, 20+BH/2)!=picture[((BH/2)*BW)+(BW/2)]))
+  {
+    printf("FAILED: %s screen\n", name);
+    errors++;
+  }
+}
+
+int main()
+{
+  for (int y=0; y<BH; y++)
+    for (int x=0; x<BW; x++)
+      picture[(y*BW)+x] = ((x*31/BW)<<11) | ((y*63/BH)<<5) | ((x^y) & 31);
+
+  printf("Pixels per second at 16 MHz, %d and %d cycles per byte\n", UTFT_HOST_SERIAL_CYCLES, UTFT_HOST_FAST_SERIAL_CYCLES);
+  printf("%-12s %-10s %12s %12s %9s\n", "Display", "Function", "Per pixel", "Run", "Speedup");
+  run(&myGLCD5, "ILI9341_S5P");
+  run(&myGLCD4, "ILI9341_S4P");
+  utft_host.savePPM("serialspeed.ppm");
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,273 @@
+// UTFT_Host_StreamBitmap
+//
+// This program runs the library on a PC against the emulated display
+// controller and checks drawBitmapStream(). The same picture is streamed
+// as raw RGB565, as RLE packets and as 24 bit, RGB565 and RGB555 BMP
+// files, in portrait and landscape mode, and compared pixel by pixel with
+// the picture. The stream hands out its bytes slowly, as a serial port
+// or a network client would.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -Wno-write-strings -I../../.. UTFT_Host_StreamBitmap.cpp ../../../UTFT.cpp -x c ../../../DefaultFonts.c -o streambitmap
+//   ./streambitmap
+//
+// A stream that ends too early and an unsupported BMP file must make
+// drawBitmapStream() return false. The screen is saved as
+// streambitmap.ppm.
+//
+
+#include <UTFT.h>
+
+#define W		77
+#define H		53
+#define PX		5
+#define PY		9
+
+UTFT myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+
+struct Data
+{
+  uint8_t b[W*H*4+128];
+  int     len;
+
+  void push_back(uint8_t v) { b[len++] = v; }
+};
+
+// A Stream reading from memory, where only every third read finds a byte
+class MemoryStream : public Stream
+{
+  public:
+    MemoryStream(const Data &data) : _data(data), _pos(0), _polls(0) {}
+    int available() { return _data.len-_pos; }
+    int peek() { return (_pos<_data.len) ? _data.b[_pos] : -1; }
+    int read()
+    {
+      if ((++_polls % 3)!=0)
+        return -1;
+      return (_pos<_data.len) ? _data.b[_pos++] : -1;
+    }
+
+  private:
+    const Data    &_data;
+    int           _pos;
+    unsigned long _polls;
+};
+
+uint8_t picture[W*H*3];
+Data    data;
+int     errors = 0;
+
+word color565(const uint8_t *p)
+{
+  return ((p[0] & 0xF8)<<8) | ((p[1] & 0xFC)<<3) | (p[2]>>3);
+}
+
+word color555(const uint8_t *p)
+{
+  word v = ((p[0]>>3)<<10) | ((p[1]>>3)<<5) | (p[2]>>3);
+
+  return ((v & 0x7FE0)<<1) | ((v>>4) & 0x20) | (v & 0x1F);
+}
+
+void put16(Data &v, word w, boolean big)
+{
+  v.push_back(big ? w>>8 : w & 0xFF);
+  v.push_back(big ? w & 0xFF : w>>8);
+}
+
+void put32(Data &v, long l)
+{
+  for (int i=0; i<4; i++)
+    v.push_back((l>>(i*8)) & 0xFF);
+}
+
+Data &raw565(Data &v)
+{
+  v.len = 0;
+  for (int i=0; i<W*H; i++)
+    put16(v, color565(&picture[i*3]), true);
+  return v;
+}
+
+// Runs of 3 or more pixels are repeat packets, everything else literals
+Data &rle565(Data &v)
+{
+  v.len = 0;
+  for (int y=0; y<H; y++)
+  {
+    int x = 0;
+
+    while (x<W)
+    {
+      word c = color565(&picture[((y*W)+x)*3]);
+      int  n = 1;
+
+      while ((x+n<W) and (n<128) and (color565(&picture[((y*W)+x+n)*3])==c))
+        n++;
+      if (n>=3)
+      {
+        v.push_back(0x80 | (n-1));
+        put16(v, c, true);
+      }
+      else
+      {
+        n = 0;
+        while ((x+n<W) and (n<128) and ((x+n+2>=W) or (color565(&picture[((y*W)+x+n)*3])!=color565(&picture[((y*W)+x+n+2)*3]))))
+          n++;
+        if (n==0)
+          n = 1;
+        v.push_back(n-1);
+        for (int i=0; i<n; i++)
+          put16(v, color565(&picture[((y*W)+x+i)*3]), true);
+      }
+      x += n;
+    }
+  }
+  return v;
+}
+
+// bits 24: bottom-up BGR. 16: top-down RGB565 bitfields. 15: bottom-up
+// RGB555. 32 is not supported by drawBitmapStream().
+Data &bmp(Data &v, int bits)
+{
+  int  size = (bits==24) ? 3 : (bits==32) ? 4 : 2;
+  int  stride = ((W*size)+3) & ~3;
+  int  offset = (bits==16) ? 66 : 54+10;
+
+  v.len = 0;
+  v.push_back('B');
+  v.push_back('M');
+  put32(v, offset+(stride*H));
+  put32(v, 0);
+  put32(v, offset);
+  put32(v, 40);
+  put32(v, W);
+  put32(v, (bits==16) ? -H : H);
+  put16(v, 1, false);
+  put16(v, (bits==15) ? 16 : bits, false);
+  put32(v, (bits==16) ? 3 : 0);
+  for (int i=0; i<5; i++)
+    put32(v, 0);
+  if (bits==16)
+  {
+    put32(v, 0xF800);
+    put32(v, 0x07E0);
+    put32(v, 0x001F);
+  }
+  while (v.len<offset)
+    v.push_back(0xAA);
+  for (int r=0; r<H; r++)
+  {
+    int y = (bits==16) ? r : H-1-r;
+
+    for (int x=0; x<W; x++)
+    {
+      const uint8_t *p = &picture[((y*W)+x)*3];
+
+      if (bits==16)
+        put16(v, color565(p), false);
+      else if (bits==15)
+        put16(v, ((p[0]>>3)<<10) | ((p[1]>>3)<<5) | (p[2]>>3), false);
+      else
+      {
+        v.push_back(p[2]);
+        v.push_back(p[1]);
+        v.push_back(p[0]);
+        if (bits==32)
+          v.push_back(0);
+      }
+    }
+    for (int i=W*size; i<stride; i++)
+      v.push_back(0);
+  }
+  return v;
+}
+
+void check(const char *name, const Data &data, byte format, byte orient, boolean rgb555=false)
+{
+  MemoryStream stream(data);
+  boolean      ok;
+  long         diff = 0;
+
+  myGLCD.InitLCD(orient);
+  myGLCD.clrScr();
+  utft_host.resetStats();
+  ok = myGLCD.drawBitmapStream(stream, PX, PY, W, H, format);
+  for (int y=0; y<H; y++)
+    for (int x=0; x<W; x++)
+    {
+      const uint8_t *p = &picture[((y*W)+x)*3];
+
+      if (utft_host.getPixel(PX+x, PY+y)!=(rgb555 ? color555(p) : color565(p)))
+        diff++;
+    }
+  if ((utft_host.getPixel(PX-1, PY)!=0) or (utft_host.getPixel(PX+W, PY+H-1)!=0) or (utft_host.getPixel(PX, PY+H)!=0))
+    diff++;
+  printf("%-10s %-9s %10lu %10lu %10lu   %s\n", name, orient==PORTRAIT ? "portrait" : "landscape",
+    (unsigned long)data.len, utft_host.stats.bytes, utft_host.stats.windows, (ok and !diff) ? "ok" : "FAILED");
+  if (!ok or diff)
+    errors++;
+}
+
+int main()
+{
+  for (int y=0; y<H; y++)
+    for (int x=0; x<W; x++)
+    {
+      uint8_t *p = &picture[((y*W)+x)*3];
+
+      // Flat bands for the RLE packets and gradients for the literals
+      if ((y/8) % 2==0)
+      {
+        p[0] = (x/10)*30;
+        p[1] = 255-((y/8)*40);
+        p[2] = 64;
+      }
+      else
+      {
+        p[0] = x*3;
+        p[1] = y*4;
+        p[2] = (x*y) & 255;
+      }
+    }
+
+  printf("UTFT_STREAM_CHUNK %d pixels, buffer of %d bytes\n", UTFT_STREAM_CHUNK, UTFT_STREAM_CHUNK*3);
+  printf("%-10s %-9s %10s %10s %10s\n", "Format", "Mode", "Stream", "Bus bytes", "Windows");
+  for (int o=0; o<2; o++)
+  {
+    byte orient = o ? LANDSCAPE : PORTRAIT;
+
+    check("RAW565", raw565(data), BITMAP_RAW565, orient);
+    check("RLE565", rle565(data), BITMAP_RLE565, orient);
+    check("BMP 24", bmp(data, 24), BITMAP_BMP, orient);
+    check("BMP 565", bmp(data, 16), BITMAP_BMP, orient);
+    check("BMP 555", bmp(data, 15), BITMAP_BMP, orient, true);
+  }
+  utft_host.savePPM("streambitmap.ppm");
+
+  // Streams that end too early or hold an unsupported file
+  for (int i=0; i<2; i++)
+  {
+    if (i)
+      bmp(data, 32);
+    else
+      raw565(data).len -= 5;
+
+    MemoryStream stream(data);
+
+    stream.setTimeout(5);
+    myGLCD.InitLCD(PORTRAIT);
+    myGLCD.clrScr();
+    utft_host.resetStats();
+    if (myGLCD.drawBitmapStream(stream, PX, PY, W, H, i ? BITMAP_BMP : BITMAP_RAW565) or (i and utft_host.stats.bytes))
+    {
+      printf("FAILED: %s\n", i ? "32 bit BMP" : "stream ending early");
+      errors++;
+    }
+  }
+  if (utft_host.getPixel(PX+W-1, PY+H-1)!=0)
+    errors++;
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
@@ -5,3 +5,31 @@ void UTFT::_convert_float(char *buf, double num, int width, byte prec)
 	sprintf(format, "%%%i.%if", width, prec);
 	sprintf(buf, format, num);
 }
+
+// Sends pix pixels over the software serial bus, stride words apart (0
+// repeats the first pixel). RS is set once for the whole run.
+void UTFT::_fast_serial(const uint16_t *data, long pix, int stride)
+{
+	boolean	nine=(display_serial_mode==SERIAL_4PIN);
+
+	if (!nine)
+		sbi(P_RS, B_RS);
+	for (; pix>0; pix--, data+=stride)
+	{
+		word	w=*data;
+
+		for (byte k=0; k<16; k++, w<<=1)
+		{
+			if (nine and ((k & 7)==0))
+			{
+				sbi(P_SDA, B_SDA);
+				pulse_low(P_SCL, B_SCL);
+			}
+			if (w & 0x8000)
+				sbi(P_SDA, B_SDA);
+			else
+				cbi(P_SDA, B_SDA);
+			pulse_low(P_SCL, B_SCL);
+		}
+	}
+}
@@ -32,6 +32,21 @@
 
 #define fontbyte(x) cfont.font[x]  
 
+#if defined(__SAM3X8E__) || defined(__MK20DX128__) || defined(__MK20DX256__)
+	#define UTFT_HW_SPI 1
+#endif
+
+// The profiler times the primitives with the DWT cycle counter of the
+// Cortex-M3 and M4
+#if defined(UTFT_PROFILE) && (defined(__SAM3X8E__) || defined(__MK20DX128__) || defined(__MK20DX256__))
+	#define UTFT_PROFILE_CYCLES 1
+	#define UTFT_DEMCR			(*(volatile uint32_t *)0xE000EDFC)
+	#define UTFT_DEMCR_TRCENA	0x01000000
+	#define UTFT_DWT_CTRL		(*(volatile uint32_t *)0xE0001000)
+	#define UTFT_DWT_CYCCNTENA	0x00000001
+	#define UTFT_DWT_CYCCNT		(*(volatile uint32_t *)0xE0001004)
+#endif
+
 #define pgm_read_word(data) *data
 #define pgm_read_byte(data) *data
 #define bitmapdatatype unsigned short*
@@ -5,7 +5,7 @@ void UTFT::_hw_special_init()
 
 void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 {   
-	switch (mode)
+	switch (UTFT_BUS_MODE(mode))
 	{
 	case 1:
 		if (display_serial_mode==SERIAL_4PIN)
@@ -12,6 +12,17 @@
  *
 **/
 
+// Saturating add of four bytes with the Cortex-M4 DSP instruction, used
+// for dithering in pushPixels888() and pushPixelsGray8()
+#define UTFT_HAVE_UQADD8
+static inline uint32_t _utft_uqadd8(uint32_t a, uint32_t b)
+{
+	uint32_t r;
+
+	__asm__ ("uqadd8 %0, %1, %2" : "=r" (r) : "r" (a), "r" (b));
+	return r;
+}
+
 // *** Hardware specific functions ***
 void UTFT::_hw_special_init()
 {
@@ -19,9 +30,14 @@ void UTFT::_hw_special_init()
 
 void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 {
-	switch (mode)
+	switch (UTFT_BUS_MODE(mode))
 	{
 	case 1:
+		if (_hw_spi)
+		{
+			_spi_bus(VH, VL);
+			break;
+		}
 		if (display_serial_mode==SERIAL_4PIN)
 		{
 			if (VH==1)
@@ -186,3 +202,91 @@ void UTFT::_fast_fill_8(int ch, long pix)
 			pulse_low(P_WR, B_WR);pulse_low(P_WR, B_WR);
 		}
 }
+
+// *** Hardware SPI ***
+// SPI0 runs at F_BUS/2 (24MHz on a 48MHz bus). Pixel data is sent with
+// an eDMA channel when UTFT_SPI_DMA is defined. The DMA channel sends all
+// but the last byte of a buffer. The last byte is written by _dma_busy()
+// with the EOQ flag set, so the end of the transfer can be detected.
+#if defined(UTFT_SPI_DMA)
+	#include <DMAChannel.h>
+
+	static DMAChannel	_utft_dma;
+	static boolean		_utft_dma_running = false;
+	static int			_utft_dma_last = -1;
+	static boolean		_utft_dma_eoq = false;
+#endif
+
+boolean UTFT::_spi_pins(int sda, int scl)
+{
+	return (sda==MOSI) and (scl==SCK);
+}
+
+void UTFT::_spi_begin()
+{
+	SIM_SCGC6 |= SIM_SCGC6_SPI0;
+	CORE_PIN11_CONFIG = PORT_PCR_DSE | PORT_PCR_MUX(2);
+	CORE_PIN13_CONFIG = PORT_PCR_DSE | PORT_PCR_MUX(2);
+
+	SPI0_MCR = SPI_MCR_MSTR | SPI_MCR_CLR_RXF | SPI_MCR_CLR_TXF | SPI_MCR_HALT;
+	// SERIAL_4PIN modules take the D/C bit as a 9th bit in front of each byte
+	SPI0_CTAR0 = SPI_CTAR_PBR(0) | SPI_CTAR_BR(0) | 
+		((display_serial_mode==SERIAL_4PIN) ? SPI_CTAR_FMSZ(8) : SPI_CTAR_FMSZ(7));
+	SPI0_MCR = SPI_MCR_MSTR | SPI_MCR_CLR_RXF | SPI_MCR_CLR_TXF;
+
+#if defined(UTFT_SPI_DMA)
+	_utft_dma.begin();
+	_utft_dma.destination(*(volatile uint8_t *)&SPI0_PUSHR);
+	_utft_dma.disableOnCompletion();
+	_utft_dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SPI0_TX);
+	SPI0_RSER = SPI_RSER_TFFF_RE | SPI_RSER_TFFF_DIRS;
+#endif
+}
+
+void UTFT::_spi_write(char VH, char VL)
+{
+	uint32_t frame = byte(VL);
+
+	if ((display_serial_mode==SERIAL_4PIN) and (VH==1))
+		frame |= 0x100;
+	// Wait for the last bit, as CS or RS may change right after this
+	SPI0_SR = SPI_SR_EOQF;
+	SPI0_PUSHR = frame | SPI_PUSHR_CTAS(0) | SPI_PUSHR_EOQ;
+	while ((SPI0_SR & SPI_SR_EOQF) == 0) {};
+}
+
+#if defined(UTFT_SPI_DMA)
+void UTFT::_dma_start(const uint8_t *buf, int len)
+{
+	SPI0_SR = SPI_SR_EOQF;
+	_utft_dma_eoq = true;
+	_utft_dma_last = buf[len-1];
+	if (len>1)
+	{
+		_utft_dma.sourceBuffer(buf, len-1);
+		_utft_dma.enable();
+		_utft_dma_running = true;
+	}
+}
+
+boolean UTFT::_dma_busy()
+{
+	if (_utft_dma_running)
+	{
+		if (!_utft_dma.complete())
+			return true;
+		_utft_dma.clearComplete();
+		_utft_dma_running = false;
+	}
+	if (_utft_dma_last>=0)
+	{
+		if ((SPI0_SR & (15<<12)) >= (4<<12))		// TX FIFO full
+			return true;
+		SPI0_PUSHR = _utft_dma_last | SPI_PUSHR_CTAS(0) | SPI_PUSHR_EOQ;
+		_utft_dma_last = -1;
+	}
+	if (_utft_dma_eoq and (SPI0_SR & SPI_SR_EOQF))
+		_utft_dma_eoq = false;
+	return _utft_dma_eoq;
+}
+#endif
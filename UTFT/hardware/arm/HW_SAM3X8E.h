@@ -8,9 +8,14 @@ void UTFT::_hw_special_init()
 
 void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 {   
-	switch (mode)
+	switch (UTFT_BUS_MODE(mode))
 	{
 	case 1:
+		if (_hw_spi)
+		{
+			_spi_bus(VH, VL);
+			break;
+		}
 		if (display_serial_mode==SERIAL_4PIN)
 		{
 			if (VH==1)
@@ -240,3 +245,77 @@ void UTFT::_fast_fill_8(int ch, long pix)
 			pulse_low(P_WR, B_WR);pulse_low(P_WR, B_WR);
 		}
 }
+
+// *** Hardware SPI ***
+// SPI0 runs at MCK/UTFT_SPI_SCBR (84MHz/4 = 21MHz). Pixel data is sent 
+// with DMAC channel UTFT_DMA_CHANNEL when UTFT_SPI_DMA is defined.
+#if !defined(UTFT_SPI_SCBR)
+	#define UTFT_SPI_SCBR		4
+#endif
+#define UTFT_DMA_CHANNEL		2
+#define UTFT_DMA_SPI0_TX		1		// DMAC hardware interface number of SPI0 TX
+
+boolean UTFT::_spi_pins(int sda, int scl)
+{
+	return (sda==MOSI) and (scl==SCK);
+}
+
+void UTFT::_spi_begin()
+{
+	PIO_Configure(g_APinDescription[PIN_SPI_MOSI].pPort, g_APinDescription[PIN_SPI_MOSI].ulPinType,
+		g_APinDescription[PIN_SPI_MOSI].ulPin, g_APinDescription[PIN_SPI_MOSI].ulPinConfiguration);
+	PIO_Configure(g_APinDescription[PIN_SPI_SCK].pPort, g_APinDescription[PIN_SPI_SCK].ulPinType,
+		g_APinDescription[PIN_SPI_SCK].ulPin, g_APinDescription[PIN_SPI_SCK].ulPinConfiguration);
+	pmc_enable_periph_clk(ID_SPI0);
+
+	// Master mode, fixed peripheral 0, CS is a normal output pin
+	SPI0->SPI_CR = SPI_CR_SPIDIS;
+	SPI0->SPI_CR = SPI_CR_SWRST;
+	SPI0->SPI_MR = SPI_MR_MSTR | SPI_MR_MODFDIS | SPI_MR_PCS(0x0E);
+	// SERIAL_4PIN modules take the D/C bit as a 9th bit in front of each byte
+	SPI0->SPI_CSR[0] = SPI_CSR_SCBR(UTFT_SPI_SCBR) | SPI_CSR_NCPHA | 
+		((display_serial_mode==SERIAL_4PIN) ? SPI_CSR_BITS_9_BIT : SPI_CSR_BITS_8_BIT);
+	SPI0->SPI_CR = SPI_CR_SPIEN;
+
+#if defined(UTFT_SPI_DMA)
+	pmc_enable_periph_clk(ID_DMAC);
+	DMAC->DMAC_EN &= ~DMAC_EN_ENABLE;
+	DMAC->DMAC_GCFG = DMAC_GCFG_ARB_CFG_FIXED;
+	DMAC->DMAC_EN = DMAC_EN_ENABLE;
+#endif
+}
+
+void UTFT::_spi_write(char VH, char VL)
+{
+	uint32_t frame = byte(VL);
+
+	if ((display_serial_mode==SERIAL_4PIN) and (VH==1))
+		frame |= 0x100;
+	while ((SPI0->SPI_SR & SPI_SR_TDRE) == 0) {};
+	SPI0->SPI_TDR = frame;
+	// Wait for the last bit, as CS or RS may change right after this
+	while ((SPI0->SPI_SR & SPI_SR_TXEMPTY) == 0) {};
+}
+
+#if defined(UTFT_SPI_DMA)
+void UTFT::_dma_start(const uint8_t *buf, int len)
+{
+	DMAC->DMAC_CHDR = DMAC_CHDR_DIS0 << UTFT_DMA_CHANNEL;
+	DMAC->DMAC_CH_NUM[UTFT_DMA_CHANNEL].DMAC_SADDR = (uint32_t)buf;
+	DMAC->DMAC_CH_NUM[UTFT_DMA_CHANNEL].DMAC_DADDR = (uint32_t)&SPI0->SPI_TDR;
+	DMAC->DMAC_CH_NUM[UTFT_DMA_CHANNEL].DMAC_DSCR = 0;
+	DMAC->DMAC_CH_NUM[UTFT_DMA_CHANNEL].DMAC_CTRLA = len | DMAC_CTRLA_SRC_WIDTH_BYTE | DMAC_CTRLA_DST_WIDTH_BYTE;
+	DMAC->DMAC_CH_NUM[UTFT_DMA_CHANNEL].DMAC_CTRLB = DMAC_CTRLB_SRC_DSCR | DMAC_CTRLB_DST_DSCR | 
+		DMAC_CTRLB_FC_MEM2PER_DMA_FC | DMAC_CTRLB_SRC_INCR_INCREMENTING | DMAC_CTRLB_DST_INCR_FIXED;
+	DMAC->DMAC_CH_NUM[UTFT_DMA_CHANNEL].DMAC_CFG = DMAC_CFG_DST_PER(UTFT_DMA_SPI0_TX) | DMAC_CFG_DST_H2SEL | 
+		DMAC_CFG_SOD | DMAC_CFG_FIFOCFG_ALAP_CFG;
+	DMAC->DMAC_CHER = DMAC_CHER_ENA0 << UTFT_DMA_CHANNEL;
+}
+
+boolean UTFT::_dma_busy()
+{
+	if (DMAC->DMAC_CHSR & (DMAC_CHSR_ENA0 << UTFT_DMA_CHANNEL))
+		return true;
+	return (SPI0->SPI_SR & SPI_SR_TXEMPTY) == 0;
+}
+#endif
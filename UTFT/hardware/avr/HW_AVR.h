@@ -2,3 +2,76 @@ void UTFT::_convert_float(char *buf, double num, int width, byte prec)
 {
 	dtostrf(num, width, prec, buf);
 }
+
+// One bit of the software serial bus when SDA and SCL are on the same
+// port: the data with SCL low, then the same data with SCL high
+#define SERIAL_BIT(mask)	if (b & mask) { *port=h; *port=hc; } else { *port=l; *port=lc; }
+
+// Sends pix pixels over the software serial bus, stride words apart (0
+// repeats the first pixel). RS is set once for the whole run. When SDA
+// and SCL are on the same port the port values for a byte are worked out
+// once and written without reading the port for every bit. Interrupts
+// are held off for each such byte, or an interrupt changing another pin
+// of the port (Servo, tone() and the like) would be undone by the stores.
+void UTFT::_fast_serial(const uint16_t *data, long pix, int stride)
+{
+	regtype	*port=P_SDA, *clk=P_SCL;
+	regsize	sda=B_SDA, scl=B_SCL;
+	boolean	nine=(display_serial_mode==SERIAL_4PIN);
+
+	if (!nine)
+		sbi(P_RS, B_RS);
+	for (; pix>0; pix--, data+=stride)
+	{
+		word	w=*data;
+
+		for (byte k=0; k<2; k++, w<<=8)
+		{
+			byte	b=w>>8;
+
+			if (port==clk)
+			{
+				byte	sreg=SREG, l, h, lc, hc;
+
+				cli();
+				l=*port & ~(sda | scl);
+				h=l | sda;
+				lc=l | scl;
+				hc=h | scl;
+
+				if (nine)
+				{
+					*port=h;
+					*port=hc;
+				}
+				SERIAL_BIT(0x80);
+				SERIAL_BIT(0x40);
+				SERIAL_BIT(0x20);
+				SERIAL_BIT(0x10);
+				SERIAL_BIT(0x08);
+				SERIAL_BIT(0x04);
+				SERIAL_BIT(0x02);
+				SERIAL_BIT(0x01);
+				SREG=sreg;
+			}
+			else
+			{
+				if (nine)
+				{
+					*port|=sda;
+					*clk&=~scl;
+					*clk|=scl;
+				}
+				for (byte mask=0x80; mask>0; mask>>=1)
+				{
+					if (b & mask)
+						*port|=sda;
+					else
+						*port&=~sda;
+					*clk&=~scl;
+					*clk|=scl;
+				}
+			}
+		}
+	}
+}
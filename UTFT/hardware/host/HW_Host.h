@@ -0,0 +1,527 @@
+#include <time.h>
+
+// *** Arduino core replacements ***
+static regtype _host_ports[256];
+
+regtype *portOutputRegister(int port)
+{
+	return &_host_ports[port & 0xFF];
+}
+
+void pinMode(int, int)
+{
+}
+
+void digitalWrite(int pin, int value)
+{
+	if (value)
+		_host_ports[pin & 0xFF] |= 1;
+	else
+		_host_ports[pin & 0xFF] &= ~1;
+}
+
+int digitalRead(int pin)
+{
+	if (pin==TE_PIN)
+		return utft_host.teRead() ? HIGH : LOW;
+	return _host_ports[pin & 0xFF] & 1;
+}
+
+void delay(unsigned long ms)
+{
+	utft_host.stats.delay_ms += ms;
+}
+
+void delayMicroseconds(unsigned int)
+{
+}
+
+unsigned long micros()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000UL) + (ts.tv_nsec / 1000);
+}
+
+unsigned long millis()
+{
+	return micros() / 1000;
+}
+
+size_t Print::print(const char *s)
+{
+	size_t	n=0;
+
+	while (*s)
+		n+=write(*s++);
+	return n;
+}
+
+size_t Print::print(unsigned long n)
+{
+	char	buf[21];
+
+	snprintf(buf, sizeof(buf), "%lu", n);
+	return print(buf);
+}
+
+// Waits up to the timeout for every byte, like the Arduino core
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+	size_t			count=0;
+	unsigned long	start;
+	int				c;
+
+	while (count<length)
+	{
+		start=millis();
+		while (((c=read())<0) and (millis()-start<_timeout))
+			;
+		if (c<0)
+			break;
+		buffer[count++]=c;
+	}
+	return count;
+}
+
+// *** Emulated display controller ***
+UTFT_Host utft_host;
+
+void UTFT_Host::attach(UTFT *display)
+{
+	lcd = display;
+	cs_reg = display->P_CS;
+	cs_mask = display->B_CS;
+	*cs_reg |= cs_mask;
+
+	switch (display->display_model)
+	{
+	case ILI9341_S5P:
+	case ILI9341_S4P:
+	case ILI9481:
+	case ILI9486:
+	case R61581:
+	case ST7735:
+	case ST7735_ALT:
+	case ST7735S:
+	case HX8353C:
+		emulated = true;
+		swap_xy = false;
+		break;
+	case SSD1963_480:
+	case SSD1963_800:
+	case SSD1963_800ALT:
+		emulated = true;
+		swap_xy = true;
+		break;
+	default:
+		emulated = false;
+		swap_xy = false;
+		break;
+	}
+	cpld = (display->display_model==CPLD);
+	if (cpld)
+		emulated = true;
+	pages = cpld ? 8 : 1;
+	page_show = 0;
+	page_write = 0;
+
+	if (swap_xy)
+	{
+		gram_w = display->disp_y_size+1;
+		gram_h = display->disp_x_size+1;
+	}
+	else
+	{
+		gram_w = display->disp_x_size+1;
+		gram_h = display->disp_y_size+1;
+	}
+	free(gram);
+	gram = (word *)calloc(long(gram_w) * gram_h * pages, sizeof(word));
+
+	cmd = 0;
+	dma_len = 0;
+	dma_pos = 0;
+	argc = 0;
+	madctl = 0;
+	pixel_phase = false;
+	have_half = false;
+	col1 = col = 0;
+	row1 = row = 0;
+	col2 = gram_w-1;
+	row2 = gram_h-1;
+	scroll_top = 0;
+	scroll_len = 0;
+	scroll_start = 0;
+}
+
+void UTFT_Host::resetStats()
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+word UTFT_Host::getGRAM(int c, int r)
+{
+	if ((gram==0) or (c<0) or (r<0) or (c>=gram_w) or (r>=gram_h))
+		return 0;
+	return gram[(long(page_show)*gram_w*gram_h)+(long(r)*gram_w)+c];
+}
+
+boolean UTFT_Host::teRead()
+{
+	stats.te_reads++;
+	te_clock++;
+	return (te_clock % UTFT_HOST_TE_PERIOD)<(UTFT_HOST_TE_PERIOD/8);
+}
+
+// GRAM row shown on panel line row
+int UTFT_Host::visibleRow(int r)
+{
+	if ((scroll_len==0) or (r<scroll_top) or (r>=scroll_top+scroll_len))
+		return r;
+	return scroll_top + ((r-scroll_top+scroll_start-scroll_top+scroll_len) % scroll_len);
+}
+
+word UTFT_Host::getPixel(int x, int y)
+{
+	int px, py;
+
+	if (lcd->orient==LANDSCAPE)
+	{
+		px = y;
+		py = lcd->disp_y_size-x;
+	}
+	else
+	{
+		px = x;
+		py = y;
+	}
+	if (swap_xy)
+		return getGRAM(py, visibleRow(px));
+	else
+		return getGRAM(px, visibleRow(py));
+}
+
+boolean UTFT_Host::savePPM(const char *filename)
+{
+	FILE *f = fopen(filename, "wb");
+
+	if (f==0)
+		return false;
+	fprintf(f, "P6\n%d %d\n255\n", gram_w, gram_h);
+	for (int r=0; r<gram_h; r++)
+		for (int c=0; c<gram_w; c++)
+		{
+			word	pix = getGRAM(c, visibleRow(r));
+
+			fputc(((pix>>11) & 0x1F)<<3, f);
+			fputc(((pix>>5) & 0x3F)<<2, f);
+			fputc((pix & 0x1F)<<3, f);
+		}
+	fclose(f);
+	return true;
+}
+
+void UTFT_Host::_store(word color)
+{
+	if ((col<gram_w) and (row<gram_h))
+	{
+		word *p = &gram[(long(page_write)*gram_w*gram_h)+(long(row)*gram_w)+col];
+
+		if (*p==color)
+			stats.redundant_pixels++;
+		*p = color;
+	}
+	stats.pixels++;
+	if ((pages>1) and (page_write==page_show))
+		stats.shown_pixels++;
+
+	// Column/page exchange (MADCTL bit 5) makes the page address increment first
+	if (madctl & 0x20)
+	{
+		if (++row>row2)
+		{
+			row = row1;
+			if (++col>col2)
+				col = col1;
+		}
+	}
+	else
+	{
+		if (++col>col2)
+		{
+			col = col1;
+			if (++row>row2)
+				row = row1;
+		}
+	}
+}
+
+void UTFT_Host::busWrite(boolean dc, word value, boolean wide)
+{
+	if (wide)
+		stats.bytes+=2;
+	else
+		stats.bytes++;
+
+	if (!dc)
+	{
+		stats.com++;
+		cmd = value & 0xFF;
+		argc = 0;
+		have_half = false;
+		pixel_phase = false;
+		if (cpld)
+		{
+			// Registers are latched by 0x0F, which also starts a memory write
+			if (cmd==0x0F)
+			{
+				stats.windows++;
+				col = col1;
+				row = row1;
+				pixel_phase = true;
+			}
+			return;
+		}
+		if (emulated and ((cmd==0x2C) or (cmd==0x3C)))
+		{
+			if (cmd==0x2C)
+			{
+				stats.windows++;
+				col = col1;
+				row = row1;
+			}
+			pixel_phase = true;
+		}
+		return;
+	}
+
+	stats.data++;
+	if (!emulated)
+		return;
+
+	if (pixel_phase)
+	{
+		if (wide)
+			_store(value);
+		else if (have_half)
+		{
+			_store((half<<8) | (value & 0xFF));
+			have_half = false;
+		}
+		else
+		{
+			half = value;
+			have_half = true;
+		}
+		return;
+	}
+
+	if (cpld)
+	{
+		switch (cmd)
+		{
+		case 0x02:
+			row1 = value;
+			break;
+		case 0x03:
+			col1 = value;
+			break;
+		case 0x04:
+			if ((value & 7)!=page_show)
+			{
+				stats.flips++;
+				if ((te_clock % UTFT_HOST_TE_PERIOD)>=(UTFT_HOST_TE_PERIOD/8))
+					stats.torn_flips++;
+			}
+			page_show = value & 7;
+			break;
+		case 0x05:
+			page_write = value & 7;
+			break;
+		case 0x06:
+			row2 = value;
+			break;
+		case 0x07:
+			col2 = value;
+			break;
+		}
+		return;
+	}
+
+	if (argc<6)
+		args[argc] = value & 0xFF;
+	argc++;
+	switch (cmd)
+	{
+	case 0x2A:
+		if (argc==4)
+		{
+			col1 = (args[0]<<8) | args[1];
+			col2 = (args[2]<<8) | args[3];
+		}
+		break;
+	case 0x2B:
+		if (argc==4)
+		{
+			row1 = (args[0]<<8) | args[1];
+			row2 = (args[2]<<8) | args[3];
+		}
+		break;
+	case 0x33:
+		if (argc==6)
+		{
+			scroll_top = (args[0]<<8) | args[1];
+			scroll_len = (args[2]<<8) | args[3];
+			scroll_start = scroll_top;
+		}
+		break;
+	case 0x36:
+		if (argc==1)
+			madctl = args[0];
+		break;
+	case 0x37:
+		if (argc==2)
+			scroll_start = (args[0]<<8) | args[1];
+		break;
+	}
+}
+
+// Emulated SPI port and DMA channel. The DMA channel sends the live buffer
+// so that writes by the CPU to a buffer in flight show up in the GRAM, and
+// are also counted as conflicts.
+void UTFT_Host::spiWrite(boolean dc, byte value)
+{
+	if (dma_pos<dma_len)
+		stats.dma_conflicts++;
+	busWrite(dc, value, false);
+}
+
+void UTFT_Host::dmaStart(const uint8_t *buf, int len)
+{
+	if (dma_pos<dma_len)
+		stats.dma_conflicts++;
+	dma_src = buf;
+	dma_len = len;
+	dma_pos = 0;
+	memcpy(dma_copy, buf, len);
+	stats.dma_transfers++;
+}
+
+boolean UTFT_Host::dmaBusy()
+{
+	if (dma_pos>=dma_len)
+		return false;
+	stats.dma_polls++;
+	for (int i=0; (i<UTFT_HOST_DMA_RATE) and (dma_pos<dma_len); i++, dma_pos++)
+	{
+		if (dma_src[dma_pos]!=dma_copy[dma_pos])
+			stats.dma_conflicts++;
+		stats.dma_bytes++;
+		busWrite(true, dma_src[dma_pos], false);
+	}
+	return true;
+}
+
+// *** Hardwarespecific functions ***
+void UTFT::_hw_special_init()
+{
+	utft_host.attach(this);
+}
+
+void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
+{   
+	switch (UTFT_BUS_MODE(mode))
+	{
+	case 1:
+		if (_hw_spi)
+		{
+			_spi_bus(VH, VL);
+			break;
+		}
+		utft_host.stats.cycles+=UTFT_HOST_SERIAL_CYCLES;
+		utft_host.busWrite(VH==1, byte(VL), false);
+		break;
+	case 8:
+	case 16:
+	case LATCHED_16:
+		utft_host.busWrite((*P_RS & B_RS)!=0, (byte(VH)<<8) | byte(VL), true);
+		break;
+	}
+}
+
+void UTFT::_set_direction_registers(byte)
+{
+}
+
+void UTFT::_fast_fill_16(int ch, int cl, long pix)
+{
+	long blocks;
+
+	// Same number of WR pulses as the hardware drivers
+	blocks = pix/16;
+	for (long i=0; i<blocks*16; i++)
+		utft_host.busWrite((*P_RS & B_RS)!=0, (byte(ch)<<8) | byte(cl), true);
+	if ((pix % 16) != 0)
+		for (int i=0; i<(pix % 16)+1; i++)
+			utft_host.busWrite((*P_RS & B_RS)!=0, (byte(ch)<<8) | byte(cl), true);
+}
+
+void UTFT::_fast_fill_8(int ch, long pix)
+{
+	long blocks;
+
+	blocks = pix/16;
+	for (long i=0; i<blocks*16; i++)
+		utft_host.busWrite((*P_RS & B_RS)!=0, (byte(ch)<<8) | byte(ch), true);
+	if ((pix % 16) != 0)
+		for (int i=0; i<(pix % 16)+1; i++)
+			utft_host.busWrite((*P_RS & B_RS)!=0, (byte(ch)<<8) | byte(ch), true);
+}
+
+void UTFT::_fast_serial(const uint16_t *data, long pix, int stride)
+{
+	if (display_serial_mode!=SERIAL_4PIN)
+		sbi(P_RS, B_RS);
+	for (; pix>0; pix--, data+=stride)
+	{
+		utft_host.stats.cycles+=2*UTFT_HOST_FAST_SERIAL_CYCLES;
+		utft_host.busWrite(true, *data>>8, false);
+		utft_host.busWrite(true, *data & 0xFF, false);
+	}
+}
+
+void UTFT::_convert_float(char *buf, double num, int width, byte prec)
+{
+	char format[32];
+	
+	snprintf(format, sizeof(format), "%%%i.%if", width, prec);
+	sprintf(buf, format, num);
+}
+
+boolean UTFT::_spi_pins(int sda, int scl)
+{
+	return (sda==MOSI) and (scl==SCK);
+}
+
+void UTFT::_spi_begin()
+{
+}
+
+void UTFT::_spi_write(char VH, char VL)
+{
+	utft_host.spiWrite(VH==1, byte(VL));
+}
+
+#if defined(UTFT_SPI_DMA)
+void UTFT::_dma_start(const uint8_t *buf, int len)
+{
+	utft_host.dmaStart(buf, len);
+}
+
+boolean UTFT::_dma_busy()
+{
+	return utft_host.dmaBusy();
+}
+#endif
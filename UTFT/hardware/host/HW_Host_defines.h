@@ -0,0 +1,228 @@
+// Host (Linux/PC) emulation
+// -------------------------
+// Define UTFT_HOST when compiling the library on a PC to run it against an
+// emulated display controller instead of real hardware. The emulator keeps
+// the controller GRAM in an RGB565 framebuffer and counts every command, 
+// data transfer and CS assertion so drawing cost can be measured and 
+// regression tested without a display.
+//
+// Example:
+//   g++ -DUTFT_HOST -Wno-write-strings -I<path to UTFT> mysketch.cpp UTFT.cpp DefaultFonts.c
+//
+// The address window and GRAM auto-increment is emulated for controllers 
+// using the standard 0x2A/0x2B/0x2C commands (ILI9341, ILI9481, ILI9486, 
+// R61581, SSD1963, ST7735, ST7735S and HX8353C). All other controllers are
+// only counted. Vertical scrolling (0x33/0x37) is applied by getPixel() 
+// and savePPM(), which return what the panel shows. getGRAM() returns the 
+// memory contents.
+//
+// CPLD modules are emulated with 8 pages of display memory. getPixel(), 
+// getGRAM() and savePPM() return the page that is shown. The tearing 
+// effect output of the controller can be read on TE_PIN; it is high for 
+// the first 1/8 of every UTFT_HOST_TE_PERIOD reads.
+//
+// Serial modules created with the MOSI and SCK pins use the emulated 
+// hardware SPI port. Compile with -DUTFT_SPI_DMA to also emulate a DMA 
+// channel that sends UTFT_HOST_DMA_RATE bytes each time it is polled.
+//********************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+// *** Arduino core replacements ***
+typedef uint8_t		byte;
+typedef uint16_t	word;
+typedef bool		boolean;
+
+#define LOW		0
+#define HIGH	1
+#define INPUT	0
+#define OUTPUT	1
+
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+#define PROGMEM
+#define pgm_read_word(data) *data
+#define pgm_read_byte(data) *data
+
+#define digitalPinToPort(pin) (pin)
+#define digitalPinToBitMask(pin) 1
+
+void			pinMode(int pin, int mode);
+void			digitalWrite(int pin, int value);
+int				digitalRead(int pin);
+void			delay(unsigned long ms);
+void			delayMicroseconds(unsigned int us);
+unsigned long	millis();
+unsigned long	micros();
+
+class String
+{
+	public:
+		String(const char *st="") : _s(st) {}
+		unsigned int length() const { return _s.length(); }
+		void toCharArray(char *buf, unsigned int bufsize) const { strncpy(buf, _s.c_str(), bufsize); buf[bufsize-1]=0; }
+
+	private:
+		std::string _s;
+};
+
+// Only what printProfile() needs of the Arduino Print class
+class Print
+{
+	public:
+		virtual size_t write(uint8_t c) = 0;
+		size_t print(const char *s);
+		size_t print(char c) { return write(c); }
+		size_t print(unsigned long n);
+		size_t println(const char *s) { return print(s)+write('\n'); }
+		size_t println(unsigned long n) { return print(n)+write('\n'); }
+};
+
+// Only the reading side of the Arduino Stream class
+class Stream
+{
+	public:
+		virtual int available() = 0;
+		virtual int read() = 0;
+		virtual int peek() = 0;
+		void setTimeout(unsigned long timeout) { _timeout=timeout; }
+		size_t readBytes(char *buffer, size_t length);
+		size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+
+	protected:
+		Stream() : _timeout(1000) {}
+		unsigned long _timeout;
+};
+
+// *** Hardwarespecific defines ***
+#define regtype volatile uint32_t
+#define regsize uint32_t
+
+#define cbi(reg, bitmask) _host_write_pin(reg, bitmask, false)
+#define sbi(reg, bitmask) _host_write_pin(reg, bitmask, true)
+#define pulse_high(reg, bitmask) sbi(reg, bitmask); cbi(reg, bitmask);
+#define pulse_low(reg, bitmask) cbi(reg, bitmask); sbi(reg, bitmask);
+
+#define cport(port, data) port &= data
+#define sport(port, data) port |= data
+
+#define swap(type, i, j) {type t = i; i = j; j = t;}
+
+#define fontbyte(x) cfont.font[x]  
+
+#define bitmapdatatype unsigned short*
+
+regtype *portOutputRegister(int port);
+
+// *** Emulated hardware SPI ***
+#define UTFT_HW_SPI		1
+#define MOSI			75
+#define SCK				76
+#if !defined(UTFT_HOST_DMA_RATE)
+	#define UTFT_HOST_DMA_RATE	4
+#endif
+
+// *** Emulated tearing effect output ***
+#define TE_PIN			77
+#if !defined(UTFT_HOST_TE_PERIOD)
+	#define UTFT_HOST_TE_PERIOD	64
+#endif
+
+// *** Cycle model of the software serial bus ***
+// Estimated cycles of a 16 MHz AVR for every byte sent over the software
+// serial bus, one byte at a time through LCD_Writ_Bus() and in a run of
+// pixels through _fast_serial() with SDA and SCL on the same port. They
+// are worked out from the instructions of the loops, not measured.
+#if !defined(UTFT_HOST_SERIAL_CYCLES)
+	#define UTFT_HOST_SERIAL_CYCLES			250
+#endif
+#if !defined(UTFT_HOST_FAST_SERIAL_CYCLES)
+	#define UTFT_HOST_FAST_SERIAL_CYCLES	70
+#endif
+#define UTFT_HOST_CPU_HZ	16000000UL
+
+// *** Emulated display controller ***
+class UTFT;
+
+struct UTFT_HostStats
+{
+	unsigned long	com;			// Command transfers
+	unsigned long	data;			// Data transfers, including pixel data
+	unsigned long	bytes;			// Bytes sent over the bus
+	unsigned long	cs_toggles;		// Number of times CS was asserted
+	unsigned long	windows;		// Memory write commands (0x2C)
+	unsigned long	pixels;			// Pixels stored in GRAM
+	unsigned long	delay_ms;		// Time requested through delay()
+	unsigned long	dma_transfers;	// DMA transfers started
+	unsigned long	dma_bytes;		// Bytes sent by DMA
+	unsigned long	dma_polls;		// Polls of a busy DMA channel
+	unsigned long	dma_conflicts;	// Bus or buffer writes while DMA was busy
+	unsigned long	te_reads;		// Reads of the TE output
+	unsigned long	flips;			// Changes of the page that is shown
+	unsigned long	torn_flips;		// Page changes while the panel was refreshed
+	unsigned long	shown_pixels;	// Pixels stored in the page that is shown
+	unsigned long	redundant_pixels;	// Pixels stored with the value they had
+	unsigned long	cycles;			// Estimated AVR cycles on the software serial bus
+};
+
+class UTFT_Host
+{
+	public:
+		UTFT_HostStats	stats;
+		word			*gram;
+		int				gram_w, gram_h;
+		boolean			emulated;
+
+		void			resetStats();
+		word			getPixel(int x, int y);
+		word			getGRAM(int col, int row);
+		int				visibleRow(int row);
+		boolean			savePPM(const char *filename);
+
+/*
+	The functions and variables below are used by the host hardware
+	driver and should not normally be used.
+*/
+		UTFT			*lcd;
+		regtype			*cs_reg;
+		regsize			cs_mask;
+		boolean			swap_xy, pixel_phase, have_half;
+		byte			cmd, argc, args[6], madctl, half;
+		word			col1, col2, row1, row2, col, row;
+		word			scroll_top, scroll_len, scroll_start;
+		boolean			cpld;
+		byte			pages, page_show, page_write;
+		unsigned long	te_clock;
+
+		void			attach(UTFT *display);
+		boolean			teRead();
+		void			busWrite(boolean dc, word value, boolean wide);
+		void			_store(word color);
+
+		const uint8_t	*dma_src;
+		uint8_t			dma_copy[UTFT_DMA_BUFFER];
+		int				dma_len, dma_pos;
+
+		void			dmaStart(const uint8_t *buf, int len);
+		boolean			dmaBusy();
+		void			spiWrite(boolean dc, byte value);
+};
+
+extern UTFT_Host utft_host;
+
+inline void _host_write_pin(regtype *reg, regsize bitmask, bool level)
+{
+	if ((reg==utft_host.cs_reg) and (bitmask==utft_host.cs_mask) and (!level) and ((*reg & bitmask)!=0))
+		utft_host.stats.cs_toggles++;
+	if (level)
+		*reg |= bitmask;
+	else
+		*reg &= ~bitmask;
+}
@@ -11,6 +11,9 @@
 // Uncomment the lines for the displaycontrollers that you don't use to save
 // some flash memory by not including the init code for that particular
 // controller.
+//
+// This file is not used when UTFT_MODEL is defined in UTFT.h, as only the
+// controller for that model is included then.
 
 #define DISABLE_CPLD		 		1	// EHOUSE50CPLD
 
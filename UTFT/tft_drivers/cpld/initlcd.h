@@ -4,7 +4,15 @@ case CPLD:
 	else
 		orient = LANDSCAPE;
 
-	LCD_Write_COM(0x0F);   
-	LCD_Write_COM_DATA(0x01,0x0010);
-	LCD_Write_COM(0x0F);   
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(0), 0x0F,
+			INIT_REG(1),
+				0x01, INIT_WORD(0x0010),
+			INIT_CMD(0), 0x0F,
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
@@ -1,69 +1,24 @@
 case HX8353C:
-	LCD_Write_COM(0xB9);//SETEXTC
-		LCD_Write_DATA(0xFF);
-		LCD_Write_DATA(0x83);
-		LCD_Write_DATA(0x53);
-
-		LCD_Write_COM(0xB0);//RADJ
-		LCD_Write_DATA(0x3C);
-		LCD_Write_DATA(0x01);
-
-		LCD_Write_COM(0xB6);//VCOM
-		LCD_Write_DATA(0x94);
-		LCD_Write_DATA(0x6C);
-		LCD_Write_DATA(0x50);   
-
-		LCD_Write_COM(0xB1);//PWR
-		LCD_Write_DATA(0x00);
-		LCD_Write_DATA(0x01);
-		LCD_Write_DATA(0x1B);
-		LCD_Write_DATA(0x03);
-		LCD_Write_DATA(0x01);
-		LCD_Write_DATA(0x08);
-		LCD_Write_DATA(0x77);
-		LCD_Write_DATA(0x89);
-
-		LCD_Write_COM(0xE0); //Gamma setting for tpo Panel
-		LCD_Write_DATA(0x50);
-		LCD_Write_DATA(0x77);
-		LCD_Write_DATA(0x40);
-		LCD_Write_DATA(0x08);
-		LCD_Write_DATA(0xBF);
-		LCD_Write_DATA(0x00);
-		LCD_Write_DATA(0x03);
-		LCD_Write_DATA(0x0F);
-		LCD_Write_DATA(0x00);
-		LCD_Write_DATA(0x01);
-		LCD_Write_DATA(0x73);
-		LCD_Write_DATA(0x00);
-		LCD_Write_DATA(0x72);
-		LCD_Write_DATA(0x03);
-		LCD_Write_DATA(0xB0);
-		LCD_Write_DATA(0x0F);
-		LCD_Write_DATA(0x08);
-		LCD_Write_DATA(0x00);
-		LCD_Write_DATA(0x0F);
-
-		LCD_Write_COM(0x3A);   
-		LCD_Write_DATA(0x05);  //05 
-		LCD_Write_COM(0x36);    
-		LCD_Write_DATA(0xC0); //83  //0B 
-
-		LCD_Write_COM(0x11); // SLPOUT  
-		delay(150);
-
-		LCD_Write_COM(0x29);    // display on
-
-		delay(150);
-		LCD_Write_COM(0x2D);  //Look up table
-
-		for(int j=0;j<32;j++)
-		{ LCD_Write_DATA(2*j); } //Red
-		for(int j=0;j<64;j++)
-		{ LCD_Write_DATA(1*j); } //Green
-		for(int j=0;j<32;j++)
-		{ LCD_Write_DATA(2*j); } //Blue 
-
-		LCD_Write_COM(0x2c);  
-		delay(150);	 
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(3), 0xB9, 0xFF, 0x83, 0x53,		// SETEXTC
+			INIT_CMD(2), 0xB0, 0x3C, 0x01,				// RADJ
+			INIT_CMD(3), 0xB6, 0x94, 0x6C, 0x50,		// VCOM
+			INIT_CMD(8), 0xB1, 0x00, 0x01, 0x1B, 0x03, 0x01, 0x08, 0x77, 0x89,	// PWR
+			INIT_CMD(19), 0xE0, 0x50, 0x77, 0x40, 0x08, 0xBF, 0x00, 0x03, 0x0F, 0x00, 0x01, 0x73, 0x00, 0x72, 0x03, 0xB0, 0x0F, 0x08, 0x00, 0x0F,	// Gamma setting for tpo Panel
+			INIT_CMD(1), 0x3A, 0x05,					// 05
+			INIT_CMD(1), 0x36, 0xC0,					// 83  //0B
+			INIT_CMD(0), 0x11,							// SLPOUT
+			INIT_DELAY(120),
+			INIT_CMD(0), 0x29,							// display on
+			INIT_CMD(0), 0x2D,							// Look up table
+			INIT_RAMP(32, 0, 2),						// Red
+			INIT_RAMP(64, 0, 1),						// Green
+			INIT_RAMP(32, 0, 2),						// Blue
+			INIT_CMD(0), 0x2C,
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
@@ -1,9 +1,15 @@
 case ILI9325D_16ALT:
 	LCD_Write_COM_DATA(0x20,x1);
 	LCD_Write_COM_DATA(0x21,y1);
-	LCD_Write_COM_DATA(0x50,x1);
-	LCD_Write_COM_DATA(0x52,y1);
-	LCD_Write_COM_DATA(0x51,x2);
-	LCD_Write_COM_DATA(0x53,y2);
+	if (cols)
+	{
+		LCD_Write_COM_DATA(0x50,x1);
+		LCD_Write_COM_DATA(0x51,x2);
+	}
+	if (rows)
+	{
+		LCD_Write_COM_DATA(0x52,y1);
+		LCD_Write_COM_DATA(0x53,y2);
+	}
 	LCD_Write_COM(0x22); 
 	break;
@@ -1,63 +1,25 @@
 case ILI9327:
-	LCD_Write_COM(0xE9);
-	LCD_Write_DATA(0x00,0x20);
-	LCD_Write_COM(0x11); //Exit Sleep
-	delay(100);
-	LCD_Write_COM(0xD1);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x71);
-	LCD_Write_DATA(0x00,0x19);
-	LCD_Write_COM(0xD0);
-	LCD_Write_DATA(0x00,0x07);
-	LCD_Write_DATA(0x00,0x01);
-	LCD_Write_DATA(0x00,0x08);
-	LCD_Write_COM(0x36);
-	LCD_Write_DATA(0x00,0x48);
-	LCD_Write_COM(0x3A);
-	LCD_Write_DATA(0x00,0x05);
-	LCD_Write_COM(0xC1);
-	LCD_Write_DATA(0x00,0x10);
-	LCD_Write_DATA(0x00,0x10);
-	LCD_Write_DATA(0x00,0x02);
-	LCD_Write_DATA(0x00,0x02);
-	LCD_Write_COM(0xC0); //Set Default Gamma
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x35);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x01);
-	LCD_Write_DATA(0x00,0x02);
-	LCD_Write_COM(0xC5); //Set frame rate
-	LCD_Write_DATA(0x00,0x04);
-	LCD_Write_COM(0xD2); //power setting
-	LCD_Write_DATA(0x00,0x01);
-	LCD_Write_DATA(0x00,0x44);
-	LCD_Write_COM(0xC8); //Set Gamma
-	LCD_Write_DATA(0x00,0x04);
-	LCD_Write_DATA(0x00,0x67);
-	LCD_Write_DATA(0x00,0x35);
-	LCD_Write_DATA(0x00,0x04);
-	LCD_Write_DATA(0x00,0x08);
-	LCD_Write_DATA(0x00,0x06);
-	LCD_Write_DATA(0x00,0x24);
-	LCD_Write_DATA(0x00,0x01);
-	LCD_Write_DATA(0x00,0x37);
-	LCD_Write_DATA(0x00,0x40);
-	LCD_Write_DATA(0x00,0x03);
-	LCD_Write_DATA(0x00,0x10);
-	LCD_Write_DATA(0x00,0x08);
-	LCD_Write_DATA(0x00,0x80);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_COM(0x2A); 
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0xeF);
-	LCD_Write_COM(0x2B); 
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x00);
-	LCD_Write_DATA(0x00,0x01);
-	LCD_Write_DATA(0x00,0x8F);
-	LCD_Write_COM(0x29); //display on      
-	LCD_Write_COM(0x2C); //display on
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD16(1), 0xE9, INIT_WORD(0x0020),
+			INIT_CMD(0), 0x11,							// Exit Sleep
+			INIT_DELAY(100),
+			INIT_CMD16(3), 0xD1, INIT_WORD(0x0000), INIT_WORD(0x0071), INIT_WORD(0x0019),
+			INIT_CMD16(3), 0xD0, INIT_WORD(0x0007), INIT_WORD(0x0001), INIT_WORD(0x0008),
+			INIT_CMD16(1), 0x36, INIT_WORD(0x0048),
+			INIT_CMD16(1), 0x3A, INIT_WORD(0x0005),
+			INIT_CMD16(4), 0xC1, INIT_WORD(0x0010), INIT_WORD(0x0010), INIT_WORD(0x0002), INIT_WORD(0x0002),
+			INIT_CMD16(6), 0xC0, INIT_WORD(0x0000), INIT_WORD(0x0035), INIT_WORD(0x0000), INIT_WORD(0x0000), INIT_WORD(0x0001), INIT_WORD(0x0002),	// Set Default Gamma
+			INIT_CMD16(1), 0xC5, INIT_WORD(0x0004),		// Set frame rate
+			INIT_CMD16(2), 0xD2, INIT_WORD(0x0001), INIT_WORD(0x0044),	// power setting
+			INIT_CMD16(15), 0xC8, INIT_WORD(0x0004), INIT_WORD(0x0067), INIT_WORD(0x0035), INIT_WORD(0x0004), INIT_WORD(0x0008), INIT_WORD(0x0006), INIT_WORD(0x0024), INIT_WORD(0x0001), INIT_WORD(0x0037), INIT_WORD(0x0040), INIT_WORD(0x0003), INIT_WORD(0x0010), INIT_WORD(0x0008), INIT_WORD(0x0080), INIT_WORD(0x0000),	// Set Gamma
+			INIT_CMD16(4), 0x2A, INIT_WORD(0x0000), INIT_WORD(0x0000), INIT_WORD(0x0000), INIT_WORD(0x00EF),
+			INIT_CMD16(4), 0x2B, INIT_WORD(0x0000), INIT_WORD(0x0000), INIT_WORD(0x0001), INIT_WORD(0x008F),
+			INIT_CMD(0), 0x29,							// display on
+			INIT_CMD(0), 0x2C,							// display on
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
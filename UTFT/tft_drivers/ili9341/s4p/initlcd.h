@@ -1,58 +1,34 @@
 case ILI9341_S4P:
-	LCD_Write_COM(0x11);//sleep out 
-	delay(20);
-  //LCD_Write_COM(0x01); //reset
-  //delay(15);
-  LCD_Write_COM(0x28); //display off
-  delay(5);
-  LCD_Write_COM(0xCF); //power control b
-  LCD_Write_DATA(0x00);
-  LCD_Write_DATA(0x83); //83 81 AA
-  LCD_Write_DATA(0x30);
-  LCD_Write_COM(0xED); //power on seq control
-  LCD_Write_DATA(0x64); //64 67
-  LCD_Write_DATA(0x03);
-  LCD_Write_DATA(0x12);
-  LCD_Write_DATA(0x81);
-  LCD_Write_COM(0xE8); //timing control a
-  LCD_Write_DATA(0x85);
-  LCD_Write_DATA(0x01);
-  LCD_Write_DATA(0x79); //79 78
-  LCD_Write_COM(0xCB); //power control a
-  LCD_Write_DATA(0x39);
-  LCD_Write_DATA(0X2C);
-  LCD_Write_DATA(0x00);
-  LCD_Write_DATA(0x34);
-  LCD_Write_DATA(0x02);
-  LCD_Write_COM(0xF7); //pump ratio control
-  LCD_Write_DATA(0x20);
-  LCD_Write_COM(0xEA); //timing control b
-  LCD_Write_DATA(0x00);
-  LCD_Write_DATA(0x00);
-  LCD_Write_COM(0xC0); //power control 2
-  LCD_Write_DATA(0x26); //26 25
-  LCD_Write_COM(0xC1); //power control 2
-  LCD_Write_DATA(0x11);
-  LCD_Write_COM(0xC5); //vcom control 1
-  LCD_Write_DATA(0x35);
-  LCD_Write_DATA(0x3E);
-  LCD_Write_COM(0xC7); //vcom control 2
-  LCD_Write_DATA(0xBE); //BE 94
-  LCD_Write_COM(0xB1); //frame control
-  LCD_Write_DATA(0x00);
-  LCD_Write_DATA(0x1B); //1B 70
-  LCD_Write_COM(0xB6); //display control
-  LCD_Write_DATA(0x0A);
-  LCD_Write_DATA(0x82);
-  LCD_Write_DATA(0x27);
-  LCD_Write_DATA(0x00);
-  LCD_Write_COM(0xB7); //emtry mode
-  LCD_Write_DATA(0x07);
-  LCD_Write_COM(0x3A); //pixel format
-  LCD_Write_DATA(0x55); //16bit
-  LCD_Write_COM(0x36); //mem access
-  LCD_Write_DATA((1<<3)|(1<<6));
-  //LCD_Write_DATA((1<<3)|(1<<7)); //rotate 180
-  LCD_Write_COM(0x29); //display on
-  delay(5);
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(0), 0x11,							// sleep out
+			INIT_DELAY(5),
+			INIT_CMD(0), 0x28,							// display off
+			INIT_DELAY(5),
+			INIT_CMD(3), 0xCF,							// power control b
+				0x00, 0x83,								// 83 81 AA
+				0x30,
+			INIT_CMD(4), 0xED,							// power on seq control
+				0x64,									// 64 67
+				0x03, 0x12, 0x81,
+			INIT_CMD(3), 0xE8, 0x85, 0x01, 0x79,		// timing control a; 79 78
+			INIT_CMD(5), 0xCB, 0x39, 0x2C, 0x00, 0x34, 0x02,	// power control a
+			INIT_CMD(1), 0xF7, 0x20,					// pump ratio control
+			INIT_CMD(2), 0xEA, 0x00, 0x00,				// timing control b
+			INIT_CMD(1), 0xC0, 0x26,					// power control 2; 26 25
+			INIT_CMD(1), 0xC1, 0x11,					// power control 2
+			INIT_CMD(2), 0xC5, 0x35, 0x3E,				// vcom control 1
+			INIT_CMD(1), 0xC7, 0xBE,					// vcom control 2; BE 94
+			INIT_CMD(2), 0xB1, 0x00, 0x1B,				// frame control; 1B 70
+			INIT_CMD(4), 0xB6, 0x0A, 0x82, 0x27, 0x00,	// display control
+			INIT_CMD(1), 0xB7, 0x07,					// emtry mode
+			INIT_CMD(1), 0x3A, 0x55,					// pixel format; 16bit
+			INIT_CMD(1), 0x36, 0x48,					// mem access
+			INIT_CMD(0), 0x29,							// display on
+			INIT_DELAY(5),
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
@@ -1,30 +1,24 @@
 case PCF8833:
-	LCD_Write_COM(0x01);
-	LCD_Write_COM(0x25);
-	LCD_Write_DATA(0x40);
-	LCD_Write_COM(0x11);
-	delay(10);
-	LCD_Write_COM(0x20);
-	LCD_Write_COM(0x38);
-	LCD_Write_COM(0x29);
-	LCD_Write_COM(0x13);
-	LCD_Write_COM(0x36);
-	LCD_Write_DATA(0x60);
-	LCD_Write_COM(0x3A);
-	LCD_Write_DATA(0x05);
-	LCD_Write_COM(0x2A);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x7F);
-	LCD_Write_COM(0xB4);
-	LCD_Write_DATA(0x03);
-	LCD_Write_DATA(0x08);
-	LCD_Write_DATA(0x0b);
-	LCD_Write_DATA(0x0e);
-	LCD_Write_COM(0xBA);
-	LCD_Write_DATA(0x07);
-	LCD_Write_DATA(0x0D);
-	LCD_Write_COM(0x2B);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x7F);
-	LCD_Write_COM(0x2C);
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(0), 0x01,
+			INIT_CMD(1), 0x25, 0x40,
+			INIT_CMD(0), 0x11,
+			INIT_DELAY(10),
+			INIT_CMD(0), 0x20,
+			INIT_CMD(0), 0x38,
+			INIT_CMD(0), 0x29,
+			INIT_CMD(0), 0x13,
+			INIT_CMD(1), 0x36, 0x60,
+			INIT_CMD(1), 0x3A, 0x05,
+			INIT_CMD(2), 0x2A, 0x00, 0x7F,
+			INIT_CMD(4), 0xB4, 0x03, 0x08, 0x0B, 0x0E,
+			INIT_CMD(2), 0xBA, 0x07, 0x0D,
+			INIT_CMD(2), 0x2B, 0x00, 0x7F,
+			INIT_CMD(0), 0x2C,
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
@@ -1,183 +1,38 @@
 case S1D19122:
-	//************* Start Initial Sequence **********//
-
-	int i,R,G,B;
-	LCD_Write_COM(0x11);
-	LCD_Write_COM(0x13);
-	LCD_Write_COM(0x29);
-    
-	//--------------  Display Control ---------//
-	LCD_Write_COM(0xB0);
-
-	LCD_Write_DATA(0x05);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0xF0);
-	LCD_Write_DATA(0x0A);
-	LCD_Write_DATA(0x41);
-	LCD_Write_DATA(0x02); 
-	LCD_Write_DATA(0x0A);
-	LCD_Write_DATA(0x30);
-	LCD_Write_DATA(0x31);
-	LCD_Write_DATA(0x36);
-	LCD_Write_DATA(0x37);
-	LCD_Write_DATA(0x40);
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x3F);
-	LCD_Write_DATA(0x40);
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x81);
-	LCD_Write_DATA(0x04);
-	LCD_Write_DATA(0x05);
-	LCD_Write_DATA(0x64);
-
-	// ----------- Gamma  Curve  Set3 Postive----------//
-	LCD_Write_COM(0xFC);
-
-	LCD_Write_DATA(0x88);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x10);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x10);
-	LCD_Write_DATA(0x42);
-	LCD_Write_DATA(0x42);
-	LCD_Write_DATA(0x22);
-	LCD_Write_DATA(0x11);
-	LCD_Write_DATA(0x11);
-	LCD_Write_DATA(0x22);
-	LCD_Write_DATA(0x99);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0xBB);
-	LCD_Write_DATA(0xBB);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0x33);
-	LCD_Write_DATA(0x33);
-	LCD_Write_DATA(0x11);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0xC0);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-
-	// ----------- Gamma  Curve  Set3 Negative----------//
-	LCD_Write_COM(0xFD);
-
-	LCD_Write_DATA(0x88);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x10);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x10);
-	LCD_Write_DATA(0x42);
-	LCD_Write_DATA(0x42);
-	LCD_Write_DATA(0x22);
-	LCD_Write_DATA(0x11);
-	LCD_Write_DATA(0x11);
-	LCD_Write_DATA(0x22);
-	LCD_Write_DATA(0x99);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0xBB);
-	LCD_Write_DATA(0xBB);
-	LCD_Write_DATA(0xAA);
-	LCD_Write_DATA(0x33);
-	LCD_Write_DATA(0x33);
-	LCD_Write_DATA(0x11);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x03);
-
-	// ----------- EVRSER Regulator Voltage Setting---------//
-	LCD_Write_COM(0xBE);
-
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x15);
-	LCD_Write_DATA(0x16);
-	LCD_Write_DATA(0x08);
-	LCD_Write_DATA(0x09);
-	LCD_Write_DATA(0x15);
-	LCD_Write_DATA(0x10);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-
-	// -----------Module Definiton Setting---------//
-	LCD_Write_COM(0xC0);
-
-	LCD_Write_DATA(0x0E);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-
-	// -----------PWRDEF Power Ability Ddfinition----------//
-	LCD_Write_COM(0xC1);
-
-	LCD_Write_DATA(0x2F);
-	LCD_Write_DATA(0x23);
-	LCD_Write_DATA(0xB4);
-	LCD_Write_DATA(0xFF);
-	LCD_Write_DATA(0x24);
-	LCD_Write_DATA(0x03);
-	LCD_Write_DATA(0x20);
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x20);
-	LCD_Write_DATA(0x20);
-	LCD_Write_DATA(0x00);
-
-	// -----------Other Setting----------//
-	LCD_Write_COM(0xC2);
-	LCD_Write_DATA(0x03);
-	LCD_Write_COM(0x26);
-	LCD_Write_DATA(0x08);
-	LCD_Write_COM(0x35);
-   
-	LCD_Write_COM(0x36);
-	LCD_Write_DATA(0x64);
-	LCD_Write_COM(0x3A);
-	LCD_Write_DATA(0x05);
-	LCD_Write_COM(0x2A);
-	LCD_Write_DATA(0x01,0x3f);
-	LCD_Write_COM(0x2B);
-	LCD_Write_DATA(0xEF);
-	LCD_Write_COM(0x2c);
-
-	// -----------RGB Setting----------//
-	LCD_Write_COM(0x2D);
-	R=0;
-	G=0;
-	B=0;   
-    
-	for(i=0;i<32;i++)
-	{ 
-		LCD_Write_DATA(R);
-		R=R+2;
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(0), 0x11,
+			INIT_CMD(0), 0x13,
+			INIT_CMD(0), 0x29,
+			// Display Control
+			INIT_CMD(20), 0xB0, 0x05, 0x00, 0xF0, 0x0A, 0x41, 0x02, 0x0A, 0x30, 0x31, 0x36, 0x37, 0x40, 0x02, 0x3F, 0x40, 0x02, 0x81, 0x04, 0x05, 0x64,
+			// Gamma Curve Set3 Postive
+			INIT_CMD(32), 0xFC, 0x88, 0x00, 0x10, 0x01, 0x01, 0x10, 0x42, 0x42, 0x22, 0x11, 0x11, 0x22, 0x99, 0xAA, 0xAA, 0xAA, 0xBB, 0xBB, 0xAA, 0x33, 0x33, 0x11, 0x01, 0x01, 0x01, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+			// Gamma Curve Set3 Negative
+			INIT_CMD(32), 0xFD, 0x88, 0x00, 0x10, 0x01, 0x01, 0x10, 0x42, 0x42, 0x22, 0x11, 0x11, 0x22, 0x99, 0xAA, 0xAA, 0xAA, 0xBB, 0xBB, 0xAA, 0x33, 0x33, 0x11, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+			// EVRSER Regulator Voltage Setting
+			INIT_CMD(10), 0xBE, 0x00, 0x15, 0x16, 0x08, 0x09, 0x15, 0x10, 0x00, 0x00, 0x00,
+			// Module Definiton Setting
+			INIT_CMD(5), 0xC0, 0x0E, 0x01, 0x00, 0x00, 0x00,
+			// PWRDEF Power Ability Ddfinition
+			INIT_CMD(13), 0xC1, 0x2F, 0x23, 0xB4, 0xFF, 0x24, 0x03, 0x20, 0x02, 0x02, 0x02, 0x20, 0x20, 0x00,
+			// Other Setting
+			INIT_CMD(1), 0xC2, 0x03,
+			INIT_CMD(1), 0x26, 0x08,
+			INIT_CMD(0), 0x35,
+			INIT_CMD(1), 0x36, 0x64,
+			INIT_CMD(1), 0x3A, 0x05,
+			INIT_CMD16(1), 0x2A, INIT_WORD(0x013F),
+			INIT_CMD(1), 0x2B, 0xEF,
+			INIT_CMD(0), 0x2C,
+			// RGB Setting
+			INIT_CMD(0), 0x2D,
+			INIT_RAMP(32, 0, 2),
+			INIT_RAMP(64, 0, 1),
+			INIT_RAMP(32, 0, 2),
+			INIT_END
+		};
+		_init_table(init);
 	}
-	for(i=0;i<64;i++)
-	{ 
-		LCD_Write_DATA(G);
-		G=G+1;
-	} 
-	for(i=0;i<32;i++)
-	{ 
-		LCD_Write_DATA(B);
-		B=B+2;
-	}    
 	break;
@@ -1,44 +1,51 @@
 case S6D0164:
-	LCD_Write_COM_DATA(0x11,0x001A);
-	LCD_Write_COM_DATA(0x12,0x3121);
-	LCD_Write_COM_DATA(0x13,0x006C);
-	LCD_Write_COM_DATA(0x14,0x4249);
-
-	LCD_Write_COM_DATA(0x10,0x0800);
-	delay(10);
-	LCD_Write_COM_DATA(0x11,0x011A);
-	delay(10);	
-	LCD_Write_COM_DATA(0x11,0x031A);
-	delay(10);
-	LCD_Write_COM_DATA(0x11,0x071A);
-	delay(10);
-	LCD_Write_COM_DATA(0x11,0x0F1A);
-	delay(10);	
-	LCD_Write_COM_DATA(0x11,0x0F3A);
-	delay(30);
-
-	LCD_Write_COM_DATA(0x01,0x011C);
-	LCD_Write_COM_DATA(0x02,0x0100);
-	LCD_Write_COM_DATA(0x03,0x1030);
-	LCD_Write_COM_DATA(0x07,0x0000);
-	LCD_Write_COM_DATA(0x08,0x0808);
-	LCD_Write_COM_DATA(0x0B,0x1100);
-	LCD_Write_COM_DATA(0x0C,0x0000);
-
-	LCD_Write_COM_DATA(0x0F,0x1401);
-	LCD_Write_COM_DATA(0x15,0x0000);
-	LCD_Write_COM_DATA(0x20,0x0000);
-	LCD_Write_COM_DATA(0x21,0x0000);
-	
-
-	LCD_Write_COM_DATA(0x36,0x00AF); 
-	LCD_Write_COM_DATA(0x37,0x0000); 	
-	LCD_Write_COM_DATA(0x38,0x00DB);
-	LCD_Write_COM_DATA(0x39,0x0000); 
-	
-	LCD_Write_COM_DATA(0x0F,0x0B01);
-	LCD_Write_COM_DATA(0x07,0x0016);	
-	LCD_Write_COM_DATA(0x07,0x0017);
-
-	LCD_Write_COM(0x22);
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_REG(5),
+				0x11, INIT_WORD(0x001A),
+				0x12, INIT_WORD(0x3121),
+				0x13, INIT_WORD(0x006C),
+				0x14, INIT_WORD(0x4249),
+				0x10, INIT_WORD(0x0800),
+			INIT_DELAY(10),
+			INIT_REG(1),
+				0x11, INIT_WORD(0x011A),
+			INIT_DELAY(10),
+			INIT_REG(1),
+				0x11, INIT_WORD(0x031A),
+			INIT_DELAY(10),
+			INIT_REG(1),
+				0x11, INIT_WORD(0x071A),
+			INIT_DELAY(10),
+			INIT_REG(1),
+				0x11, INIT_WORD(0x0F1A),
+			INIT_DELAY(10),
+			INIT_REG(1),
+				0x11, INIT_WORD(0x0F3A),
+			INIT_DELAY(30),
+			INIT_REG(18),
+				0x01, INIT_WORD(0x011C),
+				0x02, INIT_WORD(0x0100),
+				0x03, INIT_WORD(0x1030),
+				0x07, INIT_WORD(0x0000),
+				0x08, INIT_WORD(0x0808),
+				0x0B, INIT_WORD(0x1100),
+				0x0C, INIT_WORD(0x0000),
+				0x0F, INIT_WORD(0x1401),
+				0x15, INIT_WORD(0x0000),
+				0x20, INIT_WORD(0x0000),
+				0x21, INIT_WORD(0x0000),
+				0x36, INIT_WORD(0x00AF),
+				0x37, INIT_WORD(0x0000),
+				0x38, INIT_WORD(0x00DB),
+				0x39, INIT_WORD(0x0000),
+				0x0F, INIT_WORD(0x0B01),
+				0x07, INIT_WORD(0x0016),
+				0x07, INIT_WORD(0x0017),
+			INIT_CMD(0), 0x22,
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
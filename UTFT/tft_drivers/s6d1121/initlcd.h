@@ -1,47 +1,56 @@
 case S6D1121_8:
 case S6D1121_16:
-	LCD_Write_COM_DATA(0x11,0x2004);		
-	LCD_Write_COM_DATA(0x13,0xCC00);		
-	LCD_Write_COM_DATA(0x15,0x2600);	
-	LCD_Write_COM_DATA(0x14,0x252A);	
-	LCD_Write_COM_DATA(0x12,0x0033);		
-	LCD_Write_COM_DATA(0x13,0xCC04);		
-	LCD_Write_COM_DATA(0x13,0xCC06);		
-	LCD_Write_COM_DATA(0x13,0xCC4F);		
-	LCD_Write_COM_DATA(0x13,0x674F);
-	LCD_Write_COM_DATA(0x11,0x2003);
-	LCD_Write_COM_DATA(0x30,0x2609);		
-	LCD_Write_COM_DATA(0x31,0x242C);		
-	LCD_Write_COM_DATA(0x32,0x1F23);		
-	LCD_Write_COM_DATA(0x33,0x2425);		
-	LCD_Write_COM_DATA(0x34,0x2226);		
-	LCD_Write_COM_DATA(0x35,0x2523);		
-	LCD_Write_COM_DATA(0x36,0x1C1A);		
-	LCD_Write_COM_DATA(0x37,0x131D);		
-	LCD_Write_COM_DATA(0x38,0x0B11);		
-	LCD_Write_COM_DATA(0x39,0x1210);		
-	LCD_Write_COM_DATA(0x3A,0x1315);		
-	LCD_Write_COM_DATA(0x3B,0x3619);		
-	LCD_Write_COM_DATA(0x3C,0x0D00);		
-	LCD_Write_COM_DATA(0x3D,0x000D);		
-	LCD_Write_COM_DATA(0x16,0x0007);		
-	LCD_Write_COM_DATA(0x02,0x0013);		
-	LCD_Write_COM_DATA(0x03,0x0003);		
-	LCD_Write_COM_DATA(0x01,0x0127);		
-	LCD_Write_COM_DATA(0x08,0x0303);		
-	LCD_Write_COM_DATA(0x0A,0x000B);		
-	LCD_Write_COM_DATA(0x0B,0x0003);   
-	LCD_Write_COM_DATA(0x0C,0x0000);   
-	LCD_Write_COM_DATA(0x41,0x0000);    
-	LCD_Write_COM_DATA(0x50,0x0000);   
-	LCD_Write_COM_DATA(0x60,0x0005);    
-	LCD_Write_COM_DATA(0x70,0x000B);    
-	LCD_Write_COM_DATA(0x71,0x0000);    
-	LCD_Write_COM_DATA(0x78,0x0000);    
-	LCD_Write_COM_DATA(0x7A,0x0000);   
-	LCD_Write_COM_DATA(0x79,0x0007);		
-	LCD_Write_COM_DATA(0x07,0x0051);   
-	LCD_Write_COM_DATA(0x07,0x0053);		
-	LCD_Write_COM_DATA(0x79,0x0000);
-	LCD_Write_COM(0x22);
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_REG(31),
+				0x11, INIT_WORD(0x2004),
+				0x13, INIT_WORD(0xCC00),
+				0x15, INIT_WORD(0x2600),
+				0x14, INIT_WORD(0x252A),
+				0x12, INIT_WORD(0x0033),
+				0x13, INIT_WORD(0xCC04),
+				0x13, INIT_WORD(0xCC06),
+				0x13, INIT_WORD(0xCC4F),
+				0x13, INIT_WORD(0x674F),
+				0x11, INIT_WORD(0x2003),
+				0x30, INIT_WORD(0x2609),
+				0x31, INIT_WORD(0x242C),
+				0x32, INIT_WORD(0x1F23),
+				0x33, INIT_WORD(0x2425),
+				0x34, INIT_WORD(0x2226),
+				0x35, INIT_WORD(0x2523),
+				0x36, INIT_WORD(0x1C1A),
+				0x37, INIT_WORD(0x131D),
+				0x38, INIT_WORD(0x0B11),
+				0x39, INIT_WORD(0x1210),
+				0x3A, INIT_WORD(0x1315),
+				0x3B, INIT_WORD(0x3619),
+				0x3C, INIT_WORD(0x0D00),
+				0x3D, INIT_WORD(0x000D),
+				0x16, INIT_WORD(0x0007),
+				0x02, INIT_WORD(0x0013),
+				0x03, INIT_WORD(0x0003),
+				0x01, INIT_WORD(0x0127),
+				0x08, INIT_WORD(0x0303),
+				0x0A, INIT_WORD(0x000B),
+				0x0B, INIT_WORD(0x0003),
+			INIT_REG(12),
+				0x0C, INIT_WORD(0x0000),
+				0x41, INIT_WORD(0x0000),
+				0x50, INIT_WORD(0x0000),
+				0x60, INIT_WORD(0x0005),
+				0x70, INIT_WORD(0x000B),
+				0x71, INIT_WORD(0x0000),
+				0x78, INIT_WORD(0x0000),
+				0x7A, INIT_WORD(0x0000),
+				0x79, INIT_WORD(0x0007),
+				0x07, INIT_WORD(0x0051),
+				0x07, INIT_WORD(0x0053),
+				0x79, INIT_WORD(0x0000),
+			INIT_CMD(0), 0x22,
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
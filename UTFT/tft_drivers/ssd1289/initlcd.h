@@ -1,46 +1,55 @@
 case SSD1289:
 case SSD1289_8:
 case SSD1289LATCHED:
-	LCD_Write_COM_DATA(0x00,0x0001);
-	LCD_Write_COM_DATA(0x03,0xA8A4);
-	LCD_Write_COM_DATA(0x0C,0x0000);
-	LCD_Write_COM_DATA(0x0D,0x080C);
-	LCD_Write_COM_DATA(0x0E,0x2B00);
-	LCD_Write_COM_DATA(0x1E,0x00B7);
-	LCD_Write_COM_DATA(0x01,0x2B3F);
-	LCD_Write_COM_DATA(0x02,0x0600);
-	LCD_Write_COM_DATA(0x10,0x0000);
-	LCD_Write_COM_DATA(0x11,0x6070);
-	LCD_Write_COM_DATA(0x05,0x0000);
-	LCD_Write_COM_DATA(0x06,0x0000);
-	LCD_Write_COM_DATA(0x16,0xEF1C);
-	LCD_Write_COM_DATA(0x17,0x0003);
-	LCD_Write_COM_DATA(0x07,0x0233);
-	LCD_Write_COM_DATA(0x0B,0x0000);
-	LCD_Write_COM_DATA(0x0F,0x0000);
-	LCD_Write_COM_DATA(0x41,0x0000);
-	LCD_Write_COM_DATA(0x42,0x0000);
-	LCD_Write_COM_DATA(0x48,0x0000);
-	LCD_Write_COM_DATA(0x49,0x013F);
-	LCD_Write_COM_DATA(0x4A,0x0000);
-	LCD_Write_COM_DATA(0x4B,0x0000);
-	LCD_Write_COM_DATA(0x44,0xEF00);
-	LCD_Write_COM_DATA(0x45,0x0000);
-	LCD_Write_COM_DATA(0x46,0x013F);
-	LCD_Write_COM_DATA(0x30,0x0707);
-	LCD_Write_COM_DATA(0x31,0x0204);
-	LCD_Write_COM_DATA(0x32,0x0204);
-	LCD_Write_COM_DATA(0x33,0x0502);
-	LCD_Write_COM_DATA(0x34,0x0507);
-	LCD_Write_COM_DATA(0x35,0x0204);
-	LCD_Write_COM_DATA(0x36,0x0204);
-	LCD_Write_COM_DATA(0x37,0x0502);
-	LCD_Write_COM_DATA(0x3A,0x0302);
-	LCD_Write_COM_DATA(0x3B,0x0302);
-	LCD_Write_COM_DATA(0x23,0x0000);
-	LCD_Write_COM_DATA(0x24,0x0000);
-	LCD_Write_COM_DATA(0x25,0x8000);
-	LCD_Write_COM_DATA(0x4f,0x0000);
-	LCD_Write_COM_DATA(0x4e,0x0000);
-	LCD_Write_COM(0x22);   
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_REG(31),
+				0x00, INIT_WORD(0x0001),
+				0x03, INIT_WORD(0xA8A4),
+				0x0C, INIT_WORD(0x0000),
+				0x0D, INIT_WORD(0x080C),
+				0x0E, INIT_WORD(0x2B00),
+				0x1E, INIT_WORD(0x00B7),
+				0x01, INIT_WORD(0x2B3F),
+				0x02, INIT_WORD(0x0600),
+				0x10, INIT_WORD(0x0000),
+				0x11, INIT_WORD(0x6070),
+				0x05, INIT_WORD(0x0000),
+				0x06, INIT_WORD(0x0000),
+				0x16, INIT_WORD(0xEF1C),
+				0x17, INIT_WORD(0x0003),
+				0x07, INIT_WORD(0x0233),
+				0x0B, INIT_WORD(0x0000),
+				0x0F, INIT_WORD(0x0000),
+				0x41, INIT_WORD(0x0000),
+				0x42, INIT_WORD(0x0000),
+				0x48, INIT_WORD(0x0000),
+				0x49, INIT_WORD(0x013F),
+				0x4A, INIT_WORD(0x0000),
+				0x4B, INIT_WORD(0x0000),
+				0x44, INIT_WORD(0xEF00),
+				0x45, INIT_WORD(0x0000),
+				0x46, INIT_WORD(0x013F),
+				0x30, INIT_WORD(0x0707),
+				0x31, INIT_WORD(0x0204),
+				0x32, INIT_WORD(0x0204),
+				0x33, INIT_WORD(0x0502),
+				0x34, INIT_WORD(0x0507),
+			INIT_REG(10),
+				0x35, INIT_WORD(0x0204),
+				0x36, INIT_WORD(0x0204),
+				0x37, INIT_WORD(0x0502),
+				0x3A, INIT_WORD(0x0302),
+				0x3B, INIT_WORD(0x0302),
+				0x23, INIT_WORD(0x0000),
+				0x24, INIT_WORD(0x0000),
+				0x25, INIT_WORD(0x8000),
+				0x4F, INIT_WORD(0x0000),
+				0x4E, INIT_WORD(0x0000),
+			INIT_CMD(0), 0x22,
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
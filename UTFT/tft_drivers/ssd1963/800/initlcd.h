@@ -1,78 +1,54 @@
 case SSD1963_800:
-	LCD_Write_COM(0xE2);		//PLL multiplier, set PLL clock to 120M
-	LCD_Write_DATA(0x1E);	    //N=0x36 for 6.5M, 0x23 for 10M crystal
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x54);
-	LCD_Write_COM(0xE0);		// PLL enable
-	LCD_Write_DATA(0x01);
-	delay(10);
-	LCD_Write_COM(0xE0);
-	LCD_Write_DATA(0x03);
-	delay(10);
-	LCD_Write_COM(0x01);		// software reset
-	delay(100);
-	LCD_Write_COM(0xE6);		//PLL setting for PCLK, depends on resolution
-	LCD_Write_DATA(0x03);
-	LCD_Write_DATA(0xFF);
-	LCD_Write_DATA(0xFF);
-
-	LCD_Write_COM(0xB0);		//LCD SPECIFICATION
-	LCD_Write_DATA(0x24);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x03);		//Set HDP	799
-	LCD_Write_DATA(0x1F);
-	LCD_Write_DATA(0x01);		//Set VDP	479
-	LCD_Write_DATA(0xDF);
-	LCD_Write_DATA(0x00);
-
-	LCD_Write_COM(0xB4);		//HSYNC
-	LCD_Write_DATA(0x03);		//Set HT	928
-	LCD_Write_DATA(0xA0);
-	LCD_Write_DATA(0x00);		//Set HPS	46
-	LCD_Write_DATA(0x2E);
-	LCD_Write_DATA(0x30);		//Set HPW	48
-	LCD_Write_DATA(0x00);		//Set LPS	15
-	LCD_Write_DATA(0x0F);
-	LCD_Write_DATA(0x00);
-
-	LCD_Write_COM(0xB6);		//VSYNC
-	LCD_Write_DATA(0x02);		//Set VT	525
-	LCD_Write_DATA(0x0D);
-	LCD_Write_DATA(0x00);		//Set VPS	16
-	LCD_Write_DATA(0x10);
-	LCD_Write_DATA(0x10);		//Set VPW	16
-	LCD_Write_DATA(0x00);		//Set FPS	8
-	LCD_Write_DATA(0x08);
-
-	LCD_Write_COM(0xBA);
-	LCD_Write_DATA(0x0F);		//GPIO[3:0] out 1
-
-	LCD_Write_COM(0xB8);
-	LCD_Write_DATA(0x07);	    //GPIO3=input, GPIO[2:0]=output
-	LCD_Write_DATA(0x01);		//GPIO0 normal
-
-	LCD_Write_COM(0x36);		//rotation
-	LCD_Write_DATA(0x22);
-
-	LCD_Write_COM(0xF0);		//pixel data interface
-	LCD_Write_DATA(0x03);
-
-
-	delay(1);
-
+	{
+		static const uint8_t init1[] PROGMEM =
+		{
+			INIT_CMD(3), 0xE2,							// PLL multiplier, set PLL clock to 120M
+				0x1E,									// N=0x36 for 6.5M, 0x23 for 10M crystal
+				0x02, 0x54,
+			INIT_CMD(1), 0xE0, 0x01,					// PLL enable
+			INIT_DELAY(1),
+			INIT_CMD(1), 0xE0, 0x03,
+			INIT_DELAY(1),
+			INIT_CMD(0), 0x01,							// software reset
+			INIT_DELAY(5),
+			INIT_CMD(3), 0xE6, 0x03, 0xFF, 0xFF,		// PLL setting for PCLK, depends on resolution
+			INIT_CMD(7), 0xB0,							// LCD SPECIFICATION
+				0x24,
+				0x00,									// TFT mode
+				0x03, 0x1F,								// Set HDP	799
+				0x01, 0xDF,								// Set VDP	479
+				0x00,									// RGB sequence
+			INIT_CMD(8), 0xB4,							// HSYNC
+				0x03, 0xA0,								// Set HT	928
+				0x00, 0x2E,								// Set HPS	46
+				0x30,									// Set HPW	48
+				0x00, 0x0F,								// Set LPS	15
+				0x00,
+			INIT_CMD(7), 0xB6,							// VSYNC
+				0x02, 0x0D,								// Set VT	525
+				0x00, 0x10,								// Set VPS	16
+				0x10,									// Set VPW	16
+				0x00, 0x08,								// Set FPS	8
+			INIT_CMD(1), 0xBA, 0x0F,					// GPIO[3:0] out 1
+			INIT_CMD(2), 0xB8,
+				0x07,									// GPIO3=input, GPIO[2:0]=output
+				0x01,									// GPIO0 normal
+			INIT_CMD(1), 0x36, 0x22,					// rotation
+			INIT_CMD(1), 0xF0, 0x03,					// pixel data interface
+			INIT_END
+		};
+		_init_table(init1);
+	}
 	setXY(0, 0, 799, 479);
-	LCD_Write_COM(0x29);		//display on
-
-	LCD_Write_COM(0xBE);		//set PWM for B/L
-	LCD_Write_DATA(0x06);
-	LCD_Write_DATA(0xf0);
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0xf0);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-
-	LCD_Write_COM(0xd0); 
-	LCD_Write_DATA(0x0d);	
-
-	LCD_Write_COM(0x2C); 
+	{
+		static const uint8_t init2[] PROGMEM =
+		{
+			INIT_CMD(0), 0x29,							// display on
+			INIT_CMD(6), 0xBE, 0x06, 0xF0, 0x01, 0xF0, 0x00, 0x00,	// set PWM for B/L
+			INIT_CMD(1), 0xD0, 0x0D,
+			INIT_CMD(0), 0x2C,
+			INIT_END
+		};
+		_init_table(init2);
+	}
 	break;
@@ -1,104 +1,33 @@
 case ST7735_ALT:
-	LCD_Write_COM(0x11);//Sleep exit 
-	delay(12);
- 
-	//ST7735R Frame Rate
-	LCD_Write_COM(0xB1); 
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x2C);
-	LCD_Write_DATA(0x2D); 
-	LCD_Write_COM(0xB2); 
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x2C);
-	LCD_Write_DATA(0x2D); 
-	LCD_Write_COM(0xB3); 
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x2C);
-	LCD_Write_DATA(0x2D); 
-	LCD_Write_DATA(0x01);
-	LCD_Write_DATA(0x2C);
-	LCD_Write_DATA(0x2D); 
-
-	LCD_Write_COM(0xB4); //Column inversion 
-	LCD_Write_DATA(0x07); 
- 
-	//ST7735R Power Sequence
-	LCD_Write_COM(0xC0); 
-	LCD_Write_DATA(0xA2);
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x84); 
-	LCD_Write_COM(0xC1);
-	LCD_Write_DATA(0xC5); 
-	LCD_Write_COM(0xC2); 
-	LCD_Write_DATA(0x0A);
-	LCD_Write_DATA(0x00); 
-	LCD_Write_COM(0xC3); 
-	LCD_Write_DATA(0x8A);
-	LCD_Write_DATA(0x2A); 
-	LCD_Write_COM(0xC4); 
-	LCD_Write_DATA(0x8A);
-	LCD_Write_DATA(0xEE); 
- 
-	LCD_Write_COM(0xC5); //VCOM 
-	LCD_Write_DATA(0x0E); 
- 
-	LCD_Write_COM(0x36); //MX, MY, RGB mode 
-	LCD_Write_DATA(0xC0); 
-
-	//ST7735R Gamma Sequence
-	LCD_Write_COM(0xe0); 
-	LCD_Write_DATA(0x0f);
-	LCD_Write_DATA(0x1a); 
-	LCD_Write_DATA(0x0f);
-	LCD_Write_DATA(0x18); 
-	LCD_Write_DATA(0x2f);
-	LCD_Write_DATA(0x28); 
-	LCD_Write_DATA(0x20);
-	LCD_Write_DATA(0x22); 
-	LCD_Write_DATA(0x1f);
-	LCD_Write_DATA(0x1b); 
-	LCD_Write_DATA(0x23);
-	LCD_Write_DATA(0x37);
-	LCD_Write_DATA(0x00); 
-
-	LCD_Write_DATA(0x07); 
-	LCD_Write_DATA(0x02);
-	LCD_Write_DATA(0x10); 
-	LCD_Write_COM(0xe1); 
-	LCD_Write_DATA(0x0f);
-	LCD_Write_DATA(0x1b); 
-	LCD_Write_DATA(0x0f);
-	LCD_Write_DATA(0x17); 
-	LCD_Write_DATA(0x33);
-	LCD_Write_DATA(0x2c); 
-	LCD_Write_DATA(0x29);
-	LCD_Write_DATA(0x2e); 
-	LCD_Write_DATA(0x30);
-	LCD_Write_DATA(0x30); 
-	LCD_Write_DATA(0x39);
-	LCD_Write_DATA(0x3f); 
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x07); 
-	LCD_Write_DATA(0x03);
-	LCD_Write_DATA(0x10);  
-
-	LCD_Write_COM(0x2a);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x7f);
-	LCD_Write_COM(0x2b);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x9f);
-
-	LCD_Write_COM(0xF0); //Enable test command  
-	LCD_Write_DATA(0x01); 
-	LCD_Write_COM(0xF6); //Disable ram power save mode 
-	LCD_Write_DATA(0x00); 
- 
-	LCD_Write_COM(0x3A); //65k mode 
-	LCD_Write_DATA(0x05); 
-	LCD_Write_COM(0x29);//Display on
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(0), 0x11,							// Sleep exit
+			INIT_DELAY(12),
+			// ST7735R Frame Rate
+			INIT_CMD(3), 0xB1, 0x01, 0x2C, 0x2D,
+			INIT_CMD(3), 0xB2, 0x01, 0x2C, 0x2D,
+			INIT_CMD(6), 0xB3, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,
+			INIT_CMD(1), 0xB4, 0x07,					// Column inversion
+			// ST7735R Power Sequence
+			INIT_CMD(3), 0xC0, 0xA2, 0x02, 0x84,
+			INIT_CMD(1), 0xC1, 0xC5,
+			INIT_CMD(2), 0xC2, 0x0A, 0x00,
+			INIT_CMD(2), 0xC3, 0x8A, 0x2A,
+			INIT_CMD(2), 0xC4, 0x8A, 0xEE,
+			INIT_CMD(1), 0xC5, 0x0E,					// VCOM
+			INIT_CMD(1), 0x36, 0xC0,					// MX, MY, RGB mode
+			// ST7735R Gamma Sequence
+			INIT_CMD(16), 0xE0, 0x0F, 0x1A, 0x0F, 0x18, 0x2F, 0x28, 0x20, 0x22, 0x1F, 0x1B, 0x23, 0x37, 0x00, 0x07, 0x02, 0x10,
+			INIT_CMD(16), 0xE1, 0x0F, 0x1B, 0x0F, 0x17, 0x33, 0x2C, 0x29, 0x2E, 0x30, 0x30, 0x39, 0x3F, 0x00, 0x07, 0x03, 0x10,
+			INIT_CMD(4), 0x2A, 0x00, 0x00, 0x00, 0x7F,
+			INIT_CMD(4), 0x2B, 0x00, 0x00, 0x00, 0x9F,
+			INIT_CMD(1), 0xF0, 0x01,					// Enable test command
+			INIT_CMD(1), 0xF6, 0x00,					// Disable ram power save mode
+			INIT_CMD(1), 0x3A, 0x05,					// 65k mode
+			INIT_CMD(0), 0x29,							// Display on
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
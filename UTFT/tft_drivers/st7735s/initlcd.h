@@ -1,98 +1,29 @@
 case ST7735S:
-	LCD_Write_COM(0x11);//Sleep exit 
-	delay(120);
- 
-	//ST7735R Frame Rate
-	LCD_Write_COM(0xB1); 
-	LCD_Write_DATA(0x05);
-	LCD_Write_DATA(0x3C);
-	LCD_Write_DATA(0x3C); 
-	LCD_Write_COM(0xB2); 
-	LCD_Write_DATA(0x05);
-	LCD_Write_DATA(0x3C);
-	LCD_Write_DATA(0x3C); 
-	LCD_Write_COM(0xB3); 
-	LCD_Write_DATA(0x05);
-	LCD_Write_DATA(0x3C);
-	LCD_Write_DATA(0x3C); 
-	LCD_Write_DATA(0x05);
-	LCD_Write_DATA(0x3C);
-	LCD_Write_DATA(0x3C); 
-
-	LCD_Write_COM(0xB4); //Column inversion 
-	LCD_Write_DATA(0x03); 
- 
-	//ST7735R Power Sequence
-	LCD_Write_COM(0xC0); 
-	LCD_Write_DATA(0x28);
-	LCD_Write_DATA(0x08);
-	LCD_Write_DATA(0x04); 
-	LCD_Write_COM(0xC1);
-	LCD_Write_DATA(0xC0); 
-	LCD_Write_COM(0xC2); 
-	LCD_Write_DATA(0x0D);
-	LCD_Write_DATA(0x00); 
-	LCD_Write_COM(0xC3); 
-	LCD_Write_DATA(0x8D);
-	LCD_Write_DATA(0x2A); 
-	LCD_Write_COM(0xC4); 
-	LCD_Write_DATA(0x8D);
-	LCD_Write_DATA(0xEE); 
- 
-	LCD_Write_COM(0xC5); //VCOM 
-	LCD_Write_DATA(0x1A); 
- 
-	LCD_Write_COM(0x36); //MX, MY, RGB mode 
-	LCD_Write_DATA(0xC0); 
-
-	//ST7735R Gamma Sequence
-	LCD_Write_COM(0xE0); 
-	LCD_Write_DATA(0x03);
-	LCD_Write_DATA(0x22); 
-	LCD_Write_DATA(0x07);
-	LCD_Write_DATA(0x0A); 
-	LCD_Write_DATA(0x2E);
-	LCD_Write_DATA(0x30); 
-	LCD_Write_DATA(0x25);
-	LCD_Write_DATA(0x2A); 
-	LCD_Write_DATA(0x28);
-	LCD_Write_DATA(0x26); 
-	LCD_Write_DATA(0x2E);
-	LCD_Write_DATA(0x3A);
-	LCD_Write_DATA(0x00); 
-	LCD_Write_DATA(0x01); 
-	LCD_Write_DATA(0x03);
-	LCD_Write_DATA(0x13); 
-	LCD_Write_COM(0xE1); 
-	LCD_Write_DATA(0x04);
-	LCD_Write_DATA(0x16); 
-	LCD_Write_DATA(0x06);
-	LCD_Write_DATA(0x0D); 
-	LCD_Write_DATA(0x2D);
-	LCD_Write_DATA(0x26); 
-	LCD_Write_DATA(0x23);
-	LCD_Write_DATA(0x27); 
-	LCD_Write_DATA(0x27);
-	LCD_Write_DATA(0x25); 
-	LCD_Write_DATA(0x2D);
-	LCD_Write_DATA(0x3B); 
-	LCD_Write_DATA(0x00);
-	LCD_Write_DATA(0x01); 
-	LCD_Write_DATA(0x04);
-	LCD_Write_DATA(0x13);  
-
-	//LCD_Write_COM(0x2A);
-	//LCD_Write_DATA(0x00);
-	//LCD_Write_DATA(0x00);
-	//LCD_Write_DATA(0x00);
-	//LCD_Write_DATA(0x7F);
-	//LCD_Write_COM(0x2B);
-	//LCD_Write_DATA(0x00);
-	//LCD_Write_DATA(0x00);
-	//LCD_Write_DATA(0x00);
-	//LCD_Write_DATA(0x9F);
-
-	LCD_Write_COM(0x3A); //65k mode 
-	LCD_Write_DATA(0x05); 
-	LCD_Write_COM(0x29);//Display on
+	{
+		static const uint8_t init[] PROGMEM =
+		{
+			INIT_CMD(0), 0x11,							// Sleep exit
+			INIT_DELAY(120),
+			// ST7735R Frame Rate
+			INIT_CMD(3), 0xB1, 0x05, 0x3C, 0x3C,
+			INIT_CMD(3), 0xB2, 0x05, 0x3C, 0x3C,
+			INIT_CMD(6), 0xB3, 0x05, 0x3C, 0x3C, 0x05, 0x3C, 0x3C,
+			INIT_CMD(1), 0xB4, 0x03,					// Column inversion
+			// ST7735R Power Sequence
+			INIT_CMD(3), 0xC0, 0x28, 0x08, 0x04,
+			INIT_CMD(1), 0xC1, 0xC0,
+			INIT_CMD(2), 0xC2, 0x0D, 0x00,
+			INIT_CMD(2), 0xC3, 0x8D, 0x2A,
+			INIT_CMD(2), 0xC4, 0x8D, 0xEE,
+			INIT_CMD(1), 0xC5, 0x1A,					// VCOM
+			INIT_CMD(1), 0x36, 0xC0,					// MX, MY, RGB mode
+			// ST7735R Gamma Sequence
+			INIT_CMD(16), 0xE0, 0x03, 0x22, 0x07, 0x0A, 0x2E, 0x30, 0x25, 0x2A, 0x28, 0x26, 0x2E, 0x3A, 0x00, 0x01, 0x03, 0x13,
+			INIT_CMD(16), 0xE1, 0x04, 0x16, 0x06, 0x0D, 0x2D, 0x26, 0x23, 0x27, 0x27, 0x25, 0x2D, 0x3B, 0x00, 0x01, 0x04, 0x13,
+			INIT_CMD(1), 0x3A, 0x05,					// 65k mode
+			INIT_CMD(0), 0x29,							// Display on
+			INIT_END
+		};
+		_init_table(init);
+	}
 	break;
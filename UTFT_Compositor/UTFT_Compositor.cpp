@@ -0,0 +1,553 @@
+/*
+  UTFT_Compositor.cpp - Add-on Library for UTFT: Retained mode drawing
+
+  This library requires the UTFT library.
+*/
+
+#include "UTFT_Compositor.h"
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#endif
+
+UTFT_Compositor::UTFT_Compositor(UTFT *ptrUTFT, uint16_t *buffer, long bufferSize)
+{
+	_UTFT = ptrUTFT;
+	_buffer = buffer;
+	_buffer_size = bufferSize;
+	_background = VGA_BLACK;
+	_band_height = 0;
+	for (int i=0; i<COMPOSITOR_MAX_ITEMS; i++)
+		items[i].type = COMP_NONE;
+	dirty_count = 0;
+}
+
+void UTFT_Compositor::setBackground(word color)
+{
+	_background = color;
+	invalidateAll();
+}
+
+int UTFT_Compositor::_add_item(byte type, int x1, int y1, int x2, int y2, word color)
+{
+	for (int i=0; i<COMPOSITOR_MAX_ITEMS; i++)
+	{
+		if (items[i].type==COMP_NONE)
+		{
+			items[i].type = type;
+			items[i].visible = true;
+			items[i].color = color;
+			items[i].bcolor = VGA_TRANSPARENT;
+			items[i].x1 = x1;
+			items[i].y1 = y1;
+			items[i].x2 = x2;
+			items[i].y2 = y2;
+			items[i].text = 0;
+			items[i].font = 0;
+			items[i].data = 0;
+			return i;
+		}
+	}
+	return -1;
+}
+
+int UTFT_Compositor::addFillRect(int x1, int y1, int x2, int y2, word color)
+{
+	int id = _add_item(COMP_FILLRECT, x1, y1, x2, y2, color);
+
+	_end_change(id);
+	return id;
+}
+
+int UTFT_Compositor::addRect(int x1, int y1, int x2, int y2, word color)
+{
+	int id = _add_item(COMP_RECT, x1, y1, x2, y2, color);
+
+	_end_change(id);
+	return id;
+}
+
+int UTFT_Compositor::addLine(int x1, int y1, int x2, int y2, word color)
+{
+	int id = _add_item(COMP_LINE, x1, y1, x2, y2, color);
+
+	_end_change(id);
+	return id;
+}
+
+int UTFT_Compositor::addCircle(int x, int y, int radius, word color)
+{
+	int id = _add_item(COMP_CIRCLE, x, y, radius, 0, color);
+
+	_end_change(id);
+	return id;
+}
+
+int UTFT_Compositor::addFillCircle(int x, int y, int radius, word color)
+{
+	int id = _add_item(COMP_FILLCIRCLE, x, y, radius, 0, color);
+
+	_end_change(id);
+	return id;
+}
+
+// Only fixed width fonts can be drawn; proportional fonts start with a 0
+// where the character width is stored.
+int UTFT_Compositor::addText(char *st, int x, int y, uint8_t *font, word color, uint32_t bcolor)
+{
+	if (pgm_read_byte(&font[0])==0)
+		return -1;
+
+	int id = _add_item(COMP_TEXT, x, y, 0, 0, color);
+
+	if (id>=0)
+	{
+		items[id].text = st;
+		items[id].font = font;
+		items[id].bcolor = bcolor;
+	}
+	_end_change(id);
+	return id;
+}
+
+int UTFT_Compositor::addBitmap(int x, int y, int sx, int sy, bitmapdatatype data)
+{
+	int id = _add_item(COMP_BITMAP, x, y, sx, sy, 0);
+
+	if (id>=0)
+		items[id].data = data;
+	_end_change(id);
+	return id;
+}
+
+void UTFT_Compositor::setPosition(int id, int x1, int y1, int x2, int y2)
+{
+	if ((id<0) or (id>=COMPOSITOR_MAX_ITEMS))
+		return;
+	_begin_change(id);
+	items[id].x1 = x1;
+	items[id].y1 = y1;
+	if ((items[id].type!=COMP_TEXT) and (items[id].type!=COMP_BITMAP))
+	{
+		items[id].x2 = x2;
+		items[id].y2 = y2;
+	}
+	_end_change(id);
+}
+
+void UTFT_Compositor::setColor(int id, word color)
+{
+	if ((id<0) or (id>=COMPOSITOR_MAX_ITEMS))
+		return;
+	items[id].color = color;
+	_end_change(id);
+}
+
+void UTFT_Compositor::setText(int id, char *st)
+{
+	if ((id<0) or (id>=COMPOSITOR_MAX_ITEMS))
+		return;
+	_begin_change(id);
+	items[id].text = st;
+	_end_change(id);
+}
+
+void UTFT_Compositor::setVisible(int id, boolean visible)
+{
+	if ((id<0) or (id>=COMPOSITOR_MAX_ITEMS))
+		return;
+	_begin_change(id);
+	items[id].visible = visible;
+	_end_change(id);
+}
+
+void UTFT_Compositor::removeAllItems()
+{
+	for (int i=0; i<COMPOSITOR_MAX_ITEMS; i++)
+		items[i].type = COMP_NONE;
+	invalidateAll();
+}
+
+int UTFT_Compositor::getDirtyCount()
+{
+	return dirty_count;
+}
+
+void UTFT_Compositor::_get_bbox(int id, _comp_rect *r)
+{
+	_comp_item *item = &items[id];
+
+	switch (item->type)
+	{
+	case COMP_FILLRECT:
+	case COMP_RECT:
+	case COMP_LINE:
+		r->x1 = min(item->x1, item->x2);
+		r->x2 = max(item->x1, item->x2);
+		r->y1 = min(item->y1, item->y2);
+		r->y2 = max(item->y1, item->y2);
+		break;
+	case COMP_CIRCLE:
+	case COMP_FILLCIRCLE:
+		r->x1 = item->x1-item->x2;
+		r->x2 = item->x1+item->x2;
+		r->y1 = item->y1-item->x2;
+		r->y2 = item->y1+item->x2;
+		break;
+	case COMP_TEXT:
+		r->x1 = item->x1;
+		r->y1 = item->y1;
+		r->x2 = item->x1+(strlen(item->text)*pgm_read_byte(&item->font[0]))-1;
+		r->y2 = item->y1+pgm_read_byte(&item->font[1])-1;
+		break;
+	case COMP_BITMAP:
+		r->x1 = item->x1;
+		r->y1 = item->y1;
+		r->x2 = item->x1+item->x2-1;
+		r->y2 = item->y1+item->y2-1;
+		break;
+	}
+}
+
+// The area an item covered when it was last drawn must be repainted
+// after it moves or disappears.
+void UTFT_Compositor::_begin_change(int id)
+{
+	if ((items[id].type!=COMP_NONE) and items[id].visible)
+		invalidate(items[id].bbox.x1, items[id].bbox.y1, items[id].bbox.x2, items[id].bbox.y2);
+}
+
+void UTFT_Compositor::_end_change(int id)
+{
+	if ((id<0) or (items[id].type==COMP_NONE))
+		return;
+	_get_bbox(id, &items[id].bbox);
+	if (items[id].visible)
+		invalidate(items[id].bbox.x1, items[id].bbox.y1, items[id].bbox.x2, items[id].bbox.y2);
+}
+
+void UTFT_Compositor::invalidateAll()
+{
+	dirty_count = 0;
+	invalidate(0, 0, _UTFT->getDisplayXSize()-1, _UTFT->getDisplayYSize()-1);
+}
+
+void UTFT_Compositor::invalidate(int x1, int y1, int x2, int y2)
+{
+	_comp_rect	r;
+	int			best;
+	long		best_growth, growth;
+
+	r.x1 = max(min(x1, x2), 0);
+	r.y1 = max(min(y1, y2), 0);
+	r.x2 = min(max(x1, x2), _UTFT->getDisplayXSize()-1);
+	r.y2 = min(max(y1, y2), _UTFT->getDisplayYSize()-1);
+	if ((r.x1>r.x2) or (r.y1>r.y2))
+		return;
+
+	// Merge with every dirty rectangle it overlaps or touches
+	for (int i=0; i<dirty_count; i++)
+	{
+		if ((r.x1<=dirty[i].x2+1) and (r.x2+1>=dirty[i].x1) and (r.y1<=dirty[i].y2+1) and (r.y2+1>=dirty[i].y1))
+		{
+			r.x1 = min(r.x1, dirty[i].x1);
+			r.y1 = min(r.y1, dirty[i].y1);
+			r.x2 = max(r.x2, dirty[i].x2);
+			r.y2 = max(r.y2, dirty[i].y2);
+			dirty[i] = dirty[--dirty_count];
+			i = -1;
+		}
+	}
+
+	if (dirty_count<COMPOSITOR_MAX_DIRTY)
+	{
+		dirty[dirty_count++] = r;
+		return;
+	}
+
+	// No free slots: grow the rectangle that needs the least extra area
+	best = 0;
+	best_growth = 0x7FFFFFFF;
+	for (int i=0; i<dirty_count; i++)
+	{
+		growth = (long(max(r.x2, dirty[i].x2)-min(r.x1, dirty[i].x1)+1)*(max(r.y2, dirty[i].y2)-min(r.y1, dirty[i].y1)+1))
+				- (long(dirty[i].x2-dirty[i].x1+1)*(dirty[i].y2-dirty[i].y1+1));
+		if (growth<best_growth)
+		{
+			best = i;
+			best_growth = growth;
+		}
+	}
+	r.x1 = min(r.x1, dirty[best].x1);
+	r.y1 = min(r.y1, dirty[best].y1);
+	r.x2 = max(r.x2, dirty[best].x2);
+	r.y2 = max(r.y2, dirty[best].y2);
+	dirty[best] = dirty[--dirty_count];
+	invalidate(r.x1, r.y1, r.x2, r.y2);
+}
+
+void UTFT_Compositor::flush()
+{
+	for (int i=0; i<dirty_count; i++)
+		_render(dirty[i].x1, dirty[i].y1, dirty[i].x2, dirty[i].y2);
+	dirty_count = 0;
+}
+
+void UTFT_Compositor::render()
+{
+	dirty_count = 0;
+	_render(0, 0, _UTFT->getDisplayXSize()-1, _UTFT->getDisplayYSize()-1);
+}
+
+void UTFT_Compositor::setBandHeight(int lines)
+{
+	_band_height = lines;
+}
+
+// Renders the area in tiles that fit the buffer
+void UTFT_Compositor::_render(int x1, int y1, int x2, int y2)
+{
+	int tw, th;
+
+	tw = min(long(x2-x1+1), _buffer_size);
+	th = _buffer_size/tw;
+	if ((_band_height>0) and (_band_height<th))
+		th = _band_height;
+	for (int ty=y1; ty<=y2; ty+=th)
+		for (int tx=x1; tx<=x2; tx+=tw)
+		{
+			_clip.x1 = tx;
+			_clip.y1 = ty;
+			_clip.x2 = min(tx+tw-1, x2);
+			_clip.y2 = min(ty+th-1, y2);
+			_clip_w = _clip.x2-_clip.x1+1;
+
+			for (long i=0; i<(long(_clip_w)*(_clip.y2-_clip.y1+1)); i++)
+				_buffer[i] = _background;
+			for (int i=0; i<COMPOSITOR_MAX_ITEMS; i++)
+				if ((items[i].type!=COMP_NONE) and items[i].visible and
+					(items[i].bbox.x1<=_clip.x2) and (items[i].bbox.x2>=_clip.x1) and
+					(items[i].bbox.y1<=_clip.y2) and (items[i].bbox.y2>=_clip.y1))
+					_render_item(&items[i]);
+			_push(_clip.x1, _clip.y1, _clip.x2, _clip.y2);
+		}
+}
+
+void UTFT_Compositor::_push(int x1, int y1, int x2, int y2)
+{
+	long	pix = long(x2-x1+1)*(y2-y1+1);
+	long	i;
+	word	color;
+
+	for (i=1; i<pix; i++)
+		if (_buffer[i]!=_buffer[0])
+			break;
+	if (i<pix)
+	{
+		_UTFT->_push_rect(x1, y1, x2, y2, _buffer);
+		return;
+	}
+
+	// A single color area is sent as a fill
+	color = _UTFT->getColor();
+	_UTFT->setColor(_buffer[0]);
+	cbi(_UTFT->P_CS, _UTFT->B_CS);
+	_UTFT->_fill_run(x1, y1, x2, y2);
+	sbi(_UTFT->P_CS, _UTFT->B_CS);
+	_UTFT->setColor(color);
+}
+
+void UTFT_Compositor::_render_item(_comp_item *item)
+{
+	switch (item->type)
+	{
+	case COMP_FILLRECT:
+		for (int y=max(min(item->y1, item->y2), _clip.y1); y<=min(max(item->y1, item->y2), _clip.y2); y++)
+			_hspan(item->x1, item->x2, y, item->color);
+		break;
+	case COMP_RECT:
+		_hspan(item->x1, item->x2, item->y1, item->color);
+		_hspan(item->x1, item->x2, item->y2, item->color);
+		_vspan(item->x1, item->y1, item->y2, item->color);
+		_vspan(item->x2, item->y1, item->y2, item->color);
+		break;
+	case COMP_LINE:
+		_line(item->x1, item->y1, item->x2, item->y2, item->color);
+		break;
+	case COMP_CIRCLE:
+		_circle(item->x1, item->y1, item->x2, item->color);
+		break;
+	case COMP_FILLCIRCLE:
+		_fill_circle(item->x1, item->y1, item->x2, item->color);
+		break;
+	case COMP_TEXT:
+		_text(item->text, item->x1, item->y1, item->font, item->color, item->bcolor);
+		break;
+	case COMP_BITMAP:
+		_bitmap(item->x1, item->y1, item->x2, item->y2, item->data);
+		break;
+	}
+}
+
+void UTFT_Compositor::_plot(int x, int y, word color)
+{
+	if ((x>=_clip.x1) and (x<=_clip.x2) and (y>=_clip.y1) and (y<=_clip.y2))
+		_buffer[(long(y-_clip.y1)*_clip_w)+(x-_clip.x1)] = color;
+}
+
+void UTFT_Compositor::_hspan(int x1, int x2, int y, word color)
+{
+	uint16_t *p;
+
+	if ((y<_clip.y1) or (y>_clip.y2))
+		return;
+	if (x1>x2)
+		swap(int, x1, x2);
+	x1 = max(x1, _clip.x1);
+	x2 = min(x2, _clip.x2);
+	p = &_buffer[(long(y-_clip.y1)*_clip_w)+(x1-_clip.x1)];
+	for (int x=x1; x<=x2; x++)
+		*p++ = color;
+}
+
+void UTFT_Compositor::_vspan(int x, int y1, int y2, word color)
+{
+	if (y1>y2)
+		swap(int, y1, y2);
+	for (int y=max(y1, _clip.y1); y<=min(y2, _clip.y2); y++)
+		_plot(x, y, color);
+}
+
+// Same pixels as UTFT::drawLine()
+void UTFT_Compositor::_line(int x1, int y1, int x2, int y2, word color)
+{
+	if (y1==y2)
+		_hspan(x1, x2, y1, color);
+	else if (x1==x2)
+		_vspan(x1, y1, y2, color);
+	else
+	{
+		unsigned int	dx = (x2 > x1 ? x2 - x1 : x1 - x2);
+		short			xstep =  x2 > x1 ? 1 : -1;
+		unsigned int	dy = (y2 > y1 ? y2 - y1 : y1 - y2);
+		short			ystep =  y2 > y1 ? 1 : -1;
+		int				col = x1, row = y1;
+
+		if (dx < dy)
+		{
+			int t = - (dy >> 1);
+			while (true)
+			{
+				_plot(col, row, color);
+				if (row == y2)
+					return;
+				row += ystep;
+				t += dx;
+				if (t >= 0)
+				{
+					col += xstep;
+					t   -= dy;
+				}
+			}
+		}
+		else
+		{
+			int t = - (dx >> 1);
+			while (true)
+			{
+				_plot(col, row, color);
+				if (col == x2)
+					return;
+				col += xstep;
+				t += dy;
+				if (t >= 0)
+				{
+					row += ystep;
+					t   -= dx;
+				}
+			}
+		}
+	}
+}
+
+// Same pixels as UTFT::drawCircle()
+void UTFT_Compositor::_circle(int x, int y, int radius, word color)
+{
+	int f = 1 - radius;
+	int ddF_x = 1;
+	int ddF_y = -2 * radius;
+	int x1 = 0;
+	int y1 = radius;
+
+	_plot(x, y + radius, color);
+	_plot(x, y - radius, color);
+	_plot(x + radius, y, color);
+	_plot(x - radius, y, color);
+	while(x1 < y1)
+	{
+		if(f >= 0) 
+		{
+			y1--;
+			ddF_y += 2;
+			f += ddF_y;
+		}
+		x1++;
+		ddF_x += 2;
+		f += ddF_x;    
+		_plot(x + x1, y + y1, color);
+		_plot(x - x1, y + y1, color);
+		_plot(x + x1, y - y1, color);
+		_plot(x - x1, y - y1, color);
+		_plot(x + y1, y + x1, color);
+		_plot(x - y1, y + x1, color);
+		_plot(x + y1, y - x1, color);
+		_plot(x - y1, y - x1, color);
+	}
+}
+
+// Same pixels as UTFT::fillCircle()
+void UTFT_Compositor::_fill_circle(int x, int y, int radius, word color)
+{
+	for(int y1=-radius; y1<=0; y1++) 
+		for(int x1=-radius; x1<=0; x1++)
+			if(x1*x1+y1*y1 <= radius*radius) 
+			{
+				_hspan(x+x1, x-x1, y+y1, color);
+				_hspan(x+x1, x-x1, y-y1, color);
+				break;
+			}
+}
+
+void UTFT_Compositor::_text(char *st, int x, int y, uint8_t *font, word color, uint32_t bcolor)
+{
+	byte	x_size = pgm_read_byte(&font[0]);
+	byte	y_size = pgm_read_byte(&font[1]);
+	byte	offset = pgm_read_byte(&font[2]);
+	int		bpr = x_size/8;
+	word	temp;
+
+	for (; *st; st++, x+=x_size)
+	{
+		if ((x>_clip.x2) or (x+x_size-1<_clip.x1))
+			continue;
+		temp = ((*st-offset)*(bpr*y_size))+4;
+		for (int j=0; j<y_size; j++, temp+=bpr)
+		{
+			if ((y+j<_clip.y1) or (y+j>_clip.y2))
+				continue;
+			for (int i=0; i<x_size; i++)
+			{
+				if (pgm_read_byte(&font[temp+(i>>3)]) & (0x80>>(i & 7)))
+					_plot(x+i, y+j, color);
+				else if (bcolor!=VGA_TRANSPARENT)
+					_plot(x+i, y+j, bcolor);
+			}
+		}
+	}
+}
+
+void UTFT_Compositor::_bitmap(int x, int y, int sx, int sy, bitmapdatatype data)
+{
+	for (int ty=max(y, _clip.y1); ty<=min(y+sy-1, _clip.y2); ty++)
+		for (int tx=max(x, _clip.x1); tx<=min(x+sx-1, _clip.x2); tx++)
+			_plot(tx, ty, pgm_read_word(&data[((ty-y)*sx)+(tx-x)]));
+}
@@ -0,0 +1,127 @@
+/*
+  UTFT_Compositor.h - Add-on Library for UTFT: Retained mode drawing
+  
+  This library keeps a display list of simple drawing items (rectangles,
+  lines, circles, text and bitmaps) and only redraws the parts of the
+  screen that have changed since the last flush().
+
+  Changing an item marks both its old and new bounding box as dirty.
+  Overlapping dirty rectangles are merged, and flush() renders each of
+  them into a RAM buffer supplied by the sketch before sending it to the
+  display with a single address window. Areas that end up being a single
+  color are sent as a fast fill instead.
+
+  The buffer can be of any size. Larger buffers mean fewer address 
+  windows per flush. A buffer of at least one display line is 
+  recommended.
+
+  render() redraws the whole screen from the display list in horizontal
+  bands, one address window per band. Every pixel is sent once and the
+  intermediate steps of overlapping items are never visible, even on 
+  displays that are too big to be buffered in RAM. setBandHeight() 
+  limits the height of the bands (and of the tiles used by flush()). By
+  default as many lines as fit in the buffer are used.
+
+  Items must be added after InitLCD(). Call invalidateAll() or 
+  setBackground() once to have the whole screen drawn by the first 
+  flush(). Text items keep a pointer to the string; call setText()
+  after changing it. Only fixed width fonts are supported, and addText()
+  returns -1 for a proportional font.
+
+  This library requires the UTFT library.
+*/
+
+#ifndef UTFT_Compositor_h
+#define UTFT_Compositor_h
+
+#include <UTFT.h>
+
+#define COMPOSITOR_MAX_ITEMS	32
+#define COMPOSITOR_MAX_DIRTY	8
+
+#define COMP_NONE			0
+#define COMP_FILLRECT		1
+#define COMP_RECT			2
+#define COMP_LINE			3
+#define COMP_CIRCLE			4
+#define COMP_FILLCIRCLE		5
+#define COMP_TEXT			6
+#define COMP_BITMAP			7
+
+struct _comp_rect
+{
+	int	x1, y1, x2, y2;
+};
+
+struct _comp_item
+{
+	byte		type;
+	boolean		visible;
+	word		color;
+	uint32_t	bcolor;
+	int			x1, y1, x2, y2;
+	char		*text;
+	uint8_t		*font;
+	bitmapdatatype	data;
+	_comp_rect	bbox;
+};
+
+class UTFT_Compositor
+{
+	public:
+		UTFT_Compositor(UTFT *ptrUTFT, uint16_t *buffer, long bufferSize);
+
+		void	setBackground(word color);
+		int		addFillRect(int x1, int y1, int x2, int y2, word color);
+		int		addRect(int x1, int y1, int x2, int y2, word color);
+		int		addLine(int x1, int y1, int x2, int y2, word color);
+		int		addCircle(int x, int y, int radius, word color);
+		int		addFillCircle(int x, int y, int radius, word color);
+		int		addText(char *st, int x, int y, uint8_t *font, word color, uint32_t bcolor=VGA_TRANSPARENT);
+		int		addBitmap(int x, int y, int sx, int sy, bitmapdatatype data);
+		void	setPosition(int id, int x1, int y1, int x2=0, int y2=0);
+		void	setColor(int id, word color);
+		void	setText(int id, char *st);
+		void	setVisible(int id, boolean visible);
+		void	removeAllItems();
+		void	invalidate(int x1, int y1, int x2, int y2);
+		void	invalidateAll();
+		void	flush();
+		void	render();
+		void	setBandHeight(int lines);
+		int		getDirtyCount();
+
+/*
+	The functions and variables below should not normally be used.
+	They have been left publicly available for use by other add-on
+	libraries that render into a RAM buffer.
+*/
+		UTFT		*_UTFT;
+		uint16_t	*_buffer;
+		long		_buffer_size;
+		word		_background;
+		_comp_item	items[COMPOSITOR_MAX_ITEMS];
+		_comp_rect	dirty[COMPOSITOR_MAX_DIRTY];
+		int			dirty_count;
+		_comp_rect	_clip;
+		int			_clip_w;
+		int			_band_height;
+
+		int		_add_item(byte type, int x1, int y1, int x2, int y2, word color);
+		void	_get_bbox(int id, _comp_rect *r);
+		void	_begin_change(int id);
+		void	_end_change(int id);
+		void	_render(int x1, int y1, int x2, int y2);
+		void	_render_item(_comp_item *item);
+		void	_push(int x1, int y1, int x2, int y2);
+		void	_plot(int x, int y, word color);
+		void	_hspan(int x1, int x2, int y, word color);
+		void	_vspan(int x, int y1, int y2, word color);
+		void	_line(int x1, int y1, int x2, int y2, word color);
+		void	_circle(int x, int y, int radius, word color);
+		void	_fill_circle(int x, int y, int radius, word color);
+		void	_text(char *st, int x, int y, uint8_t *font, word color, uint32_t bcolor);
+		void	_bitmap(int x, int y, int sx, int sy, bitmapdatatype data);
+};
+
+#endif
@@ -0,0 +1,103 @@
+// Compositor_Band_Benchmark
+//
+// This program runs on a PC against the UTFT host emulator and draws an
+// 800x480 dashboard screen with overlapping items on an SSD1963, first
+// directly with UTFT and then with UTFT_Compositor::render() using 
+// different band heights.
+//
+// For each method it prints the RAM used for the band buffer, the bus
+// traffic per frame, the number of pixels sent per frame, and the host
+// CPU time used to build and send one frame.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -Wno-write-strings -I../../../../UTFT -I../../.. Compositor_Band_Benchmark.cpp ../../../UTFT_Compositor.cpp ../../../../UTFT/UTFT.cpp -x c ../../../../UTFT/DefaultFonts.c -o bands
+//   ./bands
+//
+
+#include <UTFT.h>
+#include <UTFT_Compositor.h>
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+#define FRAMES		10
+#define LINES		12		// Keeps the display list within COMPOSITOR_MAX_ITEMS
+
+int      bands[] = {1, 2, 4, 8, 16, 32};
+uint16_t buf[800*32];
+char     label[] = "Overlapping panels";
+
+void drawDirect(UTFT &lcd)
+{
+  lcd.setColor(VGA_NAVY);
+  lcd.fillScr(VGA_NAVY);
+  for (int i=0; i<6; i++)
+  {
+    lcd.setColor(VGA_TEAL);
+    lcd.fillRect(40+(i*110), 60, 200+(i*110), 300);
+    lcd.setColor(VGA_WHITE);
+    lcd.drawRect(40+(i*110), 60, 200+(i*110), 300);
+    lcd.setColor(VGA_YELLOW);
+    lcd.fillCircle(120+(i*110), 180, 50);
+  }
+  for (int i=0; i<LINES; i++)
+  {
+    lcd.setColor(VGA_LIME);
+    lcd.drawLine(0, 479-(i*4), 799, 320+(i*4));
+  }
+  lcd.setColor(VGA_WHITE);
+  lcd.setBackColor(VGA_TRANSPARENT);
+  lcd.setFont(BigFont);
+  lcd.print(label, 256, 20);
+}
+
+void buildList(UTFT_Compositor &comp)
+{
+  comp.setBackground(VGA_NAVY);
+  for (int i=0; i<6; i++)
+  {
+    comp.addFillRect(40+(i*110), 60, 200+(i*110), 300, VGA_TEAL);
+    comp.addRect(40+(i*110), 60, 200+(i*110), 300, VGA_WHITE);
+    comp.addFillCircle(120+(i*110), 180, 50, VGA_YELLOW);
+  }
+  for (int i=0; i<LINES; i++)
+    comp.addLine(0, 479-(i*4), 799, 320+(i*4), VGA_LIME);
+  comp.addText(label, 256, 20, BigFont, VGA_WHITE);
+}
+
+void report(const char *method, long ram, unsigned long us)
+{
+  printf("%-14s %8ld %10lu %8lu %10lu %8lu %8.2f\n", method, ram, utft_host.stats.bytes/FRAMES, 
+    utft_host.stats.windows/FRAMES, utft_host.stats.pixels/FRAMES, us/FRAMES, (FRAMES*800.0*480.0)/us);
+}
+
+int main()
+{
+  UTFT          lcd(SSD1963_800, 1, 2, 3, 4, 5);
+  unsigned long t;
+  char          method[16];
+
+  lcd.InitLCD();
+  printf("SSD1963_800, %d frames\n", FRAMES);
+  printf("%-14s %8s %10s %8s %10s %8s %8s\n", "Method", "RAM", "Bytes/frm", "Win/frm", "Pixels/frm", "us/frm", "Mpix/s");
+
+  utft_host.resetStats();
+  t = micros();
+  for (int f=0; f<FRAMES; f++)
+    drawDirect(lcd);
+  report("Direct", 0, micros()-t);
+
+  for (unsigned b=0; b<sizeof(bands)/sizeof(int); b++)
+  {
+    UTFT_Compositor comp(&lcd, buf, 800*bands[b]);
+
+    buildList(comp);
+    utft_host.resetStats();
+    t = micros();
+    for (int f=0; f<FRAMES; f++)
+      comp.render();
+    sprintf(method, "Band %d lines", bands[b]);
+    report(method, 800L*bands[b]*sizeof(uint16_t), micros()-t);
+  }
+  return 0;
+}
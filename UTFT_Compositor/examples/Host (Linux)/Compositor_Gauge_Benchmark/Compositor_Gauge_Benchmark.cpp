@@ -0,0 +1,145 @@
+// Compositor_Gauge_Benchmark
+//
+// This program runs on a PC against the UTFT host emulator and compares
+// the bus traffic needed to animate a simple gauge screen when:
+//   - the whole screen is redrawn for every frame
+//   - only the changed areas are redrawn by UTFT_Compositor
+// The final frame of both methods is compared pixel by pixel.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../../../UTFT -I../../.. Compositor_Gauge_Benchmark.cpp ../../../UTFT_Compositor.cpp ../../../../UTFT/UTFT.cpp -x c ../../../../UTFT/DefaultFonts.c -o gauge
+//   ./gauge
+//
+
+#include <UTFT.h>
+#include <UTFT_Compositor.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+#define FRAMES		100
+#define CX			160
+#define CY			120
+#define RADIUS		90
+
+uint16_t	buf[320*16];
+word		*frame;
+char		title[] = "ENGINE RPM";
+char		value[12];
+
+int needleX(int v) { return CX+((RADIUS-12)*cos((225-(v*27/100))*0.0175)); }
+int needleY(int v) { return CY-((RADIUS-12)*sin((225-(v*27/100))*0.0175)); }
+int rpm(int f) { return 500+(f*37)%800; }
+
+void drawStatic(UTFT &lcd)
+{
+  lcd.setColor(VGA_WHITE);
+  lcd.setBackColor(VGA_TRANSPARENT);
+  lcd.setFont(SmallFont);
+  lcd.print(title, 120, 4);
+  lcd.drawCircle(CX, CY, RADIUS);
+  lcd.drawCircle(CX, CY, RADIUS-2);
+  for (int i=0; i<=10; i++)
+  {
+    double a = (225-(i*27))*0.0175;
+    lcd.drawLine(CX+((RADIUS-10)*cos(a)), CY-((RADIUS-10)*sin(a)), CX+((RADIUS-2)*cos(a)), CY-((RADIUS-2)*sin(a)));
+  }
+  lcd.setColor(VGA_GRAY);
+  lcd.fillRect(20, 220, 300, 232);
+}
+
+void drawFull(UTFT &lcd, int v)
+{
+  lcd.clrScr();
+  drawStatic(lcd);
+  lcd.setColor(VGA_GREEN);
+  lcd.fillRect(20, 220, 20+(v*28/100), 232);
+  lcd.setColor(VGA_RED);
+  lcd.drawLine(CX, CY, needleX(v), needleY(v));
+  lcd.setColor(VGA_SILVER);
+  lcd.fillCircle(CX, CY, 6);
+  lcd.setColor(VGA_YELLOW);
+  lcd.setBackColor(VGA_BLACK);
+  lcd.setFont(BigFont);
+  sprintf(value, "%4d", v*10);
+  lcd.print(value, 128, 170);
+}
+
+unsigned long run(boolean compositor)
+{
+  UTFT            lcd(ILI9341_S5P, 1, 2, 3, 4, 5);
+  UTFT_Compositor comp(&lcd, buf, sizeof(buf)/sizeof(uint16_t));
+  int             needle, bar, text;
+  unsigned long   bytes=0, windows=0;
+
+  lcd.InitLCD();
+  lcd.clrScr();
+  if (compositor)
+  {
+    comp.addText(title, 120, 4, SmallFont, VGA_WHITE);
+    comp.addCircle(CX, CY, RADIUS, VGA_WHITE);
+    comp.addCircle(CX, CY, RADIUS-2, VGA_WHITE);
+    for (int i=0; i<=10; i++)
+    {
+      double a = (225-(i*27))*0.0175;
+      comp.addLine(CX+((RADIUS-10)*cos(a)), CY-((RADIUS-10)*sin(a)), CX+((RADIUS-2)*cos(a)), CY-((RADIUS-2)*sin(a)), VGA_WHITE);
+    }
+    comp.addFillRect(20, 220, 300, 232, VGA_GRAY);
+    bar = comp.addFillRect(20, 220, 20, 232, VGA_GREEN);
+    needle = comp.addLine(CX, CY, CX, CY, VGA_RED);
+    comp.addFillCircle(CX, CY, 6, VGA_SILVER);
+    sprintf(value, "%4d", 0);
+    text = comp.addText(value, 128, 170, BigFont, VGA_YELLOW, VGA_BLACK);
+    comp.invalidateAll();
+    comp.flush();
+  }
+
+  for (int f=0; f<FRAMES; f++)
+  {
+    int v = rpm(f)/10;
+
+    utft_host.resetStats();
+    if (compositor)
+    {
+      comp.setPosition(bar, 20, 220, 20+(v*28/100), 232);
+      comp.setPosition(needle, CX, CY, needleX(v), needleY(v));
+      sprintf(value, "%4d", v*10);
+      comp.setText(text, value);
+      comp.flush();
+    }
+    else
+      drawFull(lcd, v);
+    bytes += utft_host.stats.bytes;
+    windows += utft_host.stats.windows;
+  }
+  printf("%-22s %10lu %10lu\n", compositor ? "Dirty rectangles" : "Full redraw", bytes/FRAMES, windows/FRAMES);
+
+  if (!compositor)
+  {
+    frame = (word *)malloc(320*240*sizeof(word));
+    for (int y=0; y<240; y++)
+      for (int x=0; x<320; x++)
+        frame[(y*320)+x] = utft_host.getPixel(x, y);
+    return 0;
+  }
+  else
+  {
+    unsigned long diff = 0;
+
+    for (int y=0; y<240; y++)
+      for (int x=0; x<320; x++)
+        if (frame[(y*320)+x] != utft_host.getPixel(x, y))
+          diff++;
+    return diff;
+  }
+}
+
+int main()
+{
+  printf("ILI9341_S5P, %d frames\n", FRAMES);
+  printf("%-22s %10s %10s\n", "Method", "Bytes/frm", "Windows/frm");
+  run(false);
+  printf("Pixels differing in last frame: %lu\n", run(true));
+  return 0;
+}
@@ -0,0 +1,308 @@
+/*
+  UTFT_Queue.cpp - Add-on Library for UTFT: Non-blocking drawing
+
+  This library requires the UTFT library.
+*/
+
+#include "UTFT_Queue.h"
+
+// Keeps the compiler from moving the stores to a command after the store
+// that hands it to drain(), which may run in an interrupt
+#define QUEUE_BARRIER()		__asm__ __volatile__("" ::: "memory")
+
+UTFT_Queue::UTFT_Queue(UTFT *ptrUTFT)
+{
+	_UTFT = ptrUTFT;
+	_head = 0;
+	_tail = 0;
+	_busy = false;
+	for (int i=0; i<=QUEUE_BITMAP; i++)
+		_ns_per_16px[i] = QUEUE_NS_PER_PIXEL*16;
+	resetStats();
+}
+
+_queue_cmd* UTFT_Queue::_new_cmd(byte type, int x1, int y1, int x2, int y2, word color)
+{
+	_queue_cmd *c = &_cmds[_head];
+
+	if (((_head+1)%QUEUE_SIZE)==_tail)
+		return 0;
+	c->type = type;
+	c->color = color;
+	c->bcolor = VGA_TRANSPARENT;
+	c->x1 = x1;
+	c->y1 = y1;
+	c->x2 = x2;
+	c->y2 = y2;
+	c->pos = 0;
+	c->text = 0;
+	c->font = 0;
+	c->data = 0;
+	return c;
+}
+
+void UTFT_Queue::_add_cmd()
+{
+	int used;
+
+	_cmds[_head].queued = micros();
+	QUEUE_BARRIER();
+	_head = (_head+1)%QUEUE_SIZE;
+	used = getQueued();
+	if (used>stats.max_used)
+		stats.max_used = used;
+}
+
+boolean UTFT_Queue::clrScr()
+{
+	return fillScr(VGA_BLACK);
+}
+
+boolean UTFT_Queue::fillScr(word color)
+{
+	return fillRect(0, 0, _UTFT->getDisplayXSize()-1, _UTFT->getDisplayYSize()-1, color);
+}
+
+boolean UTFT_Queue::drawPixel(int x, int y, word color)
+{
+	if (!_new_cmd(QUEUE_PIXEL, x, y, x, y, color))
+		return false;
+	_add_cmd();
+	return true;
+}
+
+boolean UTFT_Queue::drawLine(int x1, int y1, int x2, int y2, word color)
+{
+	if (!_new_cmd(QUEUE_LINE, x1, y1, x2, y2, color))
+		return false;
+	_add_cmd();
+	return true;
+}
+
+boolean UTFT_Queue::drawRect(int x1, int y1, int x2, int y2, word color)
+{
+	if (!_new_cmd(QUEUE_RECT, x1, y1, x2, y2, color))
+		return false;
+	_add_cmd();
+	return true;
+}
+
+boolean UTFT_Queue::fillRect(int x1, int y1, int x2, int y2, word color)
+{
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+	if (!_new_cmd(QUEUE_FILLRECT, x1, y1, x2, y2, color))
+		return false;
+	_add_cmd();
+	return true;
+}
+
+// The text is drawn in slices, so RIGHT and CENTER are turned into the
+// position of the first character here, with the width in the given font
+boolean UTFT_Queue::print(char *st, int x, int y, uint8_t *font, word color, uint32_t bcolor)
+{
+	_queue_cmd *c;
+
+	if ((x==RIGHT) or (x==CENTER))
+	{
+		uint8_t	*old = _UTFT->getFont();
+		int		w;
+
+		_UTFT->setFont(font);
+		w = _UTFT->getDisplayXSize()-_UTFT->getTextWidth(st);
+		if (old)
+			_UTFT->setFont(old);
+		x = (x==RIGHT) ? w : w/2;
+	}
+	c = _new_cmd(QUEUE_TEXT, x, y, strlen(st), 0, color);
+	if (!c)
+		return false;
+	c->text = st;
+	c->font = font;
+	c->bcolor = bcolor;
+	_add_cmd();
+	return true;
+}
+
+boolean UTFT_Queue::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data)
+{
+	_queue_cmd *c = _new_cmd(QUEUE_BITMAP, x, y, sx, sy, 0);
+
+	if (!c)
+		return false;
+	c->data = data;
+	_add_cmd();
+	return true;
+}
+
+int UTFT_Queue::getQueued()
+{
+	return (_head+QUEUE_SIZE-_tail)%QUEUE_SIZE;
+}
+
+// Draws slices until the budget (in microseconds) is used up or the queue
+// is empty. Returns true when the queue is empty.
+boolean UTFT_Queue::drain(unsigned long budget)
+{
+	unsigned long	start, t, used = 0;
+	word			color, bcolor;
+	boolean			transparent;
+	uint8_t			*font;
+
+	if (_busy or (_tail==_head))
+		return _tail==_head;
+	_busy = true;
+	start = micros();
+	color = _UTFT->getColor();
+	bcolor = _UTFT->getBackColor();
+	transparent = _UTFT->_transparent;
+	font = _UTFT->getFont();
+
+	while (_tail!=_head)
+	{
+		_queue_cmd	*c = &_cmds[_tail];
+		long		*ns = &_ns_per_16px[c->type];
+		long		pixels;
+
+		t = micros();
+		pixels = _slice(c, (min(budget-used, 100000UL)*16000)/(*ns));
+		used = micros();
+		// Short slices are too coarse for the clock
+		if (pixels>=64)
+		{
+			*ns = ((*ns*3)+(((used-t)*16000)/pixels)+3)/4;
+			if (*ns<1)
+				*ns = 1;
+		}
+		stats.slices++;
+		if (c->pos<0)
+		{
+			if (used-c->queued>stats.max_wait_us)
+				stats.max_wait_us = used-c->queued;
+			stats.commands++;
+			_tail = (_tail+1)%QUEUE_SIZE;
+		}
+		used -= start;
+		if (used>=budget)
+			break;
+	}
+
+	_UTFT->setColor(color);
+	if (transparent)
+		_UTFT->setBackColor(VGA_TRANSPARENT);
+	else
+		_UTFT->setBackColor(bcolor);
+	if (font)
+		_UTFT->setFont(font);
+	used = micros()-start;
+	stats.drains++;
+	stats.last_drain_us = used;
+	if (used>stats.max_drain_us)
+		stats.max_drain_us = used;
+	if (used>budget)
+		stats.overruns++;
+	_busy = false;
+	return _tail==_head;
+}
+
+void UTFT_Queue::flush()
+{
+	while (!drain(50000))
+		;
+}
+
+// Draws the next part of a command, about the given number of pixels but
+// at least one row or character. Returns the number of pixels drawn and
+// sets pos to -1 when the command is finished.
+long UTFT_Queue::_slice(_queue_cmd *c, long pixels)
+{
+	char	st[17];
+	int		w, n, fw, fh;
+
+	_UTFT->setColor(c->color);
+	switch (c->type)
+	{
+	case QUEUE_PIXEL:
+		_UTFT->drawPixel(c->x1, c->y1);
+		c->pos = -1;
+		return 1;
+	case QUEUE_LINE:
+		_UTFT->drawLine(c->x1, c->y1, c->x2, c->y2);
+		c->pos = -1;
+		return max(abs(c->x2-c->x1), abs(c->y2-c->y1))+1;
+	case QUEUE_RECT:
+		_UTFT->drawRect(c->x1, c->y1, c->x2, c->y2);
+		c->pos = -1;
+		return 2*(abs(c->x2-c->x1)+abs(c->y2-c->y1));
+	case QUEUE_FILLRECT:
+		w = c->x2-c->x1+1;
+		n = constrain(pixels/w, 1, c->y2-c->y1+1-c->pos);
+		_UTFT->fillRect(c->x1, c->y1+c->pos, c->x2, c->y1+c->pos+n-1);
+		c->pos += n;
+		if (c->pos>c->y2-c->y1)
+			c->pos = -1;
+		return long(w)*n;
+	case QUEUE_TEXT:
+		if (c->x2==0)
+			break;
+		_UTFT->setFont(c->font);
+		_UTFT->setBackColor(c->bcolor);
+		fh = _UTFT->getFontYsize();
+		if (_UTFT->cfont.bpp!=0)
+		{
+			_UTFT->print(c->text, c->x1, c->y1);
+			c->pos = -1;
+			return long(_UTFT->getTextWidth(c->text))*fh;
+		}
+		fw = _UTFT->getFontXsize();
+		n = constrain(pixels/(fw*fh), 1, min(c->x2-c->pos, 16));
+		memcpy(st, &c->text[c->pos], n);
+		st[n] = 0;
+		_UTFT->print(st, c->x1+(c->pos*fw), c->y1);
+		c->pos += n;
+		if (c->pos>=c->x2)
+			c->pos = -1;
+		return long(n)*fw*fh;
+	case QUEUE_BITMAP:
+		if ((c->x2<=0) or (c->y2<=0))
+			break;
+		n = constrain(pixels/c->x2, 1, c->y2-c->pos);
+		_UTFT->drawBitmap(c->x1, c->y1+c->pos, c->x2, n, &c->data[long(c->pos)*c->x2]);
+		c->pos += n;
+		if (c->pos>=c->y2)
+			c->pos = -1;
+		return long(c->x2)*n;
+	}
+	c->pos = -1;
+	return 0;
+}
+
+void UTFT_Queue::loopMark()
+{
+	unsigned long now = micros();
+
+	if ((stats.loops>0) and (now-_last_mark>stats.max_loop_us))
+		stats.max_loop_us = now-_last_mark;
+	_last_mark = now;
+	stats.loops++;
+}
+
+void UTFT_Queue::resetStats()
+{
+	stats.commands = 0;
+	stats.slices = 0;
+	stats.drains = 0;
+	stats.overruns = 0;
+	stats.last_drain_us = 0;
+	stats.max_drain_us = 0;
+	stats.max_wait_us = 0;
+	stats.loops = 0;
+	stats.max_loop_us = 0;
+	stats.max_used = getQueued();
+}
@@ -0,0 +1,135 @@
+/*
+  UTFT_Queue.h - Add-on Library for UTFT: Non-blocking drawing
+
+  Every UTFT function returns when the last pixel has been sent, so a
+  fillScr() keeps the sketch from polling buttons or receivers for as
+  long as the bus needs to send a whole screen. This library puts the
+  drawing commands in a queue instead, and drain() sends them a slice at
+  a time until a time budget is used up:
+
+    void loop()
+    {
+      queue.loopMark();
+      readKeypad();
+      ...
+      queue.fillScr(VGA_BLUE);
+      queue.drain(500);		// At most about 500 microseconds of drawing
+    }
+
+  Large commands are cut into slices: rows of rectangles and bitmaps,
+  characters of text. The size of a slice comes from the time per pixel
+  measured on the earlier slices of the same kind of command, so a
+  slice normally ends within the budget. At least one slice is drawn by
+  every call, and a slice of a text in a proportional font is the whole
+  text.
+
+  drain() can also be called from a timer interrupt (TimerOne, DueTimer
+  and similar). The queue can be filled by the sketch while it is
+  drained by the interrupt, but all drawing must then go through the
+  queue, as the interrupt can occur in the middle of a UTFT function.
+  Calls to drain() while it is running return at once.
+
+  The commands keep a pointer to the text or bitmap, which must stay
+  unchanged until it has been drawn. The add functions return false
+  when the queue is full.
+
+  stats keeps the time spent in the longest drain(), the number of
+  drain() calls that ran past their budget, the longest time between
+  queueing a command and the end of its drawing and, if loopMark() is
+  called once per loop(), the longest time between two loop()
+  iterations. Disable interrupts while reading stats on AVR when the
+  queue is drained by an interrupt.
+
+  This library requires the UTFT library.
+*/
+
+#ifndef UTFT_Queue_h
+#define UTFT_Queue_h
+
+#include <UTFT.h>
+
+#if !defined(QUEUE_SIZE)
+	#if defined(__AVR__)
+		#define QUEUE_SIZE		16
+	#else
+		#define QUEUE_SIZE		64
+	#endif
+#endif
+// First guess of the time needed to send a pixel, in nanoseconds
+#if !defined(QUEUE_NS_PER_PIXEL)
+	#if defined(__AVR__)
+		#define QUEUE_NS_PER_PIXEL	1000
+	#else
+		#define QUEUE_NS_PER_PIXEL	100
+	#endif
+#endif
+
+#define QUEUE_PIXEL			1
+#define QUEUE_LINE			2
+#define QUEUE_RECT			3
+#define QUEUE_FILLRECT		4
+#define QUEUE_TEXT			5
+#define QUEUE_BITMAP		6
+
+struct _queue_cmd
+{
+	byte			type;
+	word			color;
+	uint32_t		bcolor;
+	int				x1, y1, x2, y2;		// Text and bitmaps: x2,y2 is the size
+	int				pos;				// Next row or character
+	char			*text;
+	uint8_t			*font;
+	bitmapdatatype	data;
+	unsigned long	queued;
+};
+
+struct _queue_stats
+{
+	unsigned long	commands;			// Commands drawn
+	unsigned long	slices;
+	unsigned long	drains;
+	unsigned long	overruns;			// drain() calls that ran past the budget
+	unsigned long	last_drain_us, max_drain_us;
+	unsigned long	max_wait_us;		// From queueing to the end of drawing
+	unsigned long	loops, max_loop_us;	// Measured by loopMark()
+	byte			max_used;			// Most commands in the queue
+};
+
+class UTFT_Queue
+{
+	public:
+		UTFT_Queue(UTFT *ptrUTFT);
+
+		boolean	clrScr();
+		boolean	fillScr(word color);
+		boolean	drawPixel(int x, int y, word color);
+		boolean	drawLine(int x1, int y1, int x2, int y2, word color);
+		boolean	drawRect(int x1, int y1, int x2, int y2, word color);
+		boolean	fillRect(int x1, int y1, int x2, int y2, word color);
+		boolean	print(char *st, int x, int y, uint8_t *font, word color, uint32_t bcolor=VGA_TRANSPARENT);
+		boolean	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data);
+		boolean	drain(unsigned long budget);
+		void	flush();
+		int		getQueued();
+		void	loopMark();
+		void	resetStats();
+
+		_queue_stats	stats;
+
+/*
+	The functions and variables below should not normally be used.
+*/
+		UTFT			*_UTFT;
+		_queue_cmd		_cmds[QUEUE_SIZE];
+		volatile byte	_head, _tail;
+		volatile boolean	_busy;
+		long			_ns_per_16px[QUEUE_BITMAP+1];	// For each type of command
+		unsigned long	_last_mark;
+
+		_queue_cmd*	_new_cmd(byte type, int x1, int y1, int x2, int y2, word color);
+		void	_add_cmd();
+		long	_slice(_queue_cmd *c, long pixels);
+};
+
+#endif
@@ -0,0 +1,92 @@
+// Queue_TimerOne
+//
+// This program redraws the screen once per second through UTFT_Queue.
+// The queue is drained by a timer interrupt, 1 ms of drawing every 10 ms,
+// while loop() keeps polling a button on pin 2. Every 5 seconds the
+// longest time between two loop() iterations, the longest drain() and
+// the longest wait of a command are sent to the serial port at 115200
+// baud.
+//
+// To drain the queue from loop() instead, remove the timer and call
+//   myQueue.drain(1000);
+// at the end of loop().
+//
+// This program requires the UTFT, UTFT_Queue and TimerOne libraries.
+//
+
+#include <UTFT.h>
+#include <UTFT_Queue.h>
+#include <TimerOne.h>
+
+// Declare which fonts we will be using
+extern uint8_t BigFont[];
+
+// Uncomment the line for your display:
+//UTFT myGLCD(ITDB32S,38,39,40,41);                // ITead ITDB02-3.2S
+//UTFT myGLCD(MI0283QT9,11,13,7,8);                // Watterott MI0283QT9
+//UTFT myGLCD(DMTFT28105,MOSI,SCK,10,NOTINUSE,9);  // DisplayModule DM-TFT28-105 (Works with both Arduino Uno and Arduino Mega)
+UTFT myGLCD(TFT22SHLD,3,4,7,5,6);                  // ElecFreaks TFT2.2SP Shield
+
+UTFT_Queue myQueue(&myGLCD);
+
+word          colors[] = {VGA_NAVY, VGA_MAROON, VGA_TEAL, VGA_PURPLE};
+char          text[] = "Button:  ";
+long          presses = 0;
+int           last_button = HIGH;
+unsigned long next_screen = 0, next_report = 5000;
+
+void drawTick()
+{
+  myQueue.drain(1000);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  pinMode(2, INPUT_PULLUP);
+  myGLCD.InitLCD();
+  Timer1.initialize(10000);
+  Timer1.attachInterrupt(drawTick);
+}
+
+void loop()
+{
+  int           button = digitalRead(2);
+  _queue_stats  s;
+
+  myQueue.loopMark();
+  if ((button==LOW) and (last_button==HIGH))
+    presses++;
+  last_button = button;
+
+  if (millis()>=next_screen)
+  {
+    int w = myGLCD.getDisplayXSize(), h = myGLCD.getDisplayYSize();
+    word back = colors[(next_screen/1000) % 4];
+
+    // Everything is drawn through the queue, as the interrupt may come
+    // in the middle of a UTFT function
+    text[8] = '0'+(presses % 10);
+    myQueue.fillScr(back);
+    myQueue.drawRect(10, 10, w-11, h-11, VGA_WHITE);
+    myQueue.print(text, 20, (h/2)-8, BigFont, VGA_YELLOW, back);
+    next_screen += 1000;
+  }
+
+  if (millis()>=next_report)
+  {
+    noInterrupts();
+    s = myQueue.stats;
+    myQueue.resetStats();
+    interrupts();
+    Serial.print("Longest loop: ");
+    Serial.print(s.max_loop_us);
+    Serial.print(" us, longest drain: ");
+    Serial.print(s.max_drain_us);
+    Serial.print(" us, longest wait: ");
+    Serial.print(s.max_wait_us);
+    Serial.print(" us, overruns: ");
+    Serial.println(s.overruns);
+    next_report += 5000;
+  }
+}
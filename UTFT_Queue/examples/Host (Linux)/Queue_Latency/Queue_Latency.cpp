@@ -0,0 +1,164 @@
+// Queue_Latency
+//
+// This program runs on a PC against the UTFT host emulator and measures
+// how long loop() is kept from polling its inputs when a sketch redraws
+// the screen every 200 iterations:
+//   - drawing directly with UTFT
+//   - queueing the drawing with UTFT_Queue and draining it with budgets
+//     of 1000, 250 and 100 microseconds per loop()
+// The final screen of every run is compared pixel by pixel with the
+// screen drawn directly.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -Wno-write-strings -I../../../../UTFT -I../../.. Queue_Latency.cpp ../../../UTFT_Queue.cpp ../../../../UTFT/UTFT.cpp -x c ../../../../UTFT/DefaultFonts.c -o latency
+//   ./latency
+//
+// The times are those of the emulator on the PC, which is much faster
+// than a real bus, but their ratios are the same. The PC can also stop
+// the program at any time, which adds to the overruns. The screen is
+// saved as queue.ppm.
+//
+
+#include <UTFT.h>
+#include <UTFT_Queue.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+#define LOOPS		2000
+#define SCENE_EVERY	200
+#define BW			160
+#define BH			120
+
+UTFT            myGLCD(ILI9481, 38, 39, 40, 41);
+UTFT_Queue      myQueue(&myGLCD);
+
+unsigned short  picture[BW*BH];
+word            frame[320*480];
+char            *lines[] = {"Queued drawing", "does not block", "the loop", "for more than", "its budget"};
+char            counter[32];
+word            colors[] = {VGA_NAVY, VGA_MAROON, VGA_TEAL, VGA_PURPLE, VGA_OLIVE};
+volatile long   polls;
+int             errors = 0;
+
+// Everything is drawn either directly or through the queue
+void scene(int n, boolean queued)
+{
+  word back = colors[n % 5];
+
+  sprintf(counter, "Scene %d of the latency test", n);
+  if (queued)
+  {
+    myQueue.fillScr(back);
+    myQueue.drawBitmap(40, 20+(n % 3)*10, BW, BH, picture);
+    for (int i=0; i<5; i++)
+      myQueue.print(lines[i], 8, 170+(i*20), BigFont, VGA_WHITE, back);
+    myQueue.print(counter, CENTER, 4, SmallFont, VGA_YELLOW);
+    myQueue.drawRect(39, 19+(n % 3)*10, 40+BW, 20+BH+(n % 3)*10, VGA_WHITE);
+    myQueue.drawLine(0, 479, 319, 400, VGA_LIME);
+    myQueue.drawPixel(n, 10, VGA_RED);
+  }
+  else
+  {
+    myGLCD.fillScr(back);
+    myGLCD.drawBitmap(40, 20+(n % 3)*10, BW, BH, picture);
+    myGLCD.setFont(BigFont);
+    myGLCD.setColor(VGA_WHITE);
+    myGLCD.setBackColor(back);
+    for (int i=0; i<5; i++)
+      myGLCD.print(lines[i], 8, 170+(i*20));
+    myGLCD.setFont(SmallFont);
+    myGLCD.setColor(VGA_YELLOW);
+    myGLCD.setBackColor(VGA_TRANSPARENT);
+    myGLCD.print(counter, CENTER, 4);
+    myGLCD.setColor(VGA_WHITE);
+    myGLCD.drawRect(39, 19+(n % 3)*10, 40+BW, 20+BH+(n % 3)*10);
+    myGLCD.setColor(VGA_LIME);
+    myGLCD.drawLine(0, 479, 319, 400);
+    myGLCD.setColor(VGA_RED);
+    myGLCD.drawPixel(n, 10);
+  }
+}
+
+void run(long budget)
+{
+  unsigned long t, last = 0, max_loop = 0;
+
+  myGLCD.InitLCD(PORTRAIT);
+  myQueue.resetStats();
+  for (int i=0; i<LOOPS; i++)
+  {
+    // loop()
+    myQueue.loopMark();
+    t = micros();
+    if ((i>0) and (t-last>max_loop))
+      max_loop = t-last;
+    last = t;
+    polls++;                      // Read the keypad
+    if ((i % SCENE_EVERY)==0)
+      scene(i/SCENE_EVERY, budget>0);
+    if (budget>0)
+      myQueue.drain(budget);
+  }
+  myQueue.flush();
+
+  if (budget==0)
+  {
+    printf("%-16s %10lu %10s %10s %10s\n", "Direct", max_loop, "-", "-", "-");
+    for (int y=0; y<480; y++)
+      for (int x=0; x<320; x++)
+        frame[(y*320)+x] = utft_host.getPixel(x, y);
+    return;
+  }
+
+  long diff = 0;
+
+  for (int y=0; y<480; y++)
+    for (int x=0; x<320; x++)
+      if (frame[(y*320)+x]!=utft_host.getPixel(x, y))
+        diff++;
+  printf("Queue, %4ld us   %10lu %10lu %10lu %10lu\n", budget, myQueue.stats.max_loop_us,
+    myQueue.stats.max_drain_us, myQueue.stats.overruns, myQueue.stats.max_wait_us);
+  if (diff)
+  {
+    printf("FAILED: %ld pixels differ from direct drawing\n", diff);
+    errors++;
+  }
+  if (myQueue.stats.commands!=(LOOPS/SCENE_EVERY)*11)
+  {
+    printf("FAILED: %lu commands drawn\n", myQueue.stats.commands);
+    errors++;
+  }
+}
+
+int main()
+{
+  for (int y=0; y<BH; y++)
+    for (int x=0; x<BW; x++)
+      picture[(y*BW)+x] = ((x*31/BW)<<11) | ((y*63/BH)<<5) | ((x+y) & 31);
+
+  printf("ILI9481, %d loops, a new screen every %d loops\n", LOOPS, SCENE_EVERY);
+  printf("%-16s %10s %10s %10s %10s\n", "Method", "Max loop", "Max drain", "Overruns", "Max wait");
+  run(0);
+  run(1000);
+  run(250);
+  run(100);
+  printf("Times in microseconds\n");
+  utft_host.savePPM("queue.ppm");
+
+  // The queue refuses commands when it is full and drain() ends at once
+  // when nothing is queued
+  myQueue.flush();
+  int queued = 0;
+  while (myQueue.drawPixel(queued, 0, VGA_WHITE))
+    queued++;
+  if ((queued!=QUEUE_SIZE-1) or (myQueue.getQueued()!=QUEUE_SIZE-1) or !myQueue.drain(1000000) or (myQueue.getQueued()!=0))
+  {
+    printf("FAILED: queue of %d commands\n", queued);
+    errors++;
+  }
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}
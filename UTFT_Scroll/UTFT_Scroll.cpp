@@ -0,0 +1,269 @@
+/*
+  UTFT_Scroll.cpp - Add-on Library for UTFT: Scrolling console and chart
+
+  This library requires the UTFT library.
+*/
+
+#include "UTFT_Scroll.h"
+
+// *** UTFT_Console ***
+UTFT_Console::UTFT_Console(UTFT *ptrUTFT)
+{
+	_UTFT = ptrUTFT;
+	_lines = 0;
+}
+
+// Uses the screen lines from first to last for the console. The area is
+// shortened to a whole number of text lines.
+void UTFT_Console::begin(int first, int last)
+{
+	if (first>last)
+		swap(int, first, last);
+	_line_height = _UTFT->getFontYsize();
+	_lines = (last-first+1) / _line_height;
+	_first = first;
+	_len = _lines * _line_height;
+	_hw_scroll = false;
+	if ((_lines>0) and (_UTFT->getScrollAxis()==SCROLL_Y))
+		_hw_scroll = _UTFT->setScrollArea(_first, _first+_len-1);
+	clear();
+}
+
+void UTFT_Console::clear()
+{
+	_row = 0;
+	_col = 0;
+	_offset = 0;
+	if (_lines==0)
+		return;
+	if (_hw_scroll)
+		_UTFT->scrollTo(0);
+	for (int i=0; i<_lines; i++)
+		_clear_line(i);
+}
+
+int UTFT_Console::getLines()
+{
+	return _lines;
+}
+
+// Screen line of text line row in GRAM
+int UTFT_Console::_line_y(int row)
+{
+	return _first + (((row*_line_height) + _offset) % _len);
+}
+
+void UTFT_Console::_clear_line(int row)
+{
+	word	color = _UTFT->getColor();
+	int		y = _line_y(row);
+
+	_UTFT->setColor(_UTFT->_transparent ? VGA_BLACK : _UTFT->getBackColor());
+	_UTFT->fillRect(0, y, _UTFT->getDisplayXSize()-1, y+_line_height-1);
+	_UTFT->setColor(color);
+}
+
+// Moves to the start of the next line. When the console is full the 
+// oldest line is scrolled out and reused for the new line.
+void UTFT_Console::_newline()
+{
+	_col = 0;
+	if (_row<_lines-1)
+		_row++;
+	else if (_hw_scroll)
+	{
+		_offset = (_offset+_line_height) % _len;
+		_UTFT->scrollTo(_offset);
+	}
+	else
+		_row = 0;
+	_clear_line(_row);
+}
+
+// Prints st at the current position. Long lines wrap to the next line, and 
+// '\n' starts a new line. Consecutive characters on the same line are 
+// printed with a single call to UTFT::print().
+void UTFT_Console::print(char *st)
+{
+	char	buf[CONSOLE_SEGMENT+1];
+	int		n = 0, x = 0;
+	int		fw = _UTFT->getFontXsize();
+	int		cols = _UTFT->getDisplayXSize()/fw;
+
+	if (_lines==0)
+		return;
+	for (;; st++)
+	{
+		if ((n>0) and ((*st==0) or (*st=='\n') or (*st=='\r') or (_col>=cols) or (n==CONSOLE_SEGMENT)))
+		{
+			buf[n] = 0;
+			_UTFT->print(buf, x, _line_y(_row));
+			n = 0;
+		}
+		if (*st==0)
+			break;
+		if (*st=='\n')
+		{
+			_newline();
+			continue;
+		}
+		if (*st=='\r')
+		{
+			_col = 0;
+			continue;
+		}
+		if (_col>=cols)
+			_newline();
+		if (n==0)
+			x = _col*fw;
+		buf[n++] = *st;
+		_col++;
+	}
+}
+
+void UTFT_Console::println(char *st)
+{
+	print(st);
+	_newline();
+}
+
+// *** UTFT_Chart ***
+UTFT_Chart::UTFT_Chart(UTFT *ptrUTFT)
+{
+	_UTFT = ptrUTFT;
+	_len = 0;
+	_grid = 0;
+	_trace = VGA_LIME;
+	_background = VGA_BLACK;
+	_grid_color = VGA_GRAY;
+}
+
+// Uses the lines from first to last along the scroll axis for the chart.
+// Values from minValue to maxValue use the full screen across it.
+void UTFT_Chart::begin(int first, int last, int minValue, int maxValue)
+{
+	if (first>last)
+		swap(int, first, last);
+	_axis = _UTFT->getScrollAxis();
+	_hw_scroll = false;
+	if (_axis==SCROLL_NONE)
+		_axis = SCROLL_X;
+	else
+		_hw_scroll = _UTFT->setScrollArea(first, last);
+	_first = first;
+	_len = last-first+1;
+	_size = (_axis==SCROLL_X) ? _UTFT->getDisplayYSize() : _UTFT->getDisplayXSize();
+	_min = minValue;
+	_max = (maxValue>minValue) ? maxValue : minValue+1;
+	clear();
+}
+
+void UTFT_Chart::setColors(word trace, word background, word grid)
+{
+	_trace = trace;
+	_background = background;
+	_grid_color = grid;
+}
+
+// Draws a grid line along the time axis every spacing pixels. Call clear()
+// or begin() afterwards to draw the grid.
+void UTFT_Chart::setGrid(int spacing)
+{
+	_grid = (spacing>0) ? spacing : 0;
+}
+
+void UTFT_Chart::clear()
+{
+	_pos = 0;
+	_last = -1;
+	if (_len==0)
+		return;
+	if (_hw_scroll)
+		_UTFT->scrollTo(0);
+	for (int i=0; i<_len; i++)
+		_line(i, -1, -1);
+}
+
+int UTFT_Chart::_value_pixel(int value)
+{
+	if (value<_min)
+		value = _min;
+	if (value>_max)
+		value = _max;
+	return (long(value-_min)*(_size-1)) / (_max-_min);
+}
+
+// Adds a sample at the end of the chart. It is connected to the previous
+// sample with a line across the value axis.
+void UTFT_Chart::addSample(int value)
+{
+	int	p = _value_pixel(value);
+	int	a = p, b = p;
+
+	if (_len==0)
+		return;
+	if (_last>=0)
+	{
+		a = min(p, _last);
+		b = max(p, _last);
+	}
+	_last = p;
+
+	_pos = (_pos+1) % _len;
+	if (_hw_scroll)
+	{
+		// The line that scrolled out at the start is shown at the end
+		_UTFT->scrollTo(_pos);
+		_line((_pos+_len-1) % _len, a, b);
+	}
+	else
+		_line(_pos, a, b);
+}
+
+// Draws one line of the chart at pos (from the start of the chart area in
+// GRAM) with the trace from value pixel a to b, as a single window.
+void UTFT_Chart::_line(int pos, int a, int b)
+{
+	int		u = _first+pos;
+	int		v, dir, n;
+	word	color, run_color;
+
+	cbi(_UTFT->P_CS, _UTFT->B_CS);
+	if (_axis==SCROLL_X)
+		_UTFT->setXY(u, 0, u, _size-1);
+	else
+		_UTFT->setXY(0, u, _size-1, u);
+
+	// Values increase upwards and to the right. Columns are filled from 
+	// the top, rows from the left (from the right in landscape mode).
+	if ((_axis==SCROLL_X) or (_UTFT->orient==LANDSCAPE))
+	{
+		v = _size-1;
+		dir = -1;
+	}
+	else
+	{
+		v = 0;
+		dir = 1;
+	}
+	n = 0;
+	run_color = 0;
+	for (int i=0; i<_size; i++, v+=dir)
+	{
+		if ((v>=a) and (v<=b))
+			color = _trace;
+		else if ((_grid>0) and ((v % _grid)==0))
+			color = _grid_color;
+		else
+			color = _background;
+		if ((n>0) and (color!=run_color))
+		{
+			_UTFT->_write_run(run_color>>8, run_color & 0xFF, n);
+			n = 0;
+		}
+		run_color = color;
+		n++;
+	}
+	_UTFT->_write_run(run_color>>8, run_color & 0xFF, n);
+	sbi(_UTFT->P_CS, _UTFT->B_CS);
+}
@@ -0,0 +1,84 @@
+/*
+  UTFT_Scroll.h - Add-on Library for UTFT: Scrolling console and chart
+  
+  This library uses the hardware scrolling of the display controller
+  (see setScrollArea() and scrollTo() in UTFT) to add text lines or 
+  chart samples without redrawing the rest of the view. Each new line of
+  text or chart sample is drawn once and the controller is told to show
+  the scroll area from a new start line.
+
+  UTFT_Console is a text view that uses the full width of the screen and
+  scrolls vertically. The current font and colors of UTFT are used; call
+  setFont() before begin().
+
+  UTFT_Chart is a strip chart. Time runs along the axis the controller 
+  scrolls (left to right in landscape and top to bottom in portrait mode
+  on most controllers, see getScrollAxis()), and the new sample is always
+  added at the end of the chart.
+
+  Hardware scrolling moves complete GRAM lines, so a view always spans
+  the full screen across the scroll axis, and only one view per display 
+  can scroll. When the controller can not scroll along the required axis
+  the console wraps to the top and the chart sweeps over its old samples
+  instead, which costs the same number of writes per line.
+
+  This library requires the UTFT library.
+*/
+
+#ifndef UTFT_Scroll_h
+#define UTFT_Scroll_h
+
+#include <UTFT.h>
+
+#define CONSOLE_SEGMENT		40
+
+class UTFT_Console
+{
+	public:
+		UTFT_Console(UTFT *ptrUTFT);
+
+		void	begin(int first, int last);
+		void	clear();
+		void	print(char *st);
+		void	println(char *st);
+		int		getLines();
+
+/*
+	The functions and variables below should not normally be used.
+*/
+		UTFT		*_UTFT;
+		boolean		_hw_scroll;
+		int			_first, _len, _line_height, _lines;
+		int			_row, _col, _offset;
+
+		int		_line_y(int row);
+		void	_clear_line(int row);
+		void	_newline();
+};
+
+class UTFT_Chart
+{
+	public:
+		UTFT_Chart(UTFT *ptrUTFT);
+
+		void	begin(int first, int last, int minValue, int maxValue);
+		void	setColors(word trace, word background, word grid);
+		void	setGrid(int spacing);
+		void	clear();
+		void	addSample(int value);
+
+/*
+	The functions and variables below should not normally be used.
+*/
+		UTFT		*_UTFT;
+		byte		_axis;
+		boolean		_hw_scroll;
+		int			_first, _len, _size, _min, _max;
+		int			_pos, _last, _grid;
+		word		_trace, _background, _grid_color;
+
+		int		_value_pixel(int value);
+		void	_line(int pos, int a, int b);
+};
+
+#endif
@@ -0,0 +1,188 @@
+// Scroll_Benchmark
+//
+// This program runs on a PC against the UTFT host emulator and checks
+// UTFT_Chart and UTFT_Console on controllers and orientations that 
+// scroll along different axes.
+//
+// For the chart it adds more samples than fit in the chart, compares 
+// what the emulated panel shows with the expected chart, and prints the
+// bus traffic per sample next to the traffic of redrawing the chart. 
+// For the console it prints more lines than fit on the screen and 
+// compares the panel with the same text printed without scrolling.
+//
+// Build and run from this folder with:
+//   g++ -O2 -DUTFT_HOST -Wno-write-strings -I../../../../UTFT -I../../.. Scroll_Benchmark.cpp ../../../UTFT_Scroll.cpp ../../../../UTFT/UTFT.cpp -x c ../../../../UTFT/DefaultFonts.c -o scroll
+//   ./scroll
+//
+
+#include <UTFT.h>
+#include <UTFT_Scroll.h>
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+
+#define SAMPLES		1000
+#define LINES		100
+#define MAX_PIXELS	(800*480)
+
+int		samples[SAMPLES];
+word	panel[MAX_PIXELS];
+int		errors = 0;
+
+// Value pixel of sample k as UTFT_Chart draws it
+int pixel(UTFT_Chart &chart, int k)
+{
+	return chart._value_pixel(samples[k]);
+}
+
+void checkChart(const char *name, byte model, byte orient, int first, int last)
+{
+	UTFT		lcd(model, 1, 2, 3, 4, 5);
+	UTFT_Chart	chart(&lcd);
+	long		bad = 0;
+
+	lcd.InitLCD(orient);
+	lcd.clrScr();
+	chart.setGrid(20);
+	chart.begin(first, last, -1000, 1000);
+
+	utft_host.resetStats();
+	for (int k=0; k<SAMPLES; k++)
+		chart.addSample(samples[k]);
+
+	// Screen line i of the chart shows sample SAMPLES-len+i
+	for (int i=0; i<chart._len; i++)
+	{
+		int	k = SAMPLES-chart._len+i;
+		int	a = min(pixel(chart, k), pixel(chart, k-1));
+		int	b = max(pixel(chart, k), pixel(chart, k-1));
+
+		for (int v=0; v<chart._size; v++)
+		{
+			word	expect, got;
+
+			if ((v>=a) and (v<=b))
+				expect = chart._trace;
+			else if ((v % 20)==0)
+				expect = chart._grid_color;
+			else
+				expect = chart._background;
+			if (chart._axis==SCROLL_X)
+				got = utft_host.getPixel(chart._first+i, chart._size-1-v);
+			else
+				got = utft_host.getPixel(v, chart._first+i);
+			if (got!=expect)
+				bad++;
+		}
+	}
+
+	unsigned long	repaint = (long(chart._len)*((chart._size*2)+11));
+
+	printf("Chart   %-12s %s %c  %4d lines  %5lu bytes/sample  %7lu bytes/repaint  %s\n", name, 
+		orient==PORTRAIT ? "P" : "L", chart._axis==SCROLL_X ? 'X' : 'Y', chart._len,
+		utft_host.stats.bytes/SAMPLES, repaint, chart._hw_scroll ? "scrolling" : "sweeping");
+	if (bad)
+	{
+		printf("  FAILED: %ld pixels differ\n", bad);
+		errors++;
+	}
+}
+
+void consoleLine(char *buf, int n)
+{
+	sprintf(buf, "Line %d: the quick brown fox", n);
+}
+
+void checkConsole(const char *name, byte model, byte orient)
+{
+	UTFT			lcd(model, 1, 2, 3, 4, 5);
+	UTFT_Console	console(&lcd);
+	char			buf[40];
+	int				w, h, top;
+	long			bad = 0;
+
+	lcd.InitLCD(orient);
+	lcd.clrScr();
+	lcd.setFont(SmallFont);
+	lcd.setColor(VGA_WHITE);
+	lcd.setBackColor(VGA_NAVY);
+	top = 24;
+	console.begin(top, lcd.getDisplayYSize()-1);
+
+	utft_host.resetStats();
+	for (int n=1; n<=LINES; n++)
+	{
+		consoleLine(buf, n);
+		console.println(buf);
+	}
+	unsigned long	bytes = utft_host.stats.bytes;
+
+	w = lcd.getDisplayXSize();
+	h = lcd.getDisplayYSize();
+	for (int y=0; y<h; y++)
+		for (int x=0; x<w; x++)
+			panel[(y*w)+x] = utft_host.getPixel(x, y);
+
+	// The same text without scrolling: the last row is the empty line 
+	// after the last println()
+	lcd.InitLCD(orient);
+	lcd.clrScr();
+	lcd.setFont(SmallFont);
+	lcd.setColor(VGA_NAVY);
+	lcd.fillRect(0, top, w-1, top+(console.getLines()*12)-1);
+	lcd.setColor(VGA_WHITE);
+	lcd.setBackColor(VGA_NAVY);
+	for (int r=0; r<console.getLines()-1; r++)
+	{
+		int	n = LINES-(console.getLines()-2)+r;
+
+		if (console._hw_scroll)
+		{
+			consoleLine(buf, n);
+			lcd.print(buf, 0, top+(r*12));
+		}
+	}
+	if (console._hw_scroll)
+		for (int y=0; y<h; y++)
+			for (int x=0; x<w; x++)
+				if (utft_host.getPixel(x, y)!=panel[(y*w)+x])
+					bad++;
+
+	printf("Console %-12s %s    %4d lines  %5lu bytes/line    %7lu bytes/repaint  %s\n", name, 
+		orient==PORTRAIT ? "P" : "L", console.getLines(), bytes/LINES, 
+		long(console.getLines())*12*w*2, console._hw_scroll ? "scrolling" : "wrapping");
+	if (bad)
+	{
+		printf("  FAILED: %ld pixels differ\n", bad);
+		errors++;
+	}
+}
+
+int main()
+{
+	long	v = 0;
+
+	srand(1);
+	for (int k=0; k<SAMPLES; k++)
+	{
+		v += (rand() % 201)-100;
+		if ((v<-1000) or (v>1000))
+			v /= 2;
+		samples[k] = v;
+	}
+
+	checkChart("ILI9341_S5P", ILI9341_S5P, LANDSCAPE, 20, 299);
+	checkChart("ILI9341_S5P", ILI9341_S5P, PORTRAIT, 40, 319);
+	checkChart("ILI9481", ILI9481, LANDSCAPE, 0, 479);
+	checkChart("ST7735", ST7735, LANDSCAPE, 10, 159);
+	checkChart("SSD1963_800", SSD1963_800, LANDSCAPE, 100, 479);
+	checkChart("SSD1963_800", SSD1963_800, PORTRAIT, 0, 399);
+
+	checkConsole("ILI9341_S5P", ILI9341_S5P, PORTRAIT);
+	checkConsole("ILI9481", ILI9481, PORTRAIT);
+	checkConsole("SSD1963_800", SSD1963_800, LANDSCAPE);
+	checkConsole("ILI9341_S5P", ILI9341_S5P, LANDSCAPE);
+
+	printf("%s\n", errors ? "FAILED" : "OK");
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,534 @@
+/*
+  UTFT_Widgets.cpp - Add-on Library for UTFT: Retained widgets
+
+  This library requires the UTFT library.
+*/
+
+#include "UTFT_Widgets.h"
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#endif
+
+UTFT_Widgets::UTFT_Widgets(UTFT *ptrUTFT)
+{
+	_UTFT = ptrUTFT;
+	for (int i=0; i<WIDGETS_MAX; i++)
+		widgets[i].type = WIDGET_NONE;
+}
+
+int UTFT_Widgets::_add_widget(byte type, int x1, int y1, int x2, int y2, word color, word bcolor)
+{
+	for (int i=0; i<WIDGETS_MAX; i++)
+	{
+		if (widgets[i].type==WIDGET_NONE)
+		{
+			widgets[i].type = type;
+			widgets[i].flags = WF_DIRTY;
+			widgets[i].x1 = x1;
+			widgets[i].y1 = y1;
+			widgets[i].x2 = x2;
+			widgets[i].y2 = y2;
+			widgets[i].color = color;
+			widgets[i].bcolor = bcolor;
+			widgets[i].font = 0;
+			widgets[i].text = 0;
+			widgets[i].value = 0;
+			widgets[i].drawn = 0;
+			widgets[i].min = 0;
+			widgets[i].max = 100;
+			widgets[i].dec = 0;
+			widgets[i].length = 0;
+			widgets[i].shown[0] = 0;
+			widgets[i].samples = 0;
+			widgets[i].pos = 0;
+			widgets[i].count = 0;
+			widgets[i].pending = 0;
+			return i;
+		}
+	}
+	return -1;
+}
+
+int UTFT_Widgets::addLabel(char *st, int x, int y, int width, uint8_t *font, word color, word bcolor)
+{
+	int id = _add_widget(WIDGET_LABEL, x, y, x+width-1, y, color, bcolor);
+
+	if (id>=0)
+	{
+		widgets[id].text = st;
+		widgets[id].font = font;
+	}
+	return id;
+}
+
+// The number is value/10^dec, right aligned in length characters. dec is
+// limited so that "-0." and the decimals fit in WIDGET_TEXT characters.
+int UTFT_Widgets::addNumeric(long value, byte dec, int x, int y, int length, uint8_t *font, word color, word bcolor)
+{
+	int id = _add_widget(WIDGET_NUMERIC, x, y, x, y, color, bcolor);
+
+	if (id>=0)
+	{
+		widgets[id].value = value;
+		widgets[id].dec = min(dec, WIDGET_TEXT-3);
+		widgets[id].length = min(length, WIDGET_TEXT);
+		widgets[id].font = font;
+	}
+	return id;
+}
+
+// Bars wider than they are high grow to the right, others grow upwards
+int UTFT_Widgets::addBar(int x1, int y1, int x2, int y2, int minValue, int maxValue, word color, word bcolor)
+{
+	int id;
+
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+	id = _add_widget(WIDGET_BAR, x1, y1, x2, y2, color, bcolor);
+	if (id>=0)
+	{
+		widgets[id].min = minValue;
+		widgets[id].max = maxValue;
+		widgets[id].value = minValue;
+	}
+	return id;
+}
+
+int UTFT_Widgets::addGauge(int x, int y, int radius, int width, int minValue, int maxValue, word color, word bcolor)
+{
+	int id = _add_widget(WIDGET_GAUGE, x, y, radius, width, color, bcolor);
+
+	if (id>=0)
+	{
+		widgets[id].min = minValue;
+		widgets[id].max = maxValue;
+		widgets[id].value = minValue;
+	}
+	return id;
+}
+
+// The buffer must hold one byte for each column of the sparkline
+int UTFT_Widgets::addSparkline(int x1, int y1, int x2, int y2, int minValue, int maxValue, uint8_t *buffer, word color, word bcolor)
+{
+	int id;
+
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+	id = _add_widget(WIDGET_SPARKLINE, x1, y1, x2, min(y2, y1+255), color, bcolor);
+	if (id>=0)
+	{
+		widgets[id].min = minValue;
+		widgets[id].max = maxValue;
+		widgets[id].samples = buffer;
+		widgets[id].pos = x2-x1;
+	}
+	return id;
+}
+
+int UTFT_Widgets::addButton(char *st, int x1, int y1, int x2, int y2, uint8_t *font, word color, word bcolor)
+{
+	int id;
+
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+	id = _add_widget(WIDGET_BUTTON, x1, y1, x2, y2, color, bcolor);
+	if (id>=0)
+	{
+		widgets[id].text = st;
+		widgets[id].font = font;
+	}
+	return id;
+}
+
+void UTFT_Widgets::setText(int id, char *st)
+{
+	if ((id<0) or (id>=WIDGETS_MAX))
+		return;
+	widgets[id].text = st;
+	widgets[id].flags |= WF_DIRTY;
+}
+
+void UTFT_Widgets::setValue(int id, long value)
+{
+	if ((id<0) or (id>=WIDGETS_MAX))
+		return;
+	if (widgets[id].type==WIDGET_SPARKLINE)
+	{
+		addSample(id, value);
+		return;
+	}
+	widgets[id].value = value;
+	widgets[id].flags |= WF_DIRTY;
+}
+
+void UTFT_Widgets::addSample(int id, int value)
+{
+	_widget	*w;
+	int		n, h;
+
+	if ((id<0) or (id>=WIDGETS_MAX) or (widgets[id].type!=WIDGET_SPARKLINE))
+		return;
+	w = &widgets[id];
+	n = w->x2-w->x1+1;
+	h = w->y2-w->y1;
+	value = constrain(value, min(w->min, w->max), max(w->min, w->max));
+	if (w->max!=w->min)
+		value = (long(value-w->min)*h)/(w->max-w->min);
+	else
+		value = 0;
+	w->pos = (w->pos+1)%n;
+	w->samples[w->pos] = value;
+	if (w->count<n)
+		w->count++;
+	if (w->pending<n)
+		w->pending++;
+	w->flags |= WF_DIRTY;
+}
+
+void UTFT_Widgets::setPressed(int id, boolean pressed)
+{
+	if ((id<0) or (id>=WIDGETS_MAX) or (pressed==((widgets[id].flags & WF_PRESSED)!=0)))
+		return;
+	widgets[id].flags ^= WF_PRESSED;
+	widgets[id].flags |= WF_DIRTY;
+}
+
+void UTFT_Widgets::setEnabled(int id, boolean enabled)
+{
+	if ((id<0) or (id>=WIDGETS_MAX) or (enabled==((widgets[id].flags & WF_DISABLED)==0)))
+		return;
+	widgets[id].flags ^= WF_DISABLED;
+	widgets[id].flags |= WF_DIRTY;
+}
+
+// Returns the enabled button at x,y, or -1
+int UTFT_Widgets::checkButtons(int x, int y)
+{
+	for (int i=0; i<WIDGETS_MAX; i++)
+		if ((widgets[i].type==WIDGET_BUTTON) and !(widgets[i].flags & WF_DISABLED) and
+			(x>=widgets[i].x1) and (x<=widgets[i].x2) and (y>=widgets[i].y1) and (y<=widgets[i].y2))
+			return i;
+	return -1;
+}
+
+void UTFT_Widgets::invalidate(int id)
+{
+	if ((id<0) or (id>=WIDGETS_MAX))
+		return;
+	widgets[id].flags &= ~WF_SHOWN;
+}
+
+void UTFT_Widgets::invalidateAll()
+{
+	for (int i=0; i<WIDGETS_MAX; i++)
+		widgets[i].flags &= ~WF_SHOWN;
+}
+
+void UTFT_Widgets::removeAllWidgets()
+{
+	for (int i=0; i<WIDGETS_MAX; i++)
+		widgets[i].type = WIDGET_NONE;
+}
+
+void UTFT_Widgets::update()
+{
+	word		color = _UTFT->getColor();
+	word		bcolor = _UTFT->getBackColor();
+	boolean		transparent = _UTFT->_transparent;
+	uint8_t		*font = _UTFT->getFont();
+	boolean		drawn = false;
+
+	for (int i=0; i<WIDGETS_MAX; i++)
+	{
+		_widget *w = &widgets[i];
+
+		if ((w->type==WIDGET_NONE) or ((w->flags & (WF_DIRTY | WF_SHOWN))==WF_SHOWN))
+			continue;
+		_draw(w, !(w->flags & WF_SHOWN));
+		w->flags = (w->flags & ~WF_DIRTY) | WF_SHOWN;
+		drawn = true;
+	}
+	if (!drawn)
+		return;
+	_UTFT->setColor(color);
+	if (transparent)
+		_UTFT->setBackColor(VGA_TRANSPARENT);
+	else
+		_UTFT->setBackColor(bcolor);
+	if (font)
+		_UTFT->setFont(font);
+}
+
+void UTFT_Widgets::_draw(_widget *w, boolean full)
+{
+	char	st[WIDGET_TEXT+1];
+
+	switch (w->type)
+	{
+	case WIDGET_LABEL:
+		_draw_text(w, w->text ? w->text : (char *)"", full);
+		break;
+	case WIDGET_NUMERIC:
+		_format(w, st);
+		_draw_text(w, st, full);
+		break;
+	case WIDGET_BAR:
+		_draw_bar(w, full);
+		break;
+	case WIDGET_GAUGE:
+		_draw_gauge(w, full);
+		break;
+	case WIDGET_SPARKLINE:
+		_draw_sparkline(w, full);
+		break;
+	case WIDGET_BUTTON:
+		_draw_button(w);
+		break;
+	}
+}
+
+// With a fixed width font only the runs of characters that differ from
+// the text on the screen are printed. Proportional fonts move the
+// characters after a change, so the text is printed again and only the
+// part that the new text no longer covers is cleared.
+void UTFT_Widgets::_draw_text(_widget *w, char *st, boolean full)
+{
+	char	run[WIDGET_TEXT+1];
+	int		len, old, fw, fh, i, j, tw, ow;
+
+	_UTFT->setFont(w->font);
+	_UTFT->setColor(w->color);
+	_UTFT->setBackColor(w->bcolor);
+	fh = _UTFT->getFontYsize();
+	len = min(int(strlen(st)), WIDGET_TEXT);
+	memcpy(run, st, len);
+	run[len] = 0;
+
+	if (full or (_UTFT->cfont.bpp!=0))
+	{
+		if (!full)
+			ow = _UTFT->getTextWidth(w->shown);
+		else if (w->type==WIDGET_NUMERIC)
+			ow = w->length*_UTFT->getFontXsize();
+		else
+			ow = w->x2-w->x1+1;
+		_UTFT->print(run, w->x1, w->y1);
+		tw = _UTFT->getTextWidth(run);
+		if (tw<ow)
+		{
+			_UTFT->setColor(w->bcolor);
+			_UTFT->fillRect(w->x1+tw, w->y1, w->x1+ow-1, w->y1+fh-1);
+		}
+		strcpy(w->shown, run);
+		return;
+	}
+
+	fw = _UTFT->getFontXsize();
+	old = strlen(w->shown);
+	for (i=0; i<len; i=j)
+	{
+		if ((i<old) and (st[i]==w->shown[i]))
+		{
+			j = i+1;
+			continue;
+		}
+		for (j=i; (j<len) and ((j>=old) or (st[j]!=w->shown[j])); j++)
+			run[j-i] = st[j];
+		run[j-i] = 0;
+		_UTFT->print(run, w->x1+(i*fw), w->y1);
+	}
+	if (len<old)
+	{
+		_UTFT->setColor(w->bcolor);
+		_UTFT->fillRect(w->x1+(len*fw), w->y1, w->x1+(old*fw)-1, w->y1+fh-1);
+	}
+	memcpy(w->shown, st, len);
+	w->shown[len] = 0;
+}
+
+void UTFT_Widgets::_format(_widget *w, char *st)
+{
+	char			buf[WIDGET_TEXT+12];
+	unsigned long	v = (w->value<0) ? 0-(unsigned long)w->value : w->value;
+	int				n = 0, i = 0, p = 0;
+
+	do
+	{
+		if ((w->dec>0) and (i==w->dec))
+			buf[n++] = '.';
+		buf[n++] = '0'+(v%10);
+		v /= 10;
+		i++;
+	} while ((v>0) or (i<=w->dec));
+	if (w->value<0)
+		buf[n++] = '-';
+	while ((p+n<w->length) and (p<WIDGET_TEXT))
+		st[p++] = ' ';
+	while ((n>0) and (p<WIDGET_TEXT))
+		st[p++] = buf[--n];
+	st[p] = 0;
+}
+
+// Only the part between the length on the screen and the new length is
+// filled, with the bar color when it grows and the background when it
+// shrinks.
+void UTFT_Widgets::_draw_bar(_widget *w, boolean full)
+{
+	boolean	horizontal = (w->x2-w->x1)>=(w->y2-w->y1);
+	int		size = horizontal ? (w->x2-w->x1+1) : (w->y2-w->y1+1);
+	long	value = constrain(w->value, min(w->min, w->max), max(w->min, w->max));
+	int		len = (w->max!=w->min) ? ((value-w->min)*size)/(w->max-w->min) : 0;
+
+	if (full)
+	{
+		if (len>0)
+			_bar_part(w, horizontal, 0, len-1, w->color);
+		if (len<size)
+			_bar_part(w, horizontal, len, size-1, w->bcolor);
+	}
+	else if (len>w->drawn)
+		_bar_part(w, horizontal, w->drawn, len-1, w->color);
+	else if (len<w->drawn)
+		_bar_part(w, horizontal, len, w->drawn-1, w->bcolor);
+	w->drawn = len;
+}
+
+// Fills the pixels from a to b, counted from the start of the bar
+void UTFT_Widgets::_bar_part(_widget *w, boolean horizontal, int a, int b, word color)
+{
+	_UTFT->setColor(color);
+	if (horizontal)
+		_UTFT->fillRect(w->x1+a, w->y1, w->x1+b, w->y2);
+	else
+		_UTFT->fillRect(w->x1, w->y2-b, w->x2, w->y2-a);
+}
+
+// The arc from the start to the value is in the gauge color. Both edges
+// of a filled arc belong to it, so after the arc shrinks a one degree
+// slice is filled again to restore the pixels on the new end edge.
+void UTFT_Widgets::_draw_gauge(_widget *w, boolean full)
+{
+	long	value = constrain(w->value, min(w->min, w->max), max(w->min, w->max));
+	int		angle = GAUGE_START+((w->max!=w->min) ? ((value-w->min)*GAUGE_SWEEP)/(w->max-w->min) : 0);
+	int		r = w->x2, ri = max(w->x2-w->y2, 0);
+
+	if (full)
+	{
+		_UTFT->setColor(w->bcolor);
+		_UTFT->fillArc(w->x1, w->y1, r, ri, GAUGE_START, GAUGE_START+GAUGE_SWEEP);
+		if (angle>GAUGE_START)
+		{
+			_UTFT->setColor(w->color);
+			_UTFT->fillArc(w->x1, w->y1, r, ri, GAUGE_START, angle);
+		}
+	}
+	else if (angle>w->drawn)
+	{
+		_UTFT->setColor(w->color);
+		_UTFT->fillArc(w->x1, w->y1, r, ri, w->drawn, angle);
+	}
+	else if (angle<w->drawn)
+	{
+		_UTFT->setColor(w->bcolor);
+		_UTFT->fillArc(w->x1, w->y1, r, ri, angle, w->drawn);
+		if (angle>GAUGE_START)
+		{
+			_UTFT->setColor(w->color);
+			_UTFT->fillArc(w->x1, w->y1, r, ri, angle-1, angle);
+		}
+	}
+	w->drawn = angle;
+}
+
+// Samples are drawn from left to right and wrap around. Each column joins
+// its sample to the one on its left, except the oldest one, so a new
+// sample changes its own column and turns the next one into the oldest.
+void UTFT_Widgets::_draw_sparkline(_widget *w, boolean full)
+{
+	int n = w->x2-w->x1+1;
+
+	if (full or (w->pending>=n))
+	{
+		_UTFT->setColor(w->bcolor);
+		_UTFT->fillRect(w->x1, w->y1, w->x2, w->y2);
+		for (int i=0; i<w->count; i++)
+			_spark_column(w, i);
+	}
+	else
+	{
+		for (int i=w->pending-1; i>=0; i--)
+		{
+			int c = (w->pos-i+n)%n;
+
+			_UTFT->setColor(w->bcolor);
+			_UTFT->fillRect(w->x1+c, w->y1, w->x1+c, w->y2);
+			_spark_column(w, c);
+		}
+		if (w->count==n)
+		{
+			int c = (w->pos+1)%n;
+
+			_UTFT->setColor(w->bcolor);
+			_UTFT->fillRect(w->x1+c, w->y1, w->x1+c, w->y2);
+			_spark_column(w, c);
+		}
+	}
+	w->pending = 0;
+}
+
+void UTFT_Widgets::_spark_column(_widget *w, int i)
+{
+	int n = w->x2-w->x1+1;
+	int oldest = (w->count<n) ? 0 : (w->pos+1)%n;
+	int y = w->y2-w->samples[i];
+
+	_UTFT->setColor(w->color);
+	if (i==oldest)
+		_UTFT->drawPixel(w->x1+i, y);
+	else
+	{
+		int yp = w->y2-w->samples[(i+n-1)%n];
+
+		_UTFT->fillRect(w->x1+i, y, w->x1+i, yp);
+	}
+}
+
+// The colors are swapped while the button is pressed
+void UTFT_Widgets::_draw_button(_widget *w)
+{
+	boolean	pressed = w->flags & WF_PRESSED;
+	word	face = pressed ? w->color : w->bcolor;
+	word	ink = (w->flags & WF_DISABLED) ? VGA_GRAY : (pressed ? w->bcolor : w->color);
+	char	st[WIDGET_TEXT+1];
+	int		len = w->text ? min(int(strlen(w->text)), WIDGET_TEXT) : 0;
+
+	_UTFT->setColor(face);
+	_UTFT->fillRoundRect(w->x1, w->y1, w->x2, w->y2);
+	_UTFT->setColor(ink);
+	_UTFT->drawRoundRect(w->x1, w->y1, w->x2, w->y2);
+	if (len==0)
+		return;
+	memcpy(st, w->text, len);
+	st[len] = 0;
+	_UTFT->setFont(w->font);
+	_UTFT->setBackColor(face);
+	_UTFT->print(st, (w->x1+w->x2+1-_UTFT->getTextWidth(st))/2, (w->y1+w->y2+1-_UTFT->getFontYsize())/2);
+}
@@ -0,0 +1,127 @@
+/*
+  UTFT_Widgets.h - Add-on Library for UTFT: Retained widgets
+
+  This library keeps a list of simple widgets (labels, numbers, bars,
+  gauges, sparklines and buttons) and remembers what each of them shows
+  on the screen. Changing a widget only records the new state. update()
+  then draws the difference between what is shown and the new state:
+
+    Label, Numeric	Only the characters that changed are printed. With
+					proportional fonts the text is printed again and the
+					part that is no longer used is cleared.
+    Bar				Only the part between the old and the new length is
+					filled, so a bar going from 40% to 42% sends 2% of
+					the bar.
+    Gauge			Only the arc between the old and the new angle is
+					filled.
+    Sparkline		New samples are added at a moving cursor, which
+					redraws one column per sample and the column after it.
+    Button			Drawn again when its text or state changes.
+
+  Several changes between two calls to update() are drawn as one, from
+  the state that is shown to the last one. Call invalidate() or
+  invalidateAll() after drawing over widgets (after clrScr() for
+  example) to have them drawn in full by the next update().
+
+  Widgets must be added after InitLCD(). Labels and buttons keep a
+  pointer to the string; call setText() after changing it. Only the
+  first WIDGET_TEXT characters are shown. Sparklines keep one byte per
+  column in a buffer supplied by the sketch.
+
+  The colors and font of UTFT are restored after update().
+
+  This library requires the UTFT library.
+*/
+
+#ifndef UTFT_Widgets_h
+#define UTFT_Widgets_h
+
+#include <UTFT.h>
+
+#if !defined(WIDGETS_MAX)
+	#if defined(__AVR__)
+		#define WIDGETS_MAX		8
+	#else
+		#define WIDGETS_MAX		24
+	#endif
+#endif
+#if !defined(WIDGET_TEXT)
+	#define WIDGET_TEXT			16
+#endif
+
+#define WIDGET_NONE			0
+#define WIDGET_LABEL		1
+#define WIDGET_NUMERIC		2
+#define WIDGET_BAR			3
+#define WIDGET_GAUGE		4
+#define WIDGET_SPARKLINE	5
+#define WIDGET_BUTTON		6
+
+// Widget flags
+#define WF_DIRTY			1	// State changed since it was drawn
+#define WF_SHOWN			2	// The screen shows the drawn state
+#define WF_PRESSED			4
+#define WF_DISABLED			8
+
+// Gauges cover 270 degrees with the gap at the bottom
+#define GAUGE_START			135
+#define GAUGE_SWEEP			270
+
+struct _widget
+{
+	byte		type;
+	byte		flags;
+	int			x1, y1, x2, y2;			// Gauge: center, radius and width
+	word		color, bcolor;
+	uint8_t		*font;
+	char		*text;
+	long		value, drawn;			// New and shown value. Bars and gauges
+										// keep the shown length or angle.
+	int			min, max;
+	byte		dec, length;			// Numeric format
+	char		shown[WIDGET_TEXT+1];	// Text on the screen
+	uint8_t		*samples;				// Sparkline: pixels above the bottom
+	int			pos, count, pending;
+};
+
+class UTFT_Widgets
+{
+	public:
+		UTFT_Widgets(UTFT *ptrUTFT);
+
+		int		addLabel(char *st, int x, int y, int width, uint8_t *font, word color, word bcolor);
+		int		addNumeric(long value, byte dec, int x, int y, int length, uint8_t *font, word color, word bcolor);
+		int		addBar(int x1, int y1, int x2, int y2, int minValue, int maxValue, word color, word bcolor);
+		int		addGauge(int x, int y, int radius, int width, int minValue, int maxValue, word color, word bcolor);
+		int		addSparkline(int x1, int y1, int x2, int y2, int minValue, int maxValue, uint8_t *buffer, word color, word bcolor);
+		int		addButton(char *st, int x1, int y1, int x2, int y2, uint8_t *font, word color, word bcolor);
+		void	setText(int id, char *st);
+		void	setValue(int id, long value);
+		void	addSample(int id, int value);
+		void	setPressed(int id, boolean pressed);
+		void	setEnabled(int id, boolean enabled);
+		int		checkButtons(int x, int y);
+		void	invalidate(int id);
+		void	invalidateAll();
+		void	update();
+		void	removeAllWidgets();
+
+/*
+	The functions and variables below should not normally be used.
+*/
+		UTFT		*_UTFT;
+		_widget		widgets[WIDGETS_MAX];
+
+		int		_add_widget(byte type, int x1, int y1, int x2, int y2, word color, word bcolor);
+		void	_draw(_widget *w, boolean full);
+		void	_draw_text(_widget *w, char *st, boolean full);
+		void	_format(_widget *w, char *st);
+		void	_draw_bar(_widget *w, boolean full);
+		void	_bar_part(_widget *w, boolean horizontal, int a, int b, word color);
+		void	_draw_gauge(_widget *w, boolean full);
+		void	_draw_sparkline(_widget *w, boolean full);
+		void	_spark_column(_widget *w, int i);
+		void	_draw_button(_widget *w);
+};
+
+#endif
@@ -0,0 +1,196 @@
+// Widgets_Benchmark
+//
+// This program runs on a PC against the UTFT host emulator and compares
+// the bus traffic needed to animate a dashboard made of widgets when:
+//   - every widget is drawn in full for every frame
+//   - only the changes are drawn by UTFT_Widgets
+// Every 25 frames the screen is drawn again in full and compared pixel by
+// pixel with the screen made by the changes alone.
+//
+// Build and run from this folder with:
+//   g++ -DUTFT_HOST -Wno-write-strings -I../../../../UTFT -I../../.. Widgets_Benchmark.cpp ../../../UTFT_Widgets.cpp ../../../../UTFT/UTFT.cpp -x c ../../../../UTFT/DefaultFonts.c -o widgets
+//   ./widgets
+//
+// The proportional font comes from the UTFT_Host_AAFont example. The last
+// screen is saved as widgets.ppm.
+//
+
+#include <UTFT.h>
+#include <UTFT_Widgets.h>
+
+#include "../../../../UTFT/examples/Host (Linux)/UTFT_Host_AAFont/Lato20.c"
+
+// Declare which fonts we will be using
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+
+#define FRAMES		300
+#define BACK		VGA_BLACK
+
+UTFT          myGLCD(ILI9341_S5P, 4, 5, 6, 7, 8);
+UTFT_Widgets  myWidgets(&myGLCD);
+
+char          *states[] = {"Idle", "Heating", "Hold", "Cooling down", "Error"};
+char          *modes[] = {"MODE A", "MODE B", "MODE C"};
+char          *titles[] = {"Temp", "Temperature", "T", "Temp (C)"};
+uint8_t       spark1[200], spark2[96];
+word          frame[240*320];
+int           errors = 0;
+
+int           state, title, temp, rpm, level, fan, power, load, trend1, trend2, start, stop;
+
+void setup()
+{
+  myGLCD.InitLCD(PORTRAIT);
+  myGLCD.fillScr(BACK);
+  myWidgets.removeAllWidgets();
+  title = myWidgets.addLabel(titles[0], 10, 6, 220, (uint8_t *)Lato20, VGA_WHITE, BACK);
+  state = myWidgets.addLabel(states[0], 10, 34, 200, SmallFont, VGA_YELLOW, BACK);
+  temp = myWidgets.addNumeric(0, 1, 10, 52, 7, BigFont, VGA_LIME, BACK);
+  rpm = myWidgets.addNumeric(0, 0, 140, 52, 6, SmallFont, VGA_AQUA, BACK);
+  level = myWidgets.addBar(10, 78, 229, 89, 0, 1000, VGA_GREEN, VGA_GRAY);
+  fan = myWidgets.addBar(210, 100, 229, 199, 0, 100, VGA_RED, VGA_NAVY);
+  power = myWidgets.addGauge(70, 150, 50, 12, 0, 500, VGA_YELLOW, VGA_GRAY);
+  load = myWidgets.addGauge(160, 150, 30, 30, -50, 50, VGA_FUCHSIA, VGA_TEAL);
+  trend1 = myWidgets.addSparkline(20, 210, 219, 249, 0, 1000, spark1, VGA_LIME, VGA_NAVY);
+  trend2 = myWidgets.addSparkline(20, 256, 115, 271, -100, 100, spark2, VGA_WHITE, BACK);
+  start = myWidgets.addButton(modes[0], 10, 280, 115, 310, BigFont, VGA_WHITE, VGA_BLUE);
+  stop = myWidgets.addButton("STOP", 125, 280, 229, 310, BigFont, VGA_WHITE, VGA_MAROON);
+  myWidgets.update();
+}
+
+void animate(int f)
+{
+  long v = ((f*37)+(f*f*7)) % 1000;
+
+  myWidgets.setValue(temp, 200+(((f*f*13) % 700)-350));
+  myWidgets.setValue(rpm, 800+((f*53) % 4000));
+  myWidgets.setValue(level, 500+((f % 100)<50 ? (f % 50)*9 : -(f % 50)*9));
+  myWidgets.setValue(fan, (f*3) % 101);
+  myWidgets.setValue(power, (f % 40)<20 ? (f % 20)*25 : 500-((f % 20)*25));
+  myWidgets.setValue(load, ((f*17) % 101)-50);
+  myWidgets.addSample(trend1, v);
+  if (f % 3==0)
+    myWidgets.addSample(trend2, ((f*29) % 201)-100);
+  if (f % 2==0)
+    myWidgets.addSample(trend1, 1000-v);
+  if (f % 20==0)
+    myWidgets.setText(state, states[(f/20) % 5]);
+  if (f % 30==0)
+    myWidgets.setText(title, titles[(f/30) % 4]);
+  if (f % 45==0)
+    myWidgets.setText(start, modes[(f/45) % 3]);
+  myWidgets.setPressed(stop, (f % 14)<3);
+  myWidgets.setEnabled(start, (f % 60)<50);
+}
+
+void drawFull()
+{
+  myWidgets.invalidateAll();
+  myWidgets.update();
+}
+
+void compare(int f)
+{
+  long diff = 0;
+
+  for (int y=0; y<320; y++)
+    for (int x=0; x<240; x++)
+      frame[(y*240)+x] = utft_host.getPixel(x, y);
+  myGLCD.fillScr(BACK);
+  drawFull();
+  for (int y=0; y<320; y++)
+    for (int x=0; x<240; x++)
+      if (frame[(y*240)+x]!=utft_host.getPixel(x, y))
+        diff++;
+  if (diff)
+  {
+    printf("FAILED: frame %d, %ld pixels differ from a full redraw\n", f, diff);
+    errors++;
+  }
+}
+
+unsigned long run(boolean changes)
+{
+  unsigned long bytes = 0, windows = 0;
+
+  setup();
+  for (int f=0; f<FRAMES; f++)
+  {
+    animate(f);
+    utft_host.resetStats();
+    if (changes)
+      myWidgets.update();
+    else
+      drawFull();
+    bytes += utft_host.stats.bytes;
+    windows += utft_host.stats.windows;
+    if (changes and ((f % 25)==24))
+      compare(f);
+  }
+  printf("%-22s %10lu %10lu\n", changes ? "Changes only" : "Full redraw", bytes/FRAMES, windows/FRAMES);
+  return bytes;
+}
+
+// A bar going from 40% to 42% only sends the 2% between them
+void barSliver()
+{
+  int           bar;
+  unsigned long full;
+
+  setup();
+  bar = myWidgets.addBar(0, 300, 199, 311, 0, 100, VGA_GREEN, VGA_GRAY);
+  myWidgets.setValue(bar, 40);
+  myWidgets.update();
+  myWidgets.invalidate(bar);
+  utft_host.resetStats();
+  myWidgets.update();
+  full = utft_host.stats.pixels;
+  myWidgets.setValue(bar, 42);
+  utft_host.resetStats();
+  myWidgets.update();
+  printf("Bar 200x12 from 40%% to 42%%: %lu pixels, %lu bytes (full bar: %lu pixels)\n",
+    utft_host.stats.pixels, utft_host.stats.bytes, full);
+  if ((utft_host.stats.pixels!=4*12) or (utft_host.getPixel(83, 305)!=VGA_GREEN) or (utft_host.getPixel(84, 305)!=VGA_GRAY))
+  {
+    printf("FAILED: bar sliver\n");
+    errors++;
+  }
+  myWidgets.setValue(bar, 42);
+  utft_host.resetStats();
+  myWidgets.update();
+  if (utft_host.stats.bytes!=0)
+  {
+    printf("FAILED: unchanged value sent %lu bytes\n", utft_host.stats.bytes);
+    errors++;
+  }
+}
+
+int main()
+{
+  unsigned long full, changes;
+
+  printf("ILI9341_S5P, %d frames\n", FRAMES);
+  printf("%-22s %10s %10s\n", "Method", "Bytes/frm", "Windows/frm");
+  full = run(false);
+  changes = run(true);
+  printf("Changes only send %.1f%% of the bytes\n", (changes*100.0)/full);
+  utft_host.savePPM("widgets.ppm");
+
+  barSliver();
+  setup();
+  if ((myWidgets.checkButtons(50, 290)!=start) or (myWidgets.checkButtons(200, 300)!=stop) or (myWidgets.checkButtons(120, 290)!=-1))
+  {
+    printf("FAILED: checkButtons()\n");
+    errors++;
+  }
+  myWidgets.setEnabled(start, false);
+  if (myWidgets.checkButtons(50, 290)!=-1)
+  {
+    printf("FAILED: checkButtons() on a disabled button\n");
+    errors++;
+  }
+
+  printf("%s\n", errors ? "FAILED" : "OK");
+  return errors ? 1 : 0;
+}